@@ -3,6 +3,7 @@
 #include "Controllers/ConveyorController.h"
 #include "Controllers/RobotController.h"
 #include "Controllers/RotaryTableController.h"
+#include "Coroutines/coroutine.hpp"
 #include "Link/LinkFactory.hpp"
 #include "Logger/Logger.hpp"
 #include "Logger/TraceLogger.hpp"
@@ -173,6 +174,11 @@ namespace backend
           rotarySymbols);
         m_exitConveyorSim = std::make_shared<core::sim::ConveyorSimulator>(exitConveyorConfig, m_adsLink);
 
+        m_robotSim->bindExecutor(m_simulationPool);
+        m_rotaryTableSim->bindExecutor(m_simulationPool);
+        m_exitConveyorSim->bindExecutor(m_simulationPool);
+        m_simulationThread = std::jthread{ [this] { m_simulationPool.run(); } };
+
         m_robotSim->setInternalMode(m_runtimeConfig.simulation.robot.internal);
         m_rotaryTableSim->setInternalMode(m_runtimeConfig.simulation.rotaryTable.internal);
         m_exitConveyorSim->setInternalMode(m_runtimeConfig.simulation.exitConveyor.internal);
@@ -239,6 +245,23 @@ namespace backend
 
     Backend::~Backend()
     {
+        // Stop the comm loops, wake those sleeping so they leave through their strands, and drain the
+        // pool while the simulators are still alive.
+        if (m_robotSim) {
+            m_robotSim->stop();
+        }
+        if (m_rotaryTableSim) {
+            m_rotaryTableSim->stop();
+        }
+        if (m_exitConveyorSim) {
+            m_exitConveyorSim->stop();
+        }
+        m_simulationStop.request_stop();
+        m_simulationPool.stop();
+        if (m_simulationThread.joinable()) {
+            m_simulationThread.join();
+        }
+
         core::logger::TraceLogger::instance().event(
           core::logger::TraceCategory::Lifecycle,
           "backend",
@@ -503,16 +526,6 @@ namespace backend
         core::logger::info("Backend: Simulation reset by user");
     }
 
-    void Backend::startBackgroundTask(core::coro::Task<void>&& task)
-    {
-        m_backgroundTasks.push_back(std::move(task));
-        auto& backgroundTask = m_backgroundTasks.back();
-        const auto handle = backgroundTask.getHandle();
-        if (handle) {
-            handle.resume();
-        }
-    }
-
     void Backend::startUpdateLoop()
     {
         m_lastUpdateTime = std::chrono::steady_clock::now();
@@ -527,13 +540,13 @@ namespace backend
                 m_cellCoordinator->update(dt);
             }
             if (m_rotaryTableSim && m_localSimulationEnabled && m_localTableSimulationEnabled) {
-                m_rotaryTableSim->update(dt);
+                m_rotaryTableSim->scheduleUpdate(dt);
             }
             if (m_robotSim && m_localSimulationEnabled) {
-                m_robotSim->update(dt);
+                m_robotSim->scheduleUpdate(dt);
             }
             if (m_exitConveyorSim && m_localSimulationEnabled && m_localConveyorSimulationEnabled) {
-                m_exitConveyorSim->update(dt);
+                m_exitConveyorSim->scheduleUpdate(dt);
             }
 
             if (m_rotaryTableController) {
@@ -555,12 +568,15 @@ namespace backend
         }
 
         m_robotCommTaskStarted = true;
-        startBackgroundTask([sim = m_robotSim]() -> core::coro::Task<void> {
-            auto res = co_await sim->initialize();
-            if (res) {
-                co_await sim->run();
-            }
-        }());
+        core::coro::co_spawn(
+          *m_robotSim->executor(),
+          [sim = m_robotSim](core::coro::IExecutor&) -> core::coro::Task<void> {
+              auto res = co_await sim->initialize();
+              if (res) {
+                  co_await sim->run();
+              }
+          },
+          m_simulationStop.get_token());
     }
 
     void Backend::ensureRotaryTableCommTask()
@@ -571,12 +587,15 @@ namespace backend
         }
 
         m_rotaryTableCommTaskStarted = true;
-        startBackgroundTask([sim = m_rotaryTableSim]() -> core::coro::Task<void> {
-            auto res = co_await sim->initialize();
-            if (res) {
-                co_await sim->run();
-            }
-        }());
+        core::coro::co_spawn(
+          *m_rotaryTableSim->executor(),
+          [sim = m_rotaryTableSim](core::coro::IExecutor&) -> core::coro::Task<void> {
+              auto res = co_await sim->initialize();
+              if (res) {
+                  co_await sim->run();
+              }
+          },
+          m_simulationStop.get_token());
     }
 
     void Backend::ensureExitConveyorCommTask()
@@ -587,11 +606,14 @@ namespace backend
         }
 
         m_exitConveyorCommTaskStarted = true;
-        startBackgroundTask([sim = m_exitConveyorSim]() -> core::coro::Task<void> {
-            auto res = co_await sim->initialize();
-            if (res) {
-                co_await sim->run();
-            }
-        }());
+        core::coro::co_spawn(
+          *m_exitConveyorSim->executor(),
+          [sim = m_exitConveyorSim](core::coro::IExecutor&) -> core::coro::Task<void> {
+              auto res = co_await sim->initialize();
+              if (res) {
+                  co_await sim->run();
+              }
+          },
+          m_simulationStop.get_token());
     }
 }
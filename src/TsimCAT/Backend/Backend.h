@@ -2,6 +2,7 @@
 #define BACKEND_H
 
 #include "../Core/Coroutines/Task.hpp"
+#include "../Core/Coroutines/ThreadPool.hpp"
 #include "Controllers/ConveyorController.h"
 #include "Controllers/RobotController.h"
 #include "Controllers/RotaryTableController.h"
@@ -14,7 +15,8 @@
 #include <QtQml/qqmlregistration.h>
 #include <chrono>
 #include <memory>
-#include <vector>
+#include <stop_token>
+#include <thread>
 
 namespace core::link
 {
@@ -113,7 +115,6 @@ namespace backend
         void simulationSettingsChanged();
 
       private:
-        void startBackgroundTask(core::coro::Task<void>&& task);
         void startUpdateLoop();
         void ensureRobotCommTask();
         void ensureRotaryTableCommTask();
@@ -124,6 +125,12 @@ namespace backend
         std::shared_ptr<core::link::ILink> m_tcpLink;
         std::shared_ptr<core::link::ILink> m_adsLink;
 
+        // Each simulator serializes itself on its own strand of this pool, one worker per simulator.
+        // Declared before the simulators so it outlives their strands.
+        core::coro::ThreadPool m_simulationPool{ 3 };
+        std::jthread m_simulationThread;
+        std::stop_source m_simulationStop;
+
         std::shared_ptr<core::sim::RobotSimulator> m_robotSim;
         std::shared_ptr<core::sim::RotaryTableSimulator> m_rotaryTableSim;
         std::shared_ptr<core::sim::ConveyorSimulator> m_exitConveyorSim;
@@ -146,7 +153,6 @@ namespace backend
         bool m_autoDespawnPartsEnabled{ true };
         QTimer* m_updateTimer{ nullptr };
         std::chrono::steady_clock::time_point m_lastUpdateTime{};
-        std::vector<core::coro::Task<void>> m_backgroundTasks;
     };
 }
 
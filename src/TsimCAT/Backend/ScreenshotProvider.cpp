@@ -110,7 +110,7 @@ namespace backend
             QJsonObject robot;
             const auto status = m_refs.robot->status();
             const auto control = m_refs.robot->control();
-            const double* joints = m_refs.robot->jointAngles();
+            const auto joints = m_refs.robot->jointAngles();
             const auto pose = m_refs.robot->currentPose();
 
             QJsonArray jointArr;
@@ -0,0 +1,248 @@
+#pragma once
+
+#include "Cancellation.hpp"
+#include "Context.hpp"
+
+#include "Utils/intrusive_list.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace core::coro
+{
+    /**
+     * Fixed-size thread pool for blocking driver calls (ADS connect, OPC UA services, ...).
+     *
+     * The submission queue is bounded: once it holds queueCapacity jobs, a submission is parked on a
+     * waiter list and moved into the queue when a worker frees a slot. The submitter is never blocked,
+     * so a burst of reconnect attempts waits behind the existing workers without stalling an executor
+     * or spawning a thread per call.
+     */
+    class BlockingPool
+    {
+      public:
+        using Job = std::move_only_function<void()>;
+
+        // A submission waiting for room in the queue. It lives with its submitter, which keeps it alive
+        // while linked.
+        struct PendingJob
+        {
+            Job job{};
+            PendingJob* prev{ nullptr };
+            PendingJob* next{ nullptr };
+            bool linked{ false }; // guarded by the pool mutex
+        };
+
+        static constexpr size_t DEFAULT_THREAD_COUNT{ 4 };
+        static constexpr size_t DEFAULT_QUEUE_CAPACITY{ 64 };
+
+        explicit BlockingPool(size_t threadCount = DEFAULT_THREAD_COUNT,
+                              size_t queueCapacity = DEFAULT_QUEUE_CAPACITY)
+          : m_capacity{ std::max<size_t>(queueCapacity, 1) }
+        {
+            threadCount = std::max<size_t>(threadCount, 1);
+            m_threads.reserve(threadCount);
+            for (size_t i = 0; i < threadCount; ++i) {
+                m_threads.emplace_back([this] { workerLoop(); });
+            }
+        }
+
+        // Jobs still queued or parked are run before the workers exit.
+        ~BlockingPool()
+        {
+            {
+                std::scoped_lock lock(m_mutex);
+                m_running = false;
+                for (auto* pending{ m_parked.takeAll() }; pending; pending = pending->next) {
+                    pending->linked = false;
+                    m_jobs.push_back(std::move(pending->job));
+                }
+            }
+            m_notEmpty.notify_all();
+            for (auto& thread : m_threads) {
+                thread.join();
+            }
+        }
+
+        BlockingPool(const BlockingPool&) = delete;
+        BlockingPool& operator=(const BlockingPool&) = delete;
+
+        static auto instance() -> BlockingPool&
+        {
+            static BlockingPool s_instance;
+            return s_instance;
+        }
+
+        // Queues pending.job, or parks `pending` until a slot frees; never blocks. Returns false, leaving
+        // the job where it is, once the pool is shutting down.
+        [[nodiscard]] auto submit(PendingJob& pending) -> bool
+        {
+            {
+                std::scoped_lock lock(m_mutex);
+                if (!m_running) {
+                    return false;
+                }
+                if (m_jobs.size() >= m_capacity) {
+                    pending.linked = true;
+                    m_parked.pushBack(&pending);
+                    return true;
+                }
+                m_jobs.push_back(std::move(pending.job));
+            }
+            m_notEmpty.notify_one();
+            return true;
+        }
+
+        // Takes a parked submission back; its job is dropped. Does nothing once it has been queued.
+        auto withdraw(PendingJob& pending) -> void
+        {
+            Job job;
+            std::scoped_lock lock(m_mutex);
+            if (pending.linked) {
+                m_parked.remove(&pending);
+                pending.linked = false;
+                job = std::move(pending.job);
+            }
+        }
+
+        auto threadCount() const -> size_t { return m_threads.size(); }
+        auto capacity() const -> size_t { return m_capacity; }
+
+      private:
+        auto workerLoop() -> void
+        {
+            while (true) {
+                Job job;
+                {
+                    std::unique_lock lock(m_mutex);
+                    m_notEmpty.wait(lock, [this] { return !m_jobs.empty() || !m_running; });
+                    if (m_jobs.empty()) {
+                        return;
+                    }
+                    job = std::move(m_jobs.front());
+                    m_jobs.pop_front();
+                    // The freed slot goes to the longest parked submission.
+                    if (auto* pending{ m_parked.popFront() }) {
+                        pending->linked = false;
+                        m_jobs.push_back(std::move(pending->job));
+                    }
+                }
+                job();
+            }
+        }
+
+        const size_t m_capacity;
+        std::mutex m_mutex{};
+        std::condition_variable m_notEmpty{};
+        std::deque<Job> m_jobs{};
+        utils::list::IntrusiveList<PendingJob> m_parked{};
+        bool m_running{ true };
+        std::vector<std::thread> m_threads{};
+    };
+
+    namespace detail
+    {
+        // Also the pool submission: the job it holds keeps it alive while parked.
+        template<typename T>
+        struct AsyncState : BlockingPool::PendingJob
+        {
+            std::conditional_t<std::is_void_v<T>, bool, std::optional<T>> result{};
+            std::exception_ptr exception{};
+            // Taken by whichever of the job and a stop request finishes first; only the taker resumes.
+            std::atomic<bool> claimed{ false };
+        };
+
+        template<typename T, typename F>
+        struct AsyncAwaiter
+        {
+            F func;
+            BlockingPool& pool;
+            std::shared_ptr<AsyncState<T>> state{ std::make_shared<AsyncState<T>>() };
+            std::coroutine_handle<> handle{};
+            ResumeTarget target{};
+            bool cancelled{ false };
+            StopRegistration<AsyncAwaiter> stop{};
+
+            auto await_ready() -> bool { return false; }
+
+            template<typename P>
+            auto await_suspend(std::coroutine_handle<P> awaiting) -> bool
+            {
+                handle = awaiting;
+                target = ResumeTarget::of(awaiting);
+                auto job{ [state = state, func = std::move(func), awaiting, target = target]() mutable {
+                    if (state->claimed.load(std::memory_order_acquire)) {
+                        return; // abandoned before it started
+                    }
+                    try {
+                        if constexpr (std::is_void_v<T>) {
+                            func();
+                        }
+                        else {
+                            state->result.emplace(func());
+                        }
+                    } catch (...) {
+                        state->exception = std::current_exception();
+                    }
+                    if (!state->claimed.exchange(true, std::memory_order_acq_rel)) {
+                        target.resume(awaiting);
+                    }
+                } };
+
+                auto& jobs{ pool };
+                const auto shared{ state };
+                if (!stop.arm(this, stopTokenOf(awaiting))) {
+                    cancelled = true;
+                    return false;
+                }
+                // A stop request may resume the coroutine from here on; only locals are touched until
+                // the state is claimed.
+                shared->job = std::move(job);
+                if (jobs.submit(*shared)) {
+                    return true;
+                }
+                shared->job = nullptr;
+                if (shared->claimed.exchange(true, std::memory_order_acq_rel)) {
+                    return true; // the stop request resumes it
+                }
+                cancelled = true;
+                return false;
+            }
+
+            auto await_resume() -> T
+            {
+                stop.disarm();
+                if (cancelled) {
+                    return abandoned<T>(std::errc::operation_canceled);
+                }
+                if (state->exception) {
+                    std::rethrow_exception(state->exception);
+                }
+                if constexpr (!std::is_void_v<T>) {
+                    return std::move(*state->result);
+                }
+            }
+
+            auto onStop() -> void
+            {
+                if (state->claimed.exchange(true, std::memory_order_acq_rel)) {
+                    return;
+                }
+                // A parked job gives its place back; a queued one sees the claim and returns at once.
+                pool.withdraw(*state);
+                cancelled = true;
+                auto resumeAt{ target };
+                resumeAt.resume(handle);
+            }
+        };
+    }
+}
\ No newline at end of file
@@ -0,0 +1,126 @@
+#pragma once
+
+#include "Common/Result.hpp"
+
+#include <atomic>
+#include <coroutine>
+#include <cstdint>
+#include <optional>
+#include <stop_token>
+#include <system_error>
+
+namespace core::coro
+{
+    namespace detail
+    {
+        // Stop token of the awaiting coroutine; empty for promise types that do not carry one.
+        template<typename P>
+        auto stopTokenOf(std::coroutine_handle<P> handle) -> std::stop_token
+        {
+            if constexpr (requires { handle.promise().stopToken; }) {
+                return handle.promise().stopToken;
+            }
+            else {
+                return {};
+            }
+        }
+
+        template<typename T>
+        inline constexpr bool IS_RESULT{ false };
+        template<typename T>
+        inline constexpr bool IS_RESULT<result::Result<T>>{ true };
+
+        // What an awaiter yields after giving up. Result types carry the error; anything else can only
+        // report it by throwing.
+        template<typename T>
+        auto abandoned(std::errc code) -> T
+        {
+            if constexpr (IS_RESULT<T>) {
+                return std::unexpected(std::make_error_code(code));
+            }
+            else {
+                throw std::system_error(std::make_error_code(code));
+            }
+        }
+
+        /**
+         * Stop callback owned by a suspending awaiter. arm() is called in await_suspend before the
+         * operation is started; a stop request that lands while await_suspend is still running only
+         * marks the registration and arm() reports it, so the coroutine is never resumed from inside
+         * its own await_suspend. Once armed, a stop request calls Awaiter::onStop() on the requesting
+         * thread. Destroying the registration waits for a callback running on another thread.
+         */
+        template<typename Awaiter>
+        class StopRegistration
+        {
+          public:
+            StopRegistration() = default;
+            // Awaiters are copied before they are first awaited; a registration is per instance and
+            // the copy starts out unarmed.
+            StopRegistration(const StopRegistration&) noexcept {}
+            auto operator=(const StopRegistration&) -> StopRegistration& = delete;
+
+            // Returns false if stop was requested before the awaiter could suspend.
+            auto arm(Awaiter* awaiter, std::stop_token token) -> bool
+            {
+                if (!token.stop_possible()) {
+                    return true;
+                }
+                if (token.stop_requested()) {
+                    m_phase.store(Phase::Stopped, std::memory_order_relaxed);
+                    return false;
+                }
+                m_callback.emplace(std::move(token), Invoke{ awaiter, this });
+                return m_phase.exchange(Phase::Armed, std::memory_order_acq_rel) != Phase::Stopped;
+            }
+
+            auto disarm() -> void { m_callback.reset(); }
+
+          private:
+            enum class Phase : uint8_t
+            {
+                Registering,
+                Armed,
+                Stopped
+            };
+
+            struct Invoke
+            {
+                Awaiter* awaiter;
+                StopRegistration* self;
+
+                auto operator()() const noexcept -> void
+                {
+                    if (self->m_phase.exchange(Phase::Stopped, std::memory_order_acq_rel) == Phase::Armed) {
+                        awaiter->onStop();
+                    }
+                }
+            };
+
+            std::atomic<Phase> m_phase{ Phase::Registering };
+            std::optional<std::stop_callback<Invoke>> m_callback{};
+        };
+
+        // Holds a pointer rather than the token itself so the awaiter stays trivially destructible.
+        struct StopTokenAwaiter
+        {
+            const std::stop_token* token{ nullptr };
+
+            auto await_ready() const -> bool { return false; }
+
+            template<typename P>
+            auto await_suspend(std::coroutine_handle<P> handle) -> bool
+            {
+                if constexpr (requires { handle.promise().stopToken; }) {
+                    token = &handle.promise().stopToken;
+                }
+                return false;
+            }
+
+            auto await_resume() const -> std::stop_token { return token ? *token : std::stop_token{}; }
+        };
+    }
+
+    // Stop token of the calling coroutine, without suspending it. Child tasks inherit it when awaited.
+    inline auto currentStopToken() -> detail::StopTokenAwaiter { return {}; }
+}
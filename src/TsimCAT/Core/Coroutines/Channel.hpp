@@ -1,19 +1,29 @@
 #pragma once
 
+#include "Cancellation.hpp"
 #include "Context.hpp"
 #include "Task.hpp"
 
-#include "Utils/memory_utils.hpp"
-#include "Utils/queue_utils.hpp"
+#include "Utils/intrusive_list.hpp"
 
+#include <algorithm>
+#include <array>
+#include <condition_variable>
+#include <cstdint>
+#include <limits>
 #include <list>
+#include <span>
 #include <vector>
 
 namespace core::coro
 {
     namespace detail
     {
+        template<typename Derived>
+        struct ChannelAwaiterBase;
         struct RawBinaryAwaiter;
+        template<typename T>
+        struct TypedAwaiter;
     }
 
     enum class ChannelMode
@@ -22,10 +32,213 @@ namespace core::coro
         LoadBalancer
     };
 
+    // What push() does when the channel already buffers `capacity` values and nobody is waiting.
+    enum class OverflowPolicy
+    {
+        Block,      // the producer thread waits until a consumer makes room
+        DropOldest, // the oldest buffered value is discarded
+        DropNewest, // the value being pushed is discarded
+        Conflate    // only the latest value is kept, regardless of capacity
+    };
+
+    // A bounded channel drops its oldest value unless told otherwise; blocking the producer's thread has
+    // to be asked for, since producers often push under their own locks or on a shared reactor.
+    struct ChannelOptions
+    {
+        static constexpr size_t UNBOUNDED{ std::numeric_limits<size_t>::max() };
+
+        size_t capacity{ UNBOUNDED };
+        OverflowPolicy overflow{ OverflowPolicy::DropOldest };
+    };
+
+    namespace detail
+    {
+        /**
+         * Buffer behind a channel for values that arrive while no consumer is waiting. Guarded by the
+         * owning channel's mutex. Values sit in a ring of slots that only ever grows, so a channel
+         * that has reached its working depth queues and dequeues without allocating.
+         */
+        template<typename T>
+        class BoundedQueue
+        {
+          public:
+            std::condition_variable notFull{};
+
+            auto limit() const -> size_t
+            {
+                if (m_options.overflow == OverflowPolicy::Conflate) {
+                    return 1;
+                }
+                return std::max<size_t>(m_options.capacity, 1);
+            }
+
+            auto empty() const -> bool { return m_size == 0; }
+            auto full() const -> bool { return m_size >= limit(); }
+            auto size() const -> size_t { return m_size; }
+
+            // Blocks a producer under OverflowPolicy::Block until there is room or `ready` holds.
+            template<typename Ready>
+            auto waitForRoom(std::unique_lock<std::mutex>& lock, Ready&& ready) -> void
+            {
+                if (m_options.overflow == OverflowPolicy::Block) {
+                    notFull.wait(lock, [&] { return !full() || ready(); });
+                }
+            }
+
+            // Returns false if the value was discarded.
+            auto offer(T value) -> bool
+            {
+                if (full()) {
+                    switch (m_options.overflow) {
+                        case OverflowPolicy::DropNewest:
+                            return false;
+                        case OverflowPolicy::DropOldest:
+                        case OverflowPolicy::Conflate:
+                            dropFront();
+                            break;
+                        case OverflowPolicy::Block:
+                            break;
+                    }
+                }
+
+                if (m_size == m_slots.size()) {
+                    grow();
+                }
+                m_slots[(m_head + m_size) % m_slots.size()].emplace(std::move(value));
+                ++m_size;
+                return true;
+            }
+
+            auto pop() -> std::optional<T>
+            {
+                if (m_size == 0) {
+                    return std::nullopt;
+                }
+                std::optional<T> value{ std::in_place, std::move(*m_slots[m_head]) };
+                dropFront();
+                if (m_options.overflow == OverflowPolicy::Block) {
+                    notFull.notify_one();
+                }
+                return value;
+            }
+
+            auto setOptions(ChannelOptions options) -> void
+            {
+                m_options = options;
+                while (m_size > limit()) {
+                    dropFront();
+                }
+                notFull.notify_all();
+            }
+
+            auto release() -> void { notFull.notify_all(); }
+
+          private:
+            auto dropFront() -> void
+            {
+                m_slots[m_head].reset();
+                m_head = (m_head + 1) % m_slots.size();
+                --m_size;
+            }
+
+            auto grow() -> void
+            {
+                std::vector<std::optional<T>> slots(std::max<size_t>(m_slots.size() * 2, 4));
+                for (size_t i = 0; i < m_size; ++i) {
+                    slots[i] = std::move(m_slots[(m_head + i) % m_slots.size()]);
+                }
+                m_slots = std::move(slots);
+                m_head = 0;
+            }
+
+            ChannelOptions m_options{};
+            std::vector<std::optional<T>> m_slots{};
+            size_t m_head{ 0 };
+            size_t m_size{ 0 };
+        };
+    }
+
+    namespace detail
+    {
+        using Bytes = std::vector<std::byte>;
+        using SharedBytes = std::shared_ptr<const Bytes>;
+
+        /**
+         * One value travelling through a RawBinaryChannel. Values up to INLINE_CAPACITY bytes (the
+         * PLC status and control structs) are stored in place; larger ones share a heap buffer.
+         */
+        class ChannelPayload
+        {
+          public:
+            static constexpr size_t INLINE_CAPACITY{ 16 };
+
+            static auto from(std::span<const std::byte> bytes) -> ChannelPayload
+            {
+                ChannelPayload payload{};
+                if (bytes.size() <= INLINE_CAPACITY) {
+                    std::ranges::copy(bytes, payload.m_inline.begin());
+                    payload.m_inlineSize = static_cast<uint8_t>(bytes.size());
+                }
+                else {
+                    payload.m_shared = std::make_shared<const Bytes>(bytes.begin(), bytes.end());
+                }
+                return payload;
+            }
+
+            static auto from(SharedBytes shared) -> ChannelPayload
+            {
+                ChannelPayload payload{};
+                payload.m_shared = std::move(shared);
+                return payload;
+            }
+
+            auto bytes() const -> std::span<const std::byte>
+            {
+                if (m_shared) {
+                    return *m_shared;
+                }
+                return std::span{ m_inline }.first(m_inlineSize);
+            }
+
+            // Raw consumers want a shared buffer; an inline value is promoted once and the buffer is
+            // then shared by every raw receiver of this payload.
+            auto share() -> const SharedBytes&
+            {
+                if (!m_shared) {
+                    m_shared = std::make_shared<const Bytes>(bytes().begin(), bytes().end());
+                }
+                return m_shared;
+            }
+
+          private:
+            std::array<std::byte, INLINE_CAPACITY> m_inline{};
+            uint8_t m_inlineSize{ 0 };
+            SharedBytes m_shared{};
+        };
+
+        // Intrusive list node embedded in every awaiter suspended on a RawBinaryChannel.
+        struct ChannelWaiter
+        {
+            using Deliver = void (*)(ChannelWaiter&, ChannelPayload&);
+
+            Deliver deliver{ nullptr };
+            std::coroutine_handle<> handle{};
+            ResumeTarget target{};
+            ChannelWaiter* prev{ nullptr };
+            ChannelWaiter* next{ nullptr };
+            bool linked{ false };    // guarded by the channel mutex
+            bool suspended{ false }; // only touched by the awaiting coroutine
+        };
+    }
+
     class RawBinaryChannel
     {
       public:
-        using Bytes = std::vector<std::byte>;
+        using Bytes = detail::Bytes;
+        // Immutable payload shared by every subscriber a value is broadcast to.
+        using SharedBytes = detail::SharedBytes;
+        // Values up to this size are pushed by copy without touching the heap.
+        static constexpr size_t INLINE_CAPACITY{ detail::ChannelPayload::INLINE_CAPACITY };
 
         auto setMode(ChannelMode mode) -> void
         {
@@ -33,34 +246,47 @@ namespace core::coro
             m_state->mode = mode;
         }
 
-        auto push(Bytes raw) -> void;
+        // Excess values already buffered are dropped oldest-first to fit the new capacity.
+        auto setOptions(ChannelOptions options) -> void
+        {
+            std::scoped_lock lock(m_state->mutex);
+            m_state->queue.setOptions(options);
+        }
+
+        // Small values are copied inline and never touch the heap; prefer this overload for process data.
+        auto push(std::span<const std::byte> raw) -> void { push(detail::ChannelPayload::from(raw)); }
+        auto push(Bytes&& raw) -> void;
+        auto push(SharedBytes raw) -> void { push(detail::ChannelPayload::from(std::move(raw))); }
         auto close() -> void;
 
-        auto next(std::optional<Bytes>& dest) -> detail::RawBinaryAwaiter;
+        auto next(std::optional<SharedBytes>& dest) -> detail::RawBinaryAwaiter;
 
-      protected:
-        struct Waiter
+        // Readers currently suspended on this channel, typed readers included; a snapshot for diagnostics.
+        auto waiterCount() const -> size_t
         {
-            std::coroutine_handle<> handle{};
-            IExecutor* executor{ nullptr };
-            // For broadcast, we need a place to put the result
-            std::optional<Bytes>* resultDest{ nullptr };
-            std::weak_ptr<void> lifeToken{};
-            detail::RawBinaryAwaiter* awaiterPtr{ nullptr };
-        };
+            std::scoped_lock lock(m_state->mutex);
+            return m_state->waiters.size();
+        }
 
+      protected:
         struct State
         {
             std::mutex mutex{};
-            std::deque<Bytes> queue{};
+            detail::BoundedQueue<detail::ChannelPayload> queue{};
             bool closed{ false };
-            std::list<Waiter> waiters{};
+            utils::list::IntrusiveList<detail::ChannelWaiter> waiters{};
             ChannelMode mode{ ChannelMode::Broadcast };
         };
 
+        auto push(detail::ChannelPayload payload) -> void;
+
         std::shared_ptr<State> m_state{ std::make_shared<State>() };
 
-        friend class detail::RawBinaryAwaiter;
+        template<typename Derived>
+        friend struct detail::ChannelAwaiterBase;
+        friend struct detail::RawBinaryAwaiter;
+        template<typename T>
+        friend struct detail::TypedAwaiter;
         template<typename T>
             requires std::is_trivially_copyable_v<T>
         friend class BinaryChannel;
@@ -85,21 +311,25 @@ namespace core::coro
             }
         }
 
-        auto next() -> Task<std::optional<T>>
+        auto setOptions(ChannelOptions options) -> void
         {
-            RawBinaryChannel raw{};
-            raw.m_state = m_state;
+            if (m_state) {
+                std::scoped_lock lock(m_state->mutex);
+                m_state->queue.setOptions(options);
+            }
+        }
 
-            std::optional<RawBinaryChannel::Bytes> result{};
-            co_await raw.next(result);
+        // Awaitable directly; decodes straight from the channel payload into T without a Task frame.
+        // Yields nullopt when the channel is closed or a value of the wrong size arrives.
+        auto next() -> detail::TypedAwaiter<T> { return detail::TypedAwaiter<T>{ m_state }; }
 
-            if (!result || result->size() != sizeof(T)) {
-                co_return std::nullopt;
+        auto waiterCount() const -> size_t
+        {
+            if (!m_state) {
+                return 0;
             }
-
-            T val{};
-            utils::memory::memcpy(val, result.value());
-            co_return val;
+            std::scoped_lock lock(m_state->mutex);
+            return m_state->waiters.size();
         }
 
       private:
@@ -113,89 +343,134 @@ namespace core::coro
         struct Waiter
         {
             std::coroutine_handle<> handle{};
-            IExecutor* executor{ nullptr };
+            detail::ResumeTarget target{};
             std::optional<T>* dest{ nullptr };
-            std::weak_ptr<void> lifeToken{};
+            bool* queued{ nullptr }; // cleared when the waiter is taken off the list
         };
 
         struct State
         {
             std::mutex mutex{};
-            std::deque<T> queue{};
+            detail::BoundedQueue<T> queue{};
             std::list<Waiter> waiters{};
             bool closed{ false };
         };
 
         struct Awaiter
         {
-            std::shared_ptr<State> state;
-            std::optional<T> result;
+            std::shared_ptr<State> state{};
+            std::optional<T> result{};
+            typename std::list<Waiter>::iterator position{};
+            bool queued{ false };    // guarded by the channel mutex
+            bool withdrawn{ false }; // guarded by the channel mutex
+            bool suspended{ false }; // only touched by the awaiting coroutine
+            detail::StopRegistration<Awaiter> stop{};
+
+            explicit Awaiter(std::shared_ptr<State> channelState)
+              : state{ std::move(channelState) }
+            {
+            }
+
+            // Neither a coroutine destroyed while waiting nor a stop request leaves a stale waiter.
+            ~Awaiter()
+            {
+                stop.disarm();
+                if (suspended) {
+                    std::scoped_lock lock(state->mutex);
+                    if (queued) {
+                        state->waiters.erase(position);
+                    }
+                }
+            }
 
             auto await_ready() -> bool
             {
                 std::scoped_lock lock(state->mutex);
-                if (!state->queue.empty()) {
-                    result = std::move(state->queue.front());
-                    state->queue.pop_front();
-                    return true;
-                }
-                return state->closed;
+                return takeQueuedLocked() || state->closed;
             }
 
             template<typename P>
             auto await_suspend(std::coroutine_handle<P> h) -> bool
             {
-                std::scoped_lock lock(state->mutex);
-                if (state->closed || !state->queue.empty()) {
+                if (!stop.arm(this, detail::stopTokenOf(h))) {
                     return false;
                 }
 
-                IExecutor* ex = nullptr;
-                std::weak_ptr<void> token;
-                if constexpr (requires { h.promise().executor; }) {
-                    ex = h.promise().executor;
-                    if (ex) {
-                        token = ex->getLifeToken();
-                    }
+                std::scoped_lock lock(state->mutex);
+                // A value may have arrived since await_ready.
+                if (withdrawn || takeQueuedLocked() || state->closed) {
+                    return false;
                 }
 
-                state->waiters.push_back({ h, ex, &result, token });
+                position = state->waiters.insert(state->waiters.end(),
+                                                 { h, detail::ResumeTarget::of(h), &result, &queued });
+                queued = true;
+                suspended = true;
                 return true;
             }
 
-            auto await_resume() -> std::optional<T> { return std::move(result); }
+            auto await_resume() -> std::optional<T>
+            {
+                stop.disarm();
+                return std::move(result);
+            }
+
+            auto onStop() -> void
+            {
+                std::unique_lock lock(state->mutex);
+                withdrawn = true;
+                if (!queued) {
+                    return;
+                }
+                auto waiter{ std::move(*position) };
+                state->waiters.erase(position);
+                queued = false;
+                lock.unlock();
+                resume(waiter);
+            }
+
+            auto takeQueuedLocked() -> bool
+            {
+                result = state->queue.pop();
+                return result.has_value();
+            }
         };
 
+        static auto resume(Waiter& waiter) -> void { waiter.target.resume(waiter.handle); }
+
       public:
+        Channel() = default;
+        explicit Channel(ChannelOptions options) { m_state->queue.setOptions(options); }
+
+        auto setOptions(ChannelOptions options) -> void
+        {
+            std::scoped_lock lock(m_state->mutex);
+            m_state->queue.setOptions(options);
+        }
+
         auto push(T val) -> void
         {
             std::unique_lock lock(m_state->mutex);
+            m_state->queue.waitForRoom(lock, [this] { return m_state->closed || !m_state->waiters.empty(); });
             if (m_state->closed) {
                 return;
             }
 
             if (m_state->waiters.empty()) {
-                m_state->queue.push_back(std::move(val));
+                m_state->queue.offer(std::move(val));
                 return;
             }
 
             auto waiter = std::move(m_state->waiters.front());
             m_state->waiters.pop_front();
+            *waiter.queued = false;
 
             if (waiter.dest) {
                 *waiter.dest = std::move(val);
             }
 
             lock.unlock();
-
-            if (waiter.executor) {
-                if (auto token = waiter.lifeToken.lock()) {
-                    waiter.executor->schedule(waiter.handle);
-                }
-            }
-            else {
-                waiter.handle.resume();
-            }
+            resume(waiter);
         }
 
         auto close() -> void
@@ -205,21 +480,25 @@ namespace core::coro
                 return;
             }
             m_state->closed = true;
+            m_state->queue.release();
             auto waiters = std::move(m_state->waiters);
+            for (auto& w : waiters) {
+                *w.queued = false;
+            }
             lock.unlock();
 
             for (auto& w : waiters) {
-                if (w.executor) {
-                    if (auto token = w.lifeToken.lock()) {
-                        w.executor->schedule(w.handle);
-                    }
-                }
-                else {
-                    w.handle.resume();
-                }
+                resume(w);
             }
         }
 
+        // Readers currently suspended in next(); a snapshot for diagnostics.
+        auto waiterCount() const -> size_t
+        {
+            std::scoped_lock lock(m_state->mutex);
+            return m_state->waiters.size();
+        }
+
         auto next() -> Task<std::optional<T>> { co_return co_await Awaiter{ m_state }; }
 
       private:
@@ -228,151 +507,213 @@ namespace core::coro
 
     namespace detail
     {
-        struct RawBinaryAwaiter
+        /**
+         * Shared suspend/resume logic for awaiters on a RawBinaryChannel. While suspended the awaiter
+         * itself is the node in the channel's waiter list, so waiting does not allocate. Derived
+         * supplies accept(ChannelPayload&) to take a value out of the channel. A stop request on the
+         * awaiting coroutine's token unlinks the awaiter and resumes it without a value.
+         */
+        template<typename Derived>
+        struct ChannelAwaiterBase : ChannelWaiter
         {
             std::shared_ptr<RawBinaryChannel::State> state{};
-            std::optional<RawBinaryChannel::Bytes>& dest;
-            std::optional<std::list<RawBinaryChannel::Waiter>::iterator> m_iterator{};
+            bool withdrawn{ false }; // guarded by the channel mutex
+            StopRegistration<ChannelAwaiterBase> stop{};
+
+            explicit ChannelAwaiterBase(std::shared_ptr<RawBinaryChannel::State> channelState)
+              : state{ std::move(channelState) }
+            {
+                deliver = [](ChannelWaiter& waiter, ChannelPayload& payload) {
+                    static_cast<Derived&>(waiter).accept(payload);
+                };
+            }
 
-            ~RawBinaryAwaiter()
+            // A coroutine destroyed while waiting must not leave a dangling node behind.
+            ~ChannelAwaiterBase()
             {
-                if (m_iterator) {
+                stop.disarm();
+                if (suspended) {
                     std::scoped_lock lock(state->mutex);
-                    if (m_iterator) {
-                        state->waiters.erase(*m_iterator);
+                    if (linked) {
+                        state->waiters.remove(this);
                     }
                 }
             }
 
-            void unlink() { m_iterator = std::nullopt; }
-
             auto await_ready() -> bool
             {
                 std::scoped_lock lock(state->mutex);
-                if (auto raw{ utils::queue::pop(state->queue) }) {
-                    dest.emplace(raw.value());
-                    return true;
-                }
-                return state->closed;
+                return takeQueuedLocked() || state->closed;
             }
 
             template<typename P>
-            auto await_suspend(std::coroutine_handle<P> handle) -> bool
+            auto await_suspend(std::coroutine_handle<P> awaiting) -> bool
             {
+                handle = awaiting;
+                target = ResumeTarget::of(awaiting);
+                if (!stop.arm(this, stopTokenOf(awaiting))) {
+                    return false;
+                }
+
                 std::scoped_lock lock(state->mutex);
 
-                if (state->closed || !state->queue.empty()) {
+                // A value may have arrived since await_ready.
+                if (withdrawn || takeQueuedLocked() || state->closed) {
                     return false;
                 }
 
-                IExecutor* executor{ nullptr };
-                std::weak_ptr<void> lifeToken;
+                suspended = true;
+                linked = true;
+                state->waiters.pushBack(this);
+                return true;
+            }
 
-                if constexpr (requires { handle.promise().executor; }) {
-                    executor = handle.promise().executor;
-                    if (executor) {
-                        lifeToken = executor->getLifeToken();
+            auto onStop() -> void
+            {
+                {
+                    std::scoped_lock lock(state->mutex);
+                    withdrawn = true;
+                    if (!linked) {
+                        return;
                     }
+                    state->waiters.remove(this);
+                    linked = false;
                 }
+                auto resumeAt{ target };
+                resumeAt.resume(handle);
+            }
 
-                m_iterator = state->waiters.insert(state->waiters.end(),
-                                                   { handle, executor, &dest, std::move(lifeToken), this });
-                return true;
+          private:
+            auto takeQueuedLocked() -> bool
+            {
+                auto payload{ state->queue.pop() };
+                if (payload) {
+                    static_cast<Derived*>(this)->accept(*payload);
+                }
+                return payload.has_value();
+            }
+        };
+
+        struct RawBinaryAwaiter : ChannelAwaiterBase<RawBinaryAwaiter>
+        {
+            std::optional<SharedBytes>& dest;
+
+            RawBinaryAwaiter(std::shared_ptr<RawBinaryChannel::State> channelState,
+                             std::optional<SharedBytes>& result)
+              : ChannelAwaiterBase{ std::move(channelState) }
+              , dest{ result }
+            {
             }
 
+            auto accept(ChannelPayload& payload) -> void { dest.emplace(payload.share()); }
+
             auto await_resume() -> void
             {
-                // Result is already in 'dest' or dest is nullopt (closed)
-                // If we resumed normally, 'unlink()' was already called by 'push'.
+                // Result is already in 'dest' or dest is nullopt (closed or stopped)
+                stop.disarm();
             }
         };
 
-        static auto resumeWaiter(auto& waiter) -> void
+        template<typename T>
+        struct TypedAwaiter : ChannelAwaiterBase<TypedAwaiter<T>>
         {
-            if (waiter.executor) {
-                if (auto token = waiter.lifeToken.lock()) {
-                    waiter.executor->schedule(waiter.handle);
+            std::optional<T> result{};
+
+            explicit TypedAwaiter(std::shared_ptr<RawBinaryChannel::State> channelState)
+              : ChannelAwaiterBase<TypedAwaiter<T>>{ std::move(channelState) }
+            {
+            }
+
+            auto accept(ChannelPayload& payload) -> void
+            {
+                const auto bytes{ payload.bytes() };
+                if (bytes.size() != sizeof(T)) {
+                    return;
                 }
+                T value{};
+                std::ranges::copy(bytes, std::as_writable_bytes(std::span{ &value, 1 }).begin());
+                result = value;
             }
-            else {
-                waiter.handle.resume();
+
+            auto await_resume() -> std::optional<T>
+            {
+                this->stop.disarm();
+                return result;
+            }
+        };
+
+        // Resumes a chain detached from the waiter list. Each node is read before its coroutine runs,
+        // since resuming may destroy the awaiter.
+        inline auto resumeWaiters(ChannelWaiter* waiter) -> void
+        {
+            while (waiter) {
+                auto* following{ waiter->next };
+                auto handle{ waiter->handle };
+                auto target{ std::move(waiter->target) };
+                target.resume(handle);
+                waiter = following;
             }
         }
     }
 
-    inline auto RawBinaryChannel::next(std::optional<Bytes>& dest) -> detail::RawBinaryAwaiter
+    inline auto RawBinaryChannel::next(std::optional<SharedBytes>& dest) -> detail::RawBinaryAwaiter
     {
         return detail::RawBinaryAwaiter{ m_state, dest };
     }
 
-    inline auto RawBinaryChannel::push(Bytes raw) -> void
+    inline auto RawBinaryChannel::push(Bytes&& raw) -> void
+    {
+        if (raw.size() <= detail::ChannelPayload::INLINE_CAPACITY) {
+            push(detail::ChannelPayload::from(std::span<const std::byte>{ raw }));
+        }
+        else {
+            push(detail::ChannelPayload::from(std::make_shared<const Bytes>(std::move(raw))));
+        }
+    }
+
+    inline auto RawBinaryChannel::push(detail::ChannelPayload payload) -> void
     {
         std::unique_lock lock(m_state->mutex);
+        m_state->queue.waitForRoom(lock, [this] { return m_state->closed || !m_state->waiters.empty(); });
         if (m_state->closed) {
             return;
         }
 
         if (m_state->waiters.empty()) {
             // store until new waiter spawns
-            m_state->queue.push_back(std::move(raw));
+            m_state->queue.offer(std::move(payload));
             return;
         }
 
-        if (m_state->mode == ChannelMode::LoadBalancer) {
-            auto waiter{ std::move(m_state->waiters.front()) };
-            m_state->waiters.pop_front();
-
-            // detach from awaiter so it doesnt try to erase itself on destruction
-            if (waiter.awaiterPtr) {
-                waiter.awaiterPtr->unlink();
-            }
-
-            if (waiter.resultDest) {
-                waiter.resultDest->emplace(std::move(raw));
-            }
-
-            lock.unlock();
-            detail::resumeWaiter(waiter);
+        // Load balancing hands the value to the longest waiter, broadcast to all of them. Either way
+        // every raw receiver gets a reference to the same buffer.
+        auto* toResume{ m_state->mode == ChannelMode::LoadBalancer ? m_state->waiters.popFront()
+                                                                   : m_state->waiters.takeAll() };
+        for (auto* waiter{ toResume }; waiter; waiter = waiter->next) {
+            waiter->linked = false;
+            waiter->deliver(*waiter, payload);
         }
-        else {
-            auto toResume{ std::move(m_state->waiters) };
-            m_state->waiters.clear();
-
-            for (auto& waiter : toResume) {
-                // detach from awaiter so it doesnt try to erase itself on destruction
-                if (waiter.awaiterPtr) {
-                    waiter.awaiterPtr->unlink();
-                }
-
-                if (waiter.resultDest) {
-                    waiter.resultDest->emplace(raw);
-                }
-            }
 
-            lock.unlock();
-            for (auto& waiter : toResume) {
-                detail::resumeWaiter(waiter);
-            }
-        }
+        lock.unlock();
+        detail::resumeWaiters(toResume);
     }
 
     inline auto RawBinaryChannel::close() -> void
     {
-        std::list<Waiter> toResume;
+        detail::ChannelWaiter* toResume{ nullptr };
         {
             std::scoped_lock lock(m_state->mutex);
             if (m_state->closed) {
                 return;
             }
             m_state->closed = true;
-            toResume = std::move(m_state->waiters);
-        }
-
-        for (auto& waiter : toResume) {
-            if (waiter.awaiterPtr) {
-                waiter.awaiterPtr->unlink();
+            m_state->queue.release();
+            toResume = m_state->waiters.takeAll();
+            for (auto* waiter{ toResume }; waiter; waiter = waiter->next) {
+                waiter->linked = false;
             }
-            detail::resumeWaiter(waiter);
         }
+
+        detail::resumeWaiters(toResume);
     }
-}
\ No newline at end of file
+}
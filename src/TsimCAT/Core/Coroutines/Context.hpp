@@ -1,10 +1,20 @@
 #pragma once
 
+#include "ExecutorStats.hpp"
+#include "Priority.hpp"
+#include "Timer.hpp"
+
+#include "Utils/cpu_utils.hpp"
+#include "Utils/mpmc_queue.hpp"
 #include "Utils/queue_utils.hpp"
 
+#include <array>
+#include <atomic>
 #include <condition_variable>
 #include <coroutine>
 #include <deque>
+#include <limits>
+#include <thread>
 
 namespace core::coro
 {
@@ -15,16 +25,215 @@ namespace core::coro
         virtual auto run() -> void = 0;
         virtual auto stop() -> void = 0;
         virtual auto schedule(std::coroutine_handle<> handle) -> void = 0;
+        // Executors without priority lanes treat every class alike.
+        virtual auto schedule(std::coroutine_handle<> handle, Priority) -> void { schedule(handle); }
         virtual auto getLifeToken() -> std::weak_ptr<void> = 0;
+
+        // Resumes the handle on this executor once the deadline has passed. The default routes
+        // through the shared TimerService; executors with their own run loop override both.
+        virtual auto scheduleAt(Clock::time_point deadline,
+                                std::coroutine_handle<> handle,
+                                Priority priority = Priority::Normal) -> TimerId;
+        virtual auto cancelTimer(TimerId id) -> bool;
+
+        // Snapshot of the run loop's counters; executors without instrumentation report all zeros.
+        virtual auto stats() const -> ExecutorStats { return { .takenAt = Clock::now() }; }
     };
 
     template<typename T>
     concept Executor = std::is_base_of_v<IExecutor, T>;
 
+    namespace detail
+    {
+        // Scheduling class of the awaiting coroutine; Normal for promise types that do not carry one.
+        template<typename P>
+        auto priorityOf(std::coroutine_handle<P> handle) -> Priority
+        {
+            if constexpr (requires { handle.promise().priority; }) {
+                return handle.promise().priority.value_or(Priority::Normal);
+            }
+            else {
+                return Priority::Normal;
+            }
+        }
+
+        // Where a suspended coroutine continues: on its executor while that is alive, inline otherwise.
+        struct ResumeTarget
+        {
+            IExecutor* executor{ nullptr };
+            std::weak_ptr<void> lifeToken{};
+            Priority priority{ Priority::Normal };
+
+            template<typename P>
+            static auto of(std::coroutine_handle<P> handle) -> ResumeTarget
+            {
+                ResumeTarget target{ .priority = priorityOf(handle) };
+                if constexpr (requires { handle.promise().executor; }) {
+                    target.executor = handle.promise().executor;
+                    if (target.executor) {
+                        target.lifeToken = target.executor->getLifeToken();
+                    }
+                }
+                return target;
+            }
+
+            auto resume(std::coroutine_handle<> handle) const -> void
+            {
+                if (executor) {
+                    if (auto token = lifeToken.lock()) {
+                        executor->schedule(handle, priority);
+                    }
+                }
+                else {
+                    handle.resume();
+                }
+            }
+        };
+    }
+
+    /**
+     * Process-wide timer thread for coroutines that are not bound to an executor, and for executors
+     * without a timer of their own. Expired handles are scheduled on their executor, or resumed on
+     * the timer thread if they have none. Callback timers run on the timer thread and must be short.
+     */
+    class TimerService
+    {
+      public:
+        static auto instance() -> TimerService&
+        {
+            static TimerService s_instance;
+            return s_instance;
+        }
+
+        ~TimerService()
+        {
+            {
+                std::scoped_lock lock(m_mutex);
+                m_running = false;
+            }
+            m_cv.notify_all();
+            if (m_thread.joinable()) {
+                m_thread.join();
+            }
+        }
+
+        TimerService(const TimerService&) = delete;
+        TimerService& operator=(const TimerService&) = delete;
+
+        auto add(Clock::time_point deadline,
+                 std::coroutine_handle<> handle,
+                 IExecutor* executor = nullptr,
+                 std::weak_ptr<void> lifeToken = {},
+                 Priority priority = Priority::Normal) -> TimerId
+        {
+            TimerId id{};
+            {
+                std::scoped_lock lock(m_mutex);
+                if (!m_thread.joinable()) {
+                    m_thread = std::thread([this] { loop(); });
+                }
+                id = m_timers.add(deadline, handle, executor, std::move(lifeToken), priority);
+            }
+            m_cv.notify_one();
+            return id;
+        }
+
+        auto addCallback(Clock::time_point deadline, std::function<void()> callback) -> TimerId
+        {
+            TimerId id{};
+            {
+                std::scoped_lock lock(m_mutex);
+                if (!m_thread.joinable()) {
+                    m_thread = std::thread([this] { loop(); });
+                }
+                id = m_timers.addCallback(deadline, std::move(callback));
+            }
+            m_cv.notify_one();
+            return id;
+        }
+
+        // Returns false if the timer already fired or is firing right now.
+        auto cancel(TimerId id) -> bool
+        {
+            std::scoped_lock lock(m_mutex);
+            return m_timers.cancel(id);
+        }
+
+      private:
+        TimerService() = default;
+
+        auto loop() -> void
+        {
+            std::unique_lock lock(m_mutex);
+            while (m_running) {
+                if (auto next{ m_timers.nextDeadline() }) {
+                    m_cv.wait_until(lock, *next);
+                }
+                else {
+                    m_cv.wait(lock);
+                }
+
+                while (auto entry{ m_timers.popExpired(Clock::now()) }) {
+                    lock.unlock();
+                    fire(*entry);
+                    lock.lock();
+                }
+            }
+        }
+
+        static auto fire(detail::TimerEntry& entry) -> void
+        {
+            if (entry.callback) {
+                entry.callback();
+                return;
+            }
+            detail::ResumeTarget target{ entry.executor, std::move(entry.lifeToken), entry.priority };
+            target.resume(entry.handle);
+        }
+
+        std::mutex m_mutex{};
+        std::condition_variable m_cv{};
+        detail::TimerQueue m_timers{};
+        bool m_running{ true };
+        std::thread m_thread{};
+    };
+
+    inline auto IExecutor::scheduleAt(Clock::time_point deadline,
+                                      std::coroutine_handle<> handle,
+                                      Priority priority) -> TimerId
+    {
+        return TimerService::instance().add(deadline, handle, this, getLifeToken(), priority);
+    }
+
+    inline auto IExecutor::cancelTimer(TimerId id) -> bool
+    {
+        return TimerService::instance().cancel(id);
+    }
+
+    /**
+     * Single-threaded executor. Ready handles go through a lock-free ring so producers on driver
+     * threads (ADS notifications, asio) never take a lock; only the timer heap and parking use the
+     * mutex. When the ring runs dry the run loop spins briefly before parking, and adapts the spin
+     * budget to whether spinning recently paid off.
+     *
+     * Each Priority class has its own ring. The run loop always takes from the highest non-empty
+     * class, so cyclic I/O is never queued behind background work; timers keep the priority of the
+     * coroutine that armed them. Plain schedule(handle) counts as Normal.
+     *
+     * Resumes and queue depth are always counted. setInstrumented(true) additionally timestamps every
+     * handle when it is scheduled (timer wake-ups use their deadline, so lateness is included) and
+     * times every resume; see stats().
+     */
     class Context : public IExecutor
     {
       public:
-        Context() = default;
+        static constexpr size_t DEFAULT_QUEUE_CAPACITY{ 1024 };
+
+        explicit Context(size_t queueCapacity = DEFAULT_QUEUE_CAPACITY)
+          : m_lanes{ { Lane{ queueCapacity }, Lane{ queueCapacity }, Lane{ queueCapacity } } }
+        {
+        }
+
         ~Context() = default;
         Context(const Context&) = delete;
         Context& operator=(const Context&) = delete;
@@ -33,43 +242,300 @@ namespace core::coro
 
         auto run() -> void override
         {
+            s_current = this;
+            auto spinBudget{ MIN_SPIN };
             while (true) {
-                std::unique_lock lock(m_mutex);
-                m_cv.wait(lock, [this] { return !m_queue.empty() || !m_running; });
+                collectExpiredTimers();
 
-                if (!m_running && m_queue.empty()) {
-                    break;
+                if (auto entry{ popReady() }) {
+                    resume(*entry);
+                    continue;
                 }
 
-                while (auto handle{ utils::queue::pop(m_queue) }) {
-                    lock.unlock();
-                    if (handle && !handle->done()) {
-                        handle->resume();
-                    }
-                    lock.lock();
+                if (spinForWork(spinBudget)) {
+                    spinBudget = std::min(spinBudget * 2, MAX_SPIN);
+                    continue;
+                }
+                spinBudget = std::max(spinBudget / 2, MIN_SPIN);
+
+                if (!m_running && !hasReady()) {
+                    break;
                 }
+                park();
             }
+            s_current = nullptr;
         }
 
         auto stop() -> void override
         {
-            m_running = false;
+            {
+                std::scoped_lock lock(m_mutex);
+                m_running = false;
+            }
             m_cv.notify_all();
         }
 
-        auto schedule(std::coroutine_handle<> handle) -> void override
+        auto schedule(std::coroutine_handle<> handle) -> void override { schedule(handle, Priority::Normal); }
+
+        auto schedule(std::coroutine_handle<> handle, Priority priority) -> void override
         {
-            utils::queue::push(m_queue, handle, m_mutex);
+            enqueue({ handle, instrumented() ? Clock::now().time_since_epoch().count() : 0 }, priority);
+            // The run loop cannot be parked while it is the one scheduling.
+            if (s_current != this) {
+                wake();
+            }
+        }
+
+        auto scheduleAt(Clock::time_point deadline,
+                        std::coroutine_handle<> handle,
+                        Priority priority = Priority::Normal) -> TimerId override
+        {
+            TimerId id{};
+            {
+                std::scoped_lock lock(m_mutex);
+                id = m_timers.add(deadline, handle, nullptr, {}, priority);
+                m_notified = true;
+                publishNextDeadlineLocked();
+            }
+            // The run loop may be parked with a later deadline; let it recompute.
             m_cv.notify_one();
+            return id;
+        }
+
+        auto cancelTimer(TimerId id) -> bool override
+        {
+            std::scoped_lock lock(m_mutex);
+            const auto cancelled{ m_timers.cancel(id) };
+            publishNextDeadlineLocked();
+            return cancelled;
         }
 
         auto getLifeToken() -> std::weak_ptr<void> override { return m_lifeToken; }
 
+        auto stats() const -> ExecutorStats override
+        {
+            ExecutorStats stats{ .instrumented = instrumented(), .takenAt = Clock::now() };
+            stats.readyDepth = readyDepth();
+            m_counters.fill(stats);
+            return stats;
+        }
+
+        // May be toggled while running; handles scheduled before it was turned on report no latency.
+        auto setInstrumented(bool enabled) -> void
+        {
+            m_instrumented.store(enabled, std::memory_order_relaxed);
+        }
+
       private:
+        static constexpr uint32_t MIN_SPIN{ 64 };
+        static constexpr uint32_t MAX_SPIN{ 4096 };
+        static constexpr Clock::rep NO_DEADLINE{ std::numeric_limits<Clock::rep>::max() };
+
+        // A queued handle and, while instrumented, when it became ready (0 otherwise).
+        struct ReadyEntry
+        {
+            std::coroutine_handle<> handle{};
+            Clock::rep readyAt{ 0 };
+        };
+
+        // Ready handles of one priority class. A full ring spills into a locked deque rather than
+        // dropping or blocking the producer. Until the deque has drained again later handles queue
+        // behind it too, so handles keep their order and spilled ones cannot be overtaken for good.
+        struct Lane
+        {
+            explicit Lane(size_t capacity) : queue{ capacity } {}
+
+            utils::queue::MpmcQueue<ReadyEntry> queue;
+            std::mutex overflowMutex{};
+            std::deque<ReadyEntry> overflow{};
+            std::atomic<size_t> overflowSize{ 0 };
+
+            auto hasReady() const -> bool
+            {
+                return !queue.empty() || overflowSize.load(std::memory_order_acquire) > 0;
+            }
+
+            auto depth() const -> size_t
+            {
+                return queue.sizeApprox() + overflowSize.load(std::memory_order_relaxed);
+            }
+
+            auto push(ReadyEntry entry) -> void
+            {
+                if (overflowSize.load(std::memory_order_acquire) > 0 || !queue.tryPush(entry)) {
+                    std::scoped_lock lock(overflowMutex);
+                    overflow.push_back(entry);
+                    overflowSize.fetch_add(1, std::memory_order_release);
+                }
+            }
+
+            auto pop() -> std::optional<ReadyEntry>
+            {
+                if (auto entry{ queue.tryPop() }) {
+                    return entry;
+                }
+                if (overflowSize.load(std::memory_order_acquire) == 0) {
+                    return std::nullopt;
+                }
+                std::scoped_lock lock(overflowMutex);
+                auto entry{ utils::queue::pop(overflow) };
+                if (entry) {
+                    overflowSize.fetch_sub(1, std::memory_order_release);
+                }
+                return entry;
+            }
+        };
+
+        auto instrumented() const -> bool { return m_instrumented.load(std::memory_order_relaxed); }
+
+        auto readyDepth() const -> size_t
+        {
+            size_t depth{ 0 };
+            for (const auto& lane : m_lanes) {
+                depth += lane.depth();
+            }
+            return depth;
+        }
+
+        auto resume(const ReadyEntry& entry) -> void
+        {
+            if (!entry.handle || entry.handle.done()) {
+                return;
+            }
+            m_counters.countResume();
+            if (!instrumented()) {
+                entry.handle.resume();
+                return;
+            }
+
+            const auto start{ Clock::now() };
+            if (entry.readyAt != 0) {
+                m_counters.recordLatency(start - Clock::time_point{ Clock::duration{ entry.readyAt } });
+            }
+            m_counters.recordDepth(readyDepth() + 1);
+            entry.handle.resume();
+            m_counters.recordResume(Clock::now() - start);
+        }
+
+        auto hasReady() const -> bool
+        {
+            return std::ranges::any_of(m_lanes, [](const Lane& lane) { return lane.hasReady(); });
+        }
+
+        auto enqueue(ReadyEntry entry, Priority priority) -> void
+        {
+            m_lanes[static_cast<size_t>(priority)].push(entry);
+        }
+
+        // Highest class first; each lane is checked again on every pop, so a cyclic handle scheduled
+        // while background work is queued goes next.
+        auto popReady() -> std::optional<ReadyEntry>
+        {
+            for (auto& lane : m_lanes) {
+                if (auto entry{ lane.pop() }) {
+                    return entry;
+                }
+            }
+            return std::nullopt;
+        }
+
+        auto spinForWork(uint32_t budget) -> bool
+        {
+            // Spinning on a single core only delays the producer we are waiting for.
+            static const bool s_canSpin{ std::thread::hardware_concurrency() > 1 };
+            if (!s_canSpin) {
+                return hasReady();
+            }
+            for (uint32_t i = 0; i < budget; ++i) {
+                if (hasReady()) {
+                    return true;
+                }
+                utils::cpu::relax();
+            }
+            return false;
+        }
+
+        auto collectExpiredTimers() -> void
+        {
+            const auto next{ m_nextDeadline.load(std::memory_order_acquire) };
+            if (next == NO_DEADLINE) {
+                return;
+            }
+            const auto now{ Clock::now() };
+            if (now.time_since_epoch().count() < next) {
+                return;
+            }
+
+            std::scoped_lock lock(m_mutex);
+            const auto stamp{ instrumented() };
+            while (auto entry{ m_timers.popExpired(now) }) {
+                enqueue({ entry->handle, stamp ? entry->deadline.time_since_epoch().count() : 0 },
+                        entry->priority);
+            }
+            publishNextDeadlineLocked();
+        }
+
+        // Lets the run loop test for due timers without taking the mutex on every resume.
+        auto publishNextDeadlineLocked() -> void
+        {
+            auto next{ m_timers.nextDeadline() };
+            m_nextDeadline.store(next ? next->time_since_epoch().count() : NO_DEADLINE,
+                                 std::memory_order_release);
+        }
+
+        // Producers only touch the mutex when the run loop has announced that it is about to sleep.
+        // Both sides publish with seq_cst before checking the other's state, so either the producer
+        // sees m_parked or the run loop sees the new handle.
+        auto wake() -> void
+        {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (m_parked.load(std::memory_order_relaxed)) {
+                {
+                    std::scoped_lock lock(m_mutex);
+                    m_notified = true;
+                }
+                m_cv.notify_one();
+            }
+        }
+
+        auto park() -> void
+        {
+            std::unique_lock lock(m_mutex);
+            m_parked.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            auto ready = [this] { return m_notified || hasReady() || !m_running || timerExpiredLocked(); };
+            if (auto next{ m_timers.nextDeadline() }) {
+                m_cv.wait_until(lock, *next, ready);
+            }
+            else {
+                m_cv.wait(lock, ready);
+            }
+
+            m_notified = false;
+            m_parked.store(false, std::memory_order_relaxed);
+        }
+
+        auto timerExpiredLocked() const -> bool
+        {
+            auto next{ m_timers.nextDeadline() };
+            return next && *next <= Clock::now();
+        }
+
+        static inline thread_local Context* s_current{ nullptr };
+
+        std::array<Lane, PRIORITY_COUNT> m_lanes;
+
         std::atomic<bool> m_running{ true };
+        std::atomic<bool> m_parked{ false };
         std::mutex m_mutex{};
         std::condition_variable m_cv{};
-        std::deque<std::coroutine_handle<>> m_queue{};
+        bool m_notified{ false };
+        detail::TimerQueue m_timers{};
+        std::atomic<Clock::rep> m_nextDeadline{ NO_DEADLINE };
         std::shared_ptr<bool> m_lifeToken{ std::make_shared<bool>(true) };
+
+        std::atomic<bool> m_instrumented{ false };
+        detail::ExecutorCounters m_counters{};
     };
-}
\ No newline at end of file
+}
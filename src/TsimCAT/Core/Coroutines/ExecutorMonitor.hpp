@@ -0,0 +1,85 @@
+#pragma once
+
+#include "Context.hpp"
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+namespace core::coro
+{
+    /**
+     * Samples an executor's stats() at a fixed interval and hands each snapshot, together with the
+     * previous one, to a sink running on the TimerService thread. The sink should only format and
+     * forward (e.g. to TraceLogger); it must not block. The executor has to outlive the monitor.
+     */
+    class ExecutorMonitor
+    {
+      public:
+        using Sink = std::function<void(const ExecutorStats& current, const ExecutorStats& previous)>;
+
+        ExecutorMonitor(IExecutor& executor, std::chrono::milliseconds interval, Sink sink)
+          : m_state{ std::make_shared<State>(executor, interval, std::move(sink)) }
+        {
+            std::scoped_lock lock(m_state->mutex);
+            m_state->previous = executor.stats();
+            State::arm(m_state);
+        }
+
+        // Waits for a sample in progress; no sink call starts afterwards.
+        ~ExecutorMonitor()
+        {
+            std::scoped_lock lock(m_state->mutex);
+            m_state->active = false;
+            TimerService::instance().cancel(m_state->timer);
+        }
+
+        ExecutorMonitor(const ExecutorMonitor&) = delete;
+        auto operator=(const ExecutorMonitor&) -> ExecutorMonitor& = delete;
+
+      private:
+        struct State
+        {
+            State(IExecutor& executor, std::chrono::milliseconds interval, Sink sink)
+              : executor{ executor }
+              , interval{ interval }
+              , sink{ std::move(sink) }
+            {
+            }
+
+            IExecutor& executor;
+            std::chrono::milliseconds interval;
+            Sink sink;
+            std::mutex mutex{};
+            bool active{ true };
+            TimerId timer{ 0 };
+            ExecutorStats previous{};
+
+            // Called with the mutex held.
+            static auto arm(const std::shared_ptr<State>& state) -> void
+            {
+                state->timer = TimerService::instance().addCallback(
+                  Clock::now() + state->interval, [weak = std::weak_ptr{ state }] {
+                      if (auto self{ weak.lock() }) {
+                          sample(self);
+                      }
+                  });
+            }
+
+            static auto sample(const std::shared_ptr<State>& state) -> void
+            {
+                std::scoped_lock lock(state->mutex);
+                if (!state->active) {
+                    return;
+                }
+                auto current{ state->executor.stats() };
+                state->sink(current, state->previous);
+                state->previous = current;
+                arm(state);
+            }
+        };
+
+        std::shared_ptr<State> m_state;
+    };
+}
@@ -0,0 +1,166 @@
+#pragma once
+
+#include "Timer.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace core::coro
+{
+    /**
+     * Power-of-two histogram of durations: bucket i counts samples in [2^i, 2^(i+1)) ns, bucket 0 also
+     * takes zero and the last bucket everything above ~1 s. Counts only grow, so the samples taken
+     * between two snapshots are `later.since(earlier)`.
+     */
+    struct LatencyHistogram
+    {
+        static constexpr size_t BUCKETS{ 31 };
+
+        std::array<uint64_t, BUCKETS> counts{};
+
+        static auto bucketOf(std::chrono::nanoseconds duration) -> size_t
+        {
+            const auto ns{ static_cast<uint64_t>(std::max<int64_t>(duration.count(), 1)) };
+            return std::min<size_t>(std::bit_width(ns) - 1, BUCKETS - 1);
+        }
+
+        // Upper bound of the bucket, i.e. the value reported for its samples.
+        static auto bucketLimit(size_t bucket) -> std::chrono::nanoseconds
+        {
+            return std::chrono::nanoseconds{ (int64_t{ 1 } << (bucket + 1)) - 1 };
+        }
+
+        auto total() const -> uint64_t
+        {
+            uint64_t sum{ 0 };
+            for (const auto count : counts) {
+                sum += count;
+            }
+            return sum;
+        }
+
+        // `fraction` in [0, 1]; zero when the histogram is empty.
+        auto percentile(double fraction) const -> std::chrono::nanoseconds
+        {
+            const auto samples{ total() };
+            if (samples == 0) {
+                return std::chrono::nanoseconds::zero();
+            }
+            const auto rank{ std::max<uint64_t>(
+              1, static_cast<uint64_t>(fraction * static_cast<double>(samples))) };
+            uint64_t seen{ 0 };
+            for (size_t i{ 0 }; i < BUCKETS; ++i) {
+                seen += counts[i];
+                if (seen >= rank) {
+                    return bucketLimit(i);
+                }
+            }
+            return bucketLimit(BUCKETS - 1);
+        }
+
+        auto max() const -> std::chrono::nanoseconds
+        {
+            for (size_t i{ BUCKETS }; i > 0; --i) {
+                if (counts[i - 1] != 0) {
+                    return bucketLimit(i - 1);
+                }
+            }
+            return std::chrono::nanoseconds::zero();
+        }
+
+        auto since(const LatencyHistogram& earlier) const -> LatencyHistogram
+        {
+            LatencyHistogram delta{};
+            for (size_t i{ 0 }; i < BUCKETS; ++i) {
+                delta.counts[i] = counts[i] - earlier.counts[i];
+            }
+            return delta;
+        }
+    };
+
+    /**
+     * Snapshot of an executor's run loop. Counters are cumulative since the executor was created;
+     * compare two snapshots for rates. Latencies and resume durations are only recorded while the
+     * executor is instrumented, which costs a few clock reads per resume.
+     */
+    struct ExecutorStats
+    {
+        bool instrumented{ false };
+        Clock::time_point takenAt{};
+        uint64_t resumes{ 0 };
+        size_t readyDepth{ 0 };     // handles waiting to be resumed when the snapshot was taken
+        size_t peakReadyDepth{ 0 }; // highest depth seen by the run loop while instrumented
+        std::chrono::nanoseconds longestResume{ 0 };
+        LatencyHistogram scheduleLatency{}; // schedule (or timer deadline) to resume
+        LatencyHistogram resumeDuration{};  // time spent inside a single resume
+    };
+
+    inline auto resumesPerSecond(const ExecutorStats& earlier, const ExecutorStats& later) -> double
+    {
+        const auto elapsed{ std::chrono::duration<double>(later.takenAt - earlier.takenAt).count() };
+        if (elapsed <= 0.0) {
+            return 0.0;
+        }
+        return static_cast<double>(later.resumes - earlier.resumes) / elapsed;
+    }
+
+    namespace detail
+    {
+        // Counters written by the run loop only and read by stats() from any thread.
+        class ExecutorCounters
+        {
+          public:
+            auto countResume() -> void { bump(m_resumes); }
+
+            auto recordLatency(std::chrono::nanoseconds latency) -> void
+            {
+                bump(m_scheduleLatency[LatencyHistogram::bucketOf(latency)]);
+            }
+
+            auto recordResume(std::chrono::nanoseconds duration) -> void
+            {
+                bump(m_resumeDuration[LatencyHistogram::bucketOf(duration)]);
+                if (duration.count() > m_longestResume.load(std::memory_order_relaxed)) {
+                    m_longestResume.store(duration.count(), std::memory_order_relaxed);
+                }
+            }
+
+            auto recordDepth(size_t depth) -> void
+            {
+                if (depth > m_peakDepth.load(std::memory_order_relaxed)) {
+                    m_peakDepth.store(depth, std::memory_order_relaxed);
+                }
+            }
+
+            auto fill(ExecutorStats& stats) const -> void
+            {
+                stats.resumes = m_resumes.load(std::memory_order_relaxed);
+                stats.peakReadyDepth = m_peakDepth.load(std::memory_order_relaxed);
+                stats.longestResume =
+                  std::chrono::nanoseconds{ m_longestResume.load(std::memory_order_relaxed) };
+                for (size_t i{ 0 }; i < LatencyHistogram::BUCKETS; ++i) {
+                    stats.scheduleLatency.counts[i] = m_scheduleLatency[i].load(std::memory_order_relaxed);
+                    stats.resumeDuration.counts[i] = m_resumeDuration[i].load(std::memory_order_relaxed);
+                }
+            }
+
+          private:
+            // Single writer, so a plain load/store pair is enough and avoids a locked RMW per resume.
+            static auto bump(std::atomic<uint64_t>& counter) -> void
+            {
+                counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            }
+
+            std::atomic<uint64_t> m_resumes{ 0 };
+            std::atomic<size_t> m_peakDepth{ 0 };
+            std::atomic<int64_t> m_longestResume{ 0 };
+            std::array<std::atomic<uint64_t>, LatencyHistogram::BUCKETS> m_scheduleLatency{};
+            std::array<std::atomic<uint64_t>, LatencyHistogram::BUCKETS> m_resumeDuration{};
+        };
+    }
+}
@@ -0,0 +1,217 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace core::coro
+{
+    struct FrameAllocatorStats
+    {
+        uint64_t allocations{ 0 };     // frames handed out, pooled or not
+        uint64_t heapAllocations{ 0 }; // frames that had to come from ::operator new
+        uint64_t remoteFrees{ 0 };     // frames returned by a thread other than the allocating one
+    };
+
+    /**
+     * Size-class pool for coroutine frames.
+     *
+     * Each thread owns a cache with one free list per size class. Frames freed on the allocating
+     * thread go straight back onto its local list; frames freed elsewhere (a task started on one
+     * executor and finished on another) are pushed onto the owner's lock-free remote list, which the
+     * owner drains the next time its local list runs dry. Caches of exited threads are kept and handed
+     * to the next new thread, so outstanding frames always have a valid owner.
+     *
+     * Frames larger than MAX_POOLED_SIZE bypass the pool. Free lists are never trimmed; they settle at
+     * the peak number of frames alive at once.
+     */
+    class FrameAllocator
+    {
+      public:
+        static constexpr size_t GRANULARITY{ 64 };
+        static constexpr size_t MAX_POOLED_SIZE{ 2048 };
+
+        static auto allocate(size_t size) -> void*
+        {
+            auto* cache{ ThreadCache::current() };
+            const auto total{ size + HEADER_SIZE };
+            if (!cache) {
+                return initHeader(::operator new(total), nullptr, 0);
+            }
+
+            bump(cache->allocations);
+            if (total > MAX_POOLED_SIZE) {
+                bump(cache->heapAllocations);
+                return initHeader(::operator new(total), nullptr, 0);
+            }
+
+            const auto sizeClass{ (total - 1) / GRANULARITY };
+            auto* node{ cache->local[sizeClass] };
+            if (!node) {
+                node = cache->remote[sizeClass].exchange(nullptr, std::memory_order_acquire);
+            }
+            if (node) {
+                cache->local[sizeClass] = node->next;
+                return initHeader(node, cache, sizeClass);
+            }
+
+            bump(cache->heapAllocations);
+            return initHeader(::operator new((sizeClass + 1) * GRANULARITY), cache, sizeClass);
+        }
+
+        static auto deallocate(void* ptr) -> void
+        {
+            if (!ptr) {
+                return;
+            }
+
+            auto* block{ static_cast<std::byte*>(ptr) - HEADER_SIZE };
+            auto* header{ reinterpret_cast<Header*>(block) };
+            auto* owner{ header->owner };
+            const auto sizeClass{ header->sizeClass };
+
+            if (!owner) {
+                ::operator delete(block);
+                return;
+            }
+
+            auto* node{ new (block) FreeNode{} };
+            if (owner == s_cache) {
+                node->next = owner->local[sizeClass];
+                owner->local[sizeClass] = node;
+                return;
+            }
+
+            owner->remoteFrees.fetch_add(1, std::memory_order_relaxed);
+            auto& list{ owner->remote[sizeClass] };
+            node->next = list.load(std::memory_order_relaxed);
+            while (!list.compare_exchange_weak(
+              node->next, node, std::memory_order_release, std::memory_order_relaxed)) {
+            }
+        }
+
+        // Totals over every thread that has allocated a frame so far.
+        static auto stats() -> FrameAllocatorStats
+        {
+            FrameAllocatorStats total{};
+            auto& registry{ Registry::instance() };
+            std::scoped_lock lock(registry.mutex);
+            for (const auto* cache : registry.all) {
+                total.allocations += cache->allocations.load(std::memory_order_relaxed);
+                total.heapAllocations += cache->heapAllocations.load(std::memory_order_relaxed);
+                total.remoteFrees += cache->remoteFrees.load(std::memory_order_relaxed);
+            }
+            return total;
+        }
+
+      private:
+        static constexpr size_t SIZE_CLASSES{ MAX_POOLED_SIZE / GRANULARITY };
+        static constexpr size_t HEADER_SIZE{ __STDCPP_DEFAULT_NEW_ALIGNMENT__ };
+
+        struct ThreadCache;
+
+        struct Header
+        {
+            ThreadCache* owner;
+            size_t sizeClass;
+        };
+        static_assert(sizeof(Header) <= HEADER_SIZE);
+
+        struct FreeNode
+        {
+            FreeNode* next{ nullptr };
+        };
+
+        struct Registry
+        {
+            static auto instance() -> Registry&
+            {
+                // Leaked on purpose: frames may still be released during static destruction.
+                static auto* s_instance{ new Registry{} };
+                return *s_instance;
+            }
+
+            std::mutex mutex{};
+            std::vector<ThreadCache*> all{};
+            std::vector<ThreadCache*> orphaned{};
+        };
+
+        struct ThreadCache
+        {
+            std::array<FreeNode*, SIZE_CLASSES> local{};
+            std::array<std::atomic<FreeNode*>, SIZE_CLASSES> remote{};
+            std::atomic<uint64_t> allocations{ 0 };
+            std::atomic<uint64_t> heapAllocations{ 0 };
+            std::atomic<uint64_t> remoteFrees{ 0 };
+
+            // Null once the thread's lease has been released during thread exit.
+            static auto current() -> ThreadCache*
+            {
+                if (!s_cache && !s_released) {
+                    static thread_local Lease s_lease{};
+                    s_cache = s_lease.cache;
+                }
+                return s_cache;
+            }
+        };
+
+        // Binds a cache to the current thread and hands it back to the registry when the thread ends.
+        struct Lease
+        {
+            ThreadCache* cache{ nullptr };
+
+            Lease()
+            {
+                auto& registry{ Registry::instance() };
+                std::scoped_lock lock(registry.mutex);
+                if (!registry.orphaned.empty()) {
+                    cache = registry.orphaned.back();
+                    registry.orphaned.pop_back();
+                }
+                else {
+                    cache = new ThreadCache{};
+                    registry.all.push_back(cache);
+                }
+            }
+
+            ~Lease()
+            {
+                s_cache = nullptr;
+                s_released = true;
+                auto& registry{ Registry::instance() };
+                std::scoped_lock lock(registry.mutex);
+                registry.orphaned.push_back(cache);
+            }
+        };
+
+        // allocations/heapAllocations have a single writer (the owning thread); atomics only make
+        // stats() reads safe.
+        static auto bump(std::atomic<uint64_t>& counter) -> void
+        {
+            counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        }
+
+        static auto initHeader(void* block, ThreadCache* owner, size_t sizeClass) -> void*
+        {
+            new (block) Header{ owner, sizeClass };
+            return static_cast<std::byte*>(block) + HEADER_SIZE;
+        }
+
+        static inline thread_local ThreadCache* s_cache{ nullptr };
+        static inline thread_local bool s_released{ false };
+    };
+
+    namespace detail
+    {
+        // Mixed into promise types so their coroutine frames come from the FrameAllocator.
+        struct PooledFrame
+        {
+            static auto operator new(size_t size) -> void* { return FrameAllocator::allocate(size); }
+            static auto operator delete(void* ptr) -> void { FrameAllocator::deallocate(ptr); }
+        };
+    }
+}
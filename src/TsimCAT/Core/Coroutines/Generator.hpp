@@ -0,0 +1,509 @@
+#pragma once
+
+#include "Channel.hpp"
+#include "Context.hpp"
+#include "Task.hpp"
+
+#include "Common/Result.hpp"
+
+#include <chrono>
+#include <concepts>
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace core::coro
+{
+    template<typename T>
+    class AsyncGenerator;
+
+    namespace detail
+    {
+        /**
+         * Hand-over point between a generator and its consumer. Without a deadline the two simply
+         * transfer control to each other. A consumer waiting with a deadline may give up while the
+         * generator is still producing; the value is then parked at its co_yield until asked for again,
+         * so nothing is lost and nothing is buffered.
+         */
+        struct GeneratorPull
+        {
+            std::mutex mutex{};
+            std::coroutine_handle<> consumer{}; // suspended in next(), empty otherwise
+            ResumeTarget target{};
+            uint64_t wait{ 0 }; // identifies the current wait to its deadline timer
+            TimerId timer{ 0 };
+            bool running{ false };  // resumed and not yet back at a co_yield
+            bool ready{ false };    // parked at a co_yield (or finished) with nobody waiting
+            bool finished{ false }; // ran to completion
+            bool timedOut{ false };
+
+            // At every co_yield and at the end: returns the consumer to transfer to, if one is waiting.
+            auto handOff(bool done) -> std::coroutine_handle<>
+            {
+                std::coroutine_handle<> waiting{};
+                TimerId pending{ 0 };
+                {
+                    std::scoped_lock lock(mutex);
+                    running = false;
+                    finished = done;
+                    waiting = std::exchange(consumer, {});
+                    ready = !waiting;
+                    pending = std::exchange(timer, 0);
+                }
+                if (pending) {
+                    TimerService::instance().cancel(pending);
+                }
+                return waiting ? waiting : std::noop_coroutine();
+            }
+
+            auto expire(uint64_t expired) -> void
+            {
+                std::coroutine_handle<> waiting{};
+                ResumeTarget resumeAt{};
+                {
+                    std::scoped_lock lock(mutex);
+                    if (wait != expired || !consumer) {
+                        return;
+                    }
+                    waiting = std::exchange(consumer, {});
+                    resumeAt = std::move(target);
+                    timer = 0;
+                    timedOut = true;
+                }
+                resumeAt.resume(waiting);
+            }
+
+            static auto armDeadline(const std::shared_ptr<GeneratorPull>& pull,
+                                    uint64_t wait,
+                                    Clock::time_point deadline) -> void
+            {
+                const auto id{ TimerService::instance().addCallback(
+                  deadline, [pull, wait] { pull->expire(wait); }) };
+                {
+                    std::scoped_lock lock(pull->mutex);
+                    if (pull->wait == wait && pull->consumer) {
+                        pull->timer = id;
+                        return;
+                    }
+                }
+                TimerService::instance().cancel(id);
+            }
+        };
+
+        template<typename T>
+        struct GeneratorPromise : PooledFrame
+        {
+            std::shared_ptr<GeneratorPull> pull{ std::make_shared<GeneratorPull>() };
+            T* value{ nullptr }; // the operand of the current co_yield, alive until the generator resumes
+            std::optional<T> copy{};
+            std::exception_ptr exception{};
+            IExecutor* executor{ nullptr };
+            std::stop_token stopToken{};
+            std::optional<Priority> priority{};
+
+            struct YieldAwaiter
+            {
+                bool done{ false };
+
+                auto await_ready() noexcept -> bool { return false; }
+                auto await_suspend(std::coroutine_handle<GeneratorPromise> h) noexcept
+                  -> std::coroutine_handle<>
+                {
+                    return h.promise().pull->handOff(done);
+                }
+                auto await_resume() noexcept -> void {}
+            };
+
+            auto get_return_object() -> AsyncGenerator<T>;
+            auto initial_suspend() -> std::suspend_always { return {}; }
+            auto final_suspend() noexcept -> YieldAwaiter
+            {
+                value = nullptr;
+                return YieldAwaiter{ true };
+            }
+            auto unhandled_exception() -> void { exception = std::current_exception(); }
+            auto return_void() -> void {}
+
+            auto yield_value(std::remove_reference_t<T>&& yielded) -> YieldAwaiter
+            {
+                value = std::addressof(yielded);
+                return {};
+            }
+            auto yield_value(const std::remove_reference_t<T>& yielded) -> YieldAwaiter
+                requires std::copy_constructible<T>
+            {
+                copy.emplace(yielded);
+                value = std::addressof(*copy);
+                return {};
+            }
+
+            template<typename U>
+            auto await_transform(Task<U>&& childTask) -> Task<U>&&
+            {
+                inheritFrom(childTask, *this);
+                return std::move(childTask);
+            }
+            template<typename U>
+            auto await_transform(U&& awaitable) -> U&& { return std::forward<U>(awaitable); }
+        };
+
+        // Resumes the generator up to its next co_yield. With a deadline the wait may end first.
+        template<typename T>
+        struct GeneratorNext
+        {
+            std::coroutine_handle<GeneratorPromise<T>> generator{};
+            std::optional<Clock::time_point> deadline{};
+
+            auto await_ready() -> bool
+            {
+                if (!generator) {
+                    return true;
+                }
+                auto& pull{ *generator.promise().pull };
+                std::scoped_lock lock(pull.mutex);
+                if (pull.ready || pull.finished) {
+                    pull.ready = false;
+                    return true;
+                }
+                return false;
+            }
+
+            template<typename P>
+            auto await_suspend(std::coroutine_handle<P> awaiting) -> std::coroutine_handle<>
+            {
+                if constexpr (requires { awaiting.promise().executor; }) {
+                    inheritPromise(generator.promise(), awaiting.promise());
+                }
+                const auto pull{ generator.promise().pull };
+                const std::coroutine_handle<> producer{ generator };
+                const auto until{ deadline };
+
+                std::unique_lock lock(pull->mutex);
+                // Parked at a co_yield since await_ready (a generator running on another thread).
+                if (pull->ready || pull->finished) {
+                    pull->ready = false;
+                    return awaiting;
+                }
+                pull->consumer = awaiting;
+                pull->target = ResumeTarget::of(awaiting);
+                const auto wait{ ++pull->wait };
+                const auto start{ !std::exchange(pull->running, true) };
+                lock.unlock();
+
+                // The deadline may resume the consumer from here on; only locals are touched.
+                if (until) {
+                    GeneratorPull::armDeadline(pull, wait, *until);
+                }
+                return start ? producer : std::noop_coroutine();
+            }
+
+            auto timedOut() -> bool
+            {
+                return generator && std::exchange(generator.promise().pull->timedOut, false);
+            }
+
+            auto take() -> std::optional<T>
+            {
+                if (!generator) {
+                    return std::nullopt;
+                }
+                auto& promise{ generator.promise() };
+                if (auto exception{ std::exchange(promise.exception, nullptr) }) {
+                    std::rethrow_exception(exception);
+                }
+                if (promise.pull->finished) {
+                    return std::nullopt;
+                }
+                return std::optional<T>{ std::move(*promise.value) };
+            }
+
+            auto await_resume() -> std::optional<T> { return take(); }
+        };
+
+        template<typename T>
+        struct GeneratorNextUntil : GeneratorNext<T>
+        {
+            auto await_resume() -> result::Result<std::optional<T>>
+            {
+                if (this->timedOut()) {
+                    return std::unexpected(std::make_error_code(std::errc::timed_out));
+                }
+                return this->take();
+            }
+        };
+    }
+
+    /**
+     * Lazily produced sequence of values; the body co_yields them one at a time. `co_await next()`
+     * runs the generator up to its next co_yield and returns the value (moved, not copied), or nullopt
+     * once the body has returned; an exception thrown by the body is rethrown there. The generator
+     * inherits the executor, stop token and priority of the coroutine pulling from it.
+     *
+     * nextUntil(deadline) returns std::errc::timed_out if no value was produced in time. The
+     * generator keeps running and the value it yields next is returned by the following call, so
+     * time-based operators need no buffer of their own. Only one coroutine may pull at a time.
+     */
+    template<typename T>
+    class AsyncGenerator
+    {
+      public:
+        static_assert(!std::is_void_v<T> && !std::is_reference_v<T>, "AsyncGenerator yields values");
+
+        using promise_type = detail::GeneratorPromise<T>;
+        using handle_type = std::coroutine_handle<promise_type>;
+        using value_type = T;
+
+        AsyncGenerator(handle_type handle) : m_handle{ handle } {}
+        ~AsyncGenerator()
+        {
+            if (m_handle) {
+                m_handle.destroy();
+            }
+        }
+
+        AsyncGenerator(const AsyncGenerator&) = delete;
+        auto operator=(const AsyncGenerator&) -> AsyncGenerator& = delete;
+        AsyncGenerator(AsyncGenerator&& other) noexcept
+          : m_handle{ std::exchange(other.m_handle, nullptr) }
+        {
+        }
+        auto operator=(AsyncGenerator&& other) noexcept -> AsyncGenerator&
+        {
+            if (this != &other) {
+                if (m_handle) {
+                    m_handle.destroy();
+                }
+                m_handle = std::exchange(other.m_handle, nullptr);
+            }
+            return *this;
+        }
+
+        auto next() -> detail::GeneratorNext<T> { return { m_handle }; }
+        auto nextUntil(Clock::time_point deadline) -> detail::GeneratorNextUntil<T>
+        {
+            return { { m_handle, deadline } };
+        }
+
+        auto getHandle() const -> const handle_type& { return m_handle; }
+
+      private:
+        handle_type m_handle;
+    };
+
+    namespace detail
+    {
+        template<typename T>
+        auto GeneratorPromise<T>::get_return_object() -> AsyncGenerator<T>
+        {
+            return AsyncGenerator<T>::handle_type::from_promise(*this);
+        }
+
+        template<typename T, typename F>
+        auto mapValues(AsyncGenerator<T> source, F transform)
+          -> AsyncGenerator<std::invoke_result_t<F&, T&&>>
+        {
+            while (true) {
+                auto value{ co_await source.next() };
+                if (!value) {
+                    co_return;
+                }
+                co_yield std::invoke(transform, std::move(*value));
+            }
+        }
+
+        template<typename T, typename F>
+        auto filterValues(AsyncGenerator<T> source, F predicate) -> AsyncGenerator<T>
+        {
+            while (true) {
+                auto value{ co_await source.next() };
+                if (!value) {
+                    co_return;
+                }
+                if (std::invoke(predicate, std::as_const(*value))) {
+                    co_yield std::move(*value);
+                }
+            }
+        }
+
+        template<typename T>
+        auto distinctValues(AsyncGenerator<T> source) -> AsyncGenerator<T>
+        {
+            std::optional<T> last{};
+            while (true) {
+                auto value{ co_await source.next() };
+                if (!value) {
+                    co_return;
+                }
+                if (last && *last == *value) {
+                    continue;
+                }
+                last = *value;
+                co_yield std::move(*value);
+            }
+        }
+
+        template<typename T>
+        auto debounceValues(AsyncGenerator<T> source, Clock::duration quiet) -> AsyncGenerator<T>
+        {
+            std::optional<T> pending{};
+            while (true) {
+                if (!pending) {
+                    auto value{ co_await source.next() };
+                    if (!value) {
+                        co_return;
+                    }
+                    pending = std::move(value);
+                    continue;
+                }
+                auto step{ co_await source.nextUntil(Clock::now() + quiet) };
+                if (!step) {
+                    co_yield std::move(*pending);
+                    pending.reset();
+                }
+                else if (*step) {
+                    pending = std::move(*step);
+                }
+                else {
+                    break;
+                }
+            }
+            co_yield std::move(*pending);
+        }
+
+        template<typename T>
+        auto sampleValues(AsyncGenerator<T> source, Clock::duration interval) -> AsyncGenerator<T>
+        {
+            std::optional<T> latest{};
+            auto tick{ Clock::now() + interval };
+            while (true) {
+                auto step{ co_await source.nextUntil(tick) };
+                if (step && !*step) {
+                    break;
+                }
+                if (step) {
+                    latest = std::move(*step);
+                    continue;
+                }
+                // Skip ticks missed while the consumer was busy rather than emitting a burst.
+                const auto now{ Clock::now() };
+                tick = now - (now - tick) % interval + interval;
+                if (latest) {
+                    co_yield std::move(*latest);
+                    latest.reset();
+                }
+            }
+            if (latest) {
+                co_yield std::move(*latest);
+            }
+        }
+
+        template<typename T>
+        auto batchValues(AsyncGenerator<T> source, size_t size) -> AsyncGenerator<std::vector<T>>
+        {
+            std::vector<T> batch{};
+            batch.reserve(size);
+            while (true) {
+                auto value{ co_await source.next() };
+                if (!value) {
+                    break;
+                }
+                batch.push_back(std::move(*value));
+                if (batch.size() == size) {
+                    co_yield std::exchange(batch, {});
+                    batch.reserve(size);
+                }
+            }
+            if (!batch.empty()) {
+                co_yield std::move(batch);
+            }
+        }
+
+        template<typename T, typename Channel>
+        auto channelValues(Channel channel) -> AsyncGenerator<T>
+        {
+            while (true) {
+                auto value{ co_await channel.next() };
+                if (!value) {
+                    co_return;
+                }
+                co_yield std::move(*value);
+            }
+        }
+    }
+
+    // Stream adapters. Each one is a single generator frame pulling from its source, so a chain like
+    // `values(channel) | distinctUntilChanged() | sample(100ms)` runs as one pipeline without
+    // intermediate queues; values are moved from stage to stage.
+    template<typename T, std::invocable<AsyncGenerator<T>> Adapter>
+    auto operator|(AsyncGenerator<T> source, Adapter&& adapter)
+    {
+        return std::invoke(std::forward<Adapter>(adapter), std::move(source));
+    }
+
+    template<typename F>
+    auto map(F transform)
+    {
+        return [transform = std::move(transform)]<typename T>(AsyncGenerator<T> source) mutable {
+            return detail::mapValues(std::move(source), std::move(transform));
+        };
+    }
+
+    template<typename F>
+    auto filter(F predicate)
+    {
+        return [predicate = std::move(predicate)]<typename T>(AsyncGenerator<T> source) mutable {
+            return detail::filterValues(std::move(source), std::move(predicate));
+        };
+    }
+
+    // Drops values equal to the one emitted before them.
+    inline auto distinctUntilChanged()
+    {
+        return []<std::equality_comparable T>(AsyncGenerator<T> source) {
+            return detail::distinctValues(std::move(source));
+        };
+    }
+
+    // Emits a value once no newer one has arrived for `quiet`; the last value is flushed at the end.
+    inline auto debounce(Clock::duration quiet)
+    {
+        return [quiet]<typename T>(AsyncGenerator<T> source) {
+            return detail::debounceValues(std::move(source), quiet);
+        };
+    }
+
+    // Emits the latest value once per interval, and nothing for intervals without a new value.
+    inline auto sample(Clock::duration interval)
+    {
+        return [interval]<typename T>(AsyncGenerator<T> source) {
+            return detail::sampleValues(std::move(source), interval);
+        };
+    }
+
+    // Groups values into vectors of `size`; a shorter final batch is emitted at the end.
+    inline auto batch(size_t size)
+    {
+        return [size]<typename T>(AsyncGenerator<T> source) {
+            return detail::batchValues(std::move(source), std::max<size_t>(size, 1));
+        };
+    }
+
+    // Values pushed to a channel until it is closed (or the reader is stopped).
+    template<typename T>
+    auto values(BinaryChannel<T> channel) -> AsyncGenerator<T>
+    {
+        return detail::channelValues<T>(std::move(channel));
+    }
+
+    template<typename T>
+    auto values(Channel<T> channel) -> AsyncGenerator<T>
+    {
+        return detail::channelValues<T>(std::move(channel));
+    }
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace core::coro
+{
+    /**
+     * Scheduling class of a coroutine, inherited by the tasks it awaits. Executors that support it
+     * (Context) always resume Cyclic work before Normal, and Normal before Background; within a class
+     * the order stays FIFO. Background work can therefore starve while higher classes stay busy.
+     */
+    enum class Priority : uint8_t
+    {
+        Cyclic,     // station I/O and anything on the PLC cycle
+        Normal,     // default
+        Background, // diagnostics, UI snapshots, trace-heavy bursts
+    };
+
+    inline constexpr size_t PRIORITY_COUNT{ 3 };
+}
@@ -0,0 +1,186 @@
+#pragma once
+
+#include "Context.hpp"
+
+#include <coroutine>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace core::coro
+{
+    class Strand;
+
+    namespace detail
+    {
+        // Coroutine that drains a Strand every time it is resumed; it never completes.
+        struct StrandPump
+        {
+            struct promise_type
+            {
+                auto get_return_object() -> StrandPump
+                {
+                    return { std::coroutine_handle<promise_type>::from_promise(*this) };
+                }
+                auto initial_suspend() -> std::suspend_always { return {}; }
+                auto final_suspend() noexcept -> std::suspend_always { return {}; }
+                auto unhandled_exception() -> void { std::terminate(); }
+                auto return_void() -> void {}
+            };
+
+            std::coroutine_handle<promise_type> handle;
+        };
+    }
+
+    /**
+     * Serializing view of another executor. Handles scheduled and callbacks posted to a strand run one
+     * at a time and in FIFO order, on whichever thread of the underlying executor picks the strand up,
+     * so state touched only from the strand needs no lock. Strands sharing a ThreadPool still run in
+     * parallel with each other.
+     *
+     * At most one turn is queued on the underlying executor at any time; a turn drains up to
+     * BATCH_SIZE entries and then yields the thread, so a busy strand cannot starve its neighbours.
+     *
+     * The strand owns no thread: run() and stop() belong to the underlying executor, which must
+     * outlive the strand. Destroy the strand only once that executor has stopped or nothing can be
+     * scheduled onto the strand any more. Posted callbacks must not throw.
+     */
+    class Strand : public IExecutor
+    {
+      public:
+        static constexpr size_t BATCH_SIZE{ 32 };
+
+        explicit Strand(IExecutor& executor) : m_executor{ executor }, m_pump{ pump(this).handle } {}
+
+        ~Strand() override { m_pump.destroy(); }
+
+        Strand(const Strand&) = delete;
+        auto operator=(const Strand&) -> Strand& = delete;
+        Strand(Strand&&) = delete;
+        auto operator=(Strand&&) -> Strand& = delete;
+
+        auto run() -> void override {}
+        auto stop() -> void override {}
+
+        auto schedule(std::coroutine_handle<> handle) -> void override { schedule(handle, Priority::Normal); }
+
+        auto schedule(std::coroutine_handle<> handle, Priority priority) -> void override
+        {
+            if (handle) {
+                enqueue({ .handle = handle, .priority = priority });
+            }
+        }
+
+        // Runs `callback` on the strand, after everything queued before it.
+        auto post(std::function<void()> callback, Priority priority = Priority::Normal) -> void
+        {
+            enqueue({ .callback = std::move(callback), .priority = priority });
+        }
+
+        auto getLifeToken() -> std::weak_ptr<void> override { return m_lifeToken; }
+
+        auto stats() const -> ExecutorStats override
+        {
+            ExecutorStats stats{ .takenAt = Clock::now() };
+            m_counters.fill(stats);
+            std::scoped_lock lock(m_mutex);
+            stats.readyDepth = m_queue.size();
+            return stats;
+        }
+
+        // True while the calling thread is inside one of this strand's turns.
+        auto runningInThisThread() const -> bool { return s_current == this; }
+
+        auto underlying() -> IExecutor& { return m_executor; }
+
+      private:
+        struct Entry
+        {
+            std::coroutine_handle<> handle{};
+            std::function<void()> callback{};
+            Priority priority{ Priority::Normal };
+        };
+
+        // Suspends the pump and hands its next turn to the underlying executor if work is left.
+        struct EndOfTurn
+        {
+            Strand* strand;
+
+            auto await_ready() const noexcept -> bool { return false; }
+            auto await_suspend(std::coroutine_handle<> pump) const -> void
+            {
+                Priority priority{};
+                {
+                    std::scoped_lock lock(strand->m_mutex);
+                    if (strand->m_queue.empty()) {
+                        strand->m_scheduled = false;
+                        return;
+                    }
+                    priority = strand->m_queue.front().priority;
+                }
+                strand->m_executor.schedule(pump, priority);
+            }
+            auto await_resume() const noexcept -> void {}
+        };
+
+        static auto pump(Strand* strand) -> detail::StrandPump
+        {
+            while (true) {
+                strand->drain();
+                co_await EndOfTurn{ strand };
+            }
+        }
+
+        auto enqueue(Entry entry) -> void
+        {
+            const auto priority{ entry.priority };
+            {
+                std::scoped_lock lock(m_mutex);
+                m_queue.push_back(std::move(entry));
+                m_counters.recordDepth(m_queue.size());
+                if (std::exchange(m_scheduled, true)) {
+                    return;
+                }
+            }
+            m_executor.schedule(m_pump, priority);
+        }
+
+        auto drain() -> void
+        {
+            auto* previous{ std::exchange(s_current, this) };
+            for (size_t i{ 0 }; i < BATCH_SIZE; ++i) {
+                Entry entry{};
+                {
+                    std::scoped_lock lock(m_mutex);
+                    if (m_queue.empty()) {
+                        break;
+                    }
+                    entry = std::move(m_queue.front());
+                    m_queue.pop_front();
+                }
+                m_counters.countResume();
+                if (entry.callback) {
+                    entry.callback();
+                }
+                else if (!entry.handle.done()) {
+                    entry.handle.resume();
+                }
+            }
+            s_current = previous;
+        }
+
+        static inline thread_local const Strand* s_current{ nullptr };
+
+        IExecutor& m_executor;
+        std::coroutine_handle<> m_pump;
+        mutable std::mutex m_mutex{};
+        std::deque<Entry> m_queue{};
+        bool m_scheduled{ false }; // a turn is queued on or running in m_executor
+        detail::ExecutorCounters m_counters{};
+        std::shared_ptr<bool> m_lifeToken{ std::make_shared<bool>(true) };
+    };
+}
@@ -0,0 +1,354 @@
+#pragma once
+
+#include "Cancellation.hpp"
+#include "Context.hpp"
+
+#include "Utils/intrusive_list.hpp"
+
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <mutex>
+#include <utility>
+
+namespace core::coro
+{
+    class AsyncSemaphore;
+    class AsyncManualResetEvent;
+
+    namespace detail
+    {
+        // Intrusive list node embedded in every awaiter suspended on a semaphore or event.
+        struct SyncWaiter
+        {
+            std::coroutine_handle<> handle{};
+            ResumeTarget target{};
+            SyncWaiter* prev{ nullptr };
+            SyncWaiter* next{ nullptr };
+            bool linked{ false };    // guarded by the primitive's mutex
+            bool granted{ false };   // guarded by the primitive's mutex until resumed
+            bool suspended{ false }; // only touched by the awaiting coroutine
+        };
+
+        // Resumes a chain detached from a waiter list. Each node is read before its coroutine runs,
+        // since resuming may destroy the awaiter.
+        inline auto resumeSyncWaiters(SyncWaiter* waiter) -> void
+        {
+            while (waiter) {
+                auto* following{ waiter->next };
+                auto handle{ waiter->handle };
+                auto target{ std::move(waiter->target) };
+                target.resume(handle);
+                waiter = following;
+            }
+        }
+
+        /**
+         * Suspends until Primitive grants the awaiter, then resumes it on its executor; no OS thread
+         * blocks while waiting. Primitive supplies m_mutex, m_waiters, tryTakeLocked() and
+         * abandonGrant() for a grant whose coroutine was destroyed before it could run. A stop request
+         * unlinks the awaiter and resumes it without a grant.
+         */
+        template<typename Primitive>
+        struct SyncAwaiter : SyncWaiter
+        {
+            Primitive* owner{ nullptr };
+            bool withdrawn{ false }; // guarded by the primitive's mutex
+            StopRegistration<SyncAwaiter> stop{};
+
+            explicit SyncAwaiter(Primitive& primitive) : owner{ &primitive } {}
+
+            ~SyncAwaiter()
+            {
+                stop.disarm();
+                if (!suspended) {
+                    return;
+                }
+                bool abandoned{ false };
+                {
+                    std::scoped_lock lock(owner->m_mutex);
+                    if (linked) {
+                        owner->m_waiters.remove(this);
+                    }
+                    else {
+                        abandoned = std::exchange(granted, false);
+                    }
+                }
+                if (abandoned) {
+                    owner->abandonGrant();
+                }
+            }
+
+            auto await_ready() -> bool
+            {
+                std::scoped_lock lock(owner->m_mutex);
+                granted = owner->tryTakeLocked();
+                return granted;
+            }
+
+            template<typename P>
+            auto await_suspend(std::coroutine_handle<P> awaiting) -> bool
+            {
+                handle = awaiting;
+                target = ResumeTarget::of(awaiting);
+                if (!stop.arm(this, stopTokenOf(awaiting))) {
+                    return false;
+                }
+
+                std::scoped_lock lock(owner->m_mutex);
+                if (withdrawn) {
+                    return false;
+                }
+                // Granted since await_ready.
+                if (owner->tryTakeLocked()) {
+                    granted = true;
+                    return false;
+                }
+                suspended = true;
+                linked = true;
+                owner->m_waiters.pushBack(this);
+                return true;
+            }
+
+            auto onStop() -> void
+            {
+                {
+                    std::scoped_lock lock(owner->m_mutex);
+                    withdrawn = true;
+                    if (!linked) {
+                        return;
+                    }
+                    owner->m_waiters.remove(this);
+                    linked = false;
+                }
+                auto resumeAt{ target };
+                resumeAt.resume(handle);
+            }
+
+            // True once granted; false if a stop request came first. The grant now belongs to the caller.
+            // The granting thread wrote `granted` before scheduling the resume, so no lock is needed.
+            auto await_resume() -> bool
+            {
+                stop.disarm();
+                return std::exchange(granted, false);
+            }
+        };
+    }
+
+    /**
+     * A permit taken from an AsyncSemaphore, handed back when destroyed or released. An empty permit
+     * (false) means the acquire was given up on a stop request.
+     */
+    class SemaphorePermit
+    {
+      public:
+        SemaphorePermit() = default;
+        explicit SemaphorePermit(AsyncSemaphore* semaphore) : m_semaphore{ semaphore } {}
+        ~SemaphorePermit() { release(); }
+
+        SemaphorePermit(const SemaphorePermit&) = delete;
+        auto operator=(const SemaphorePermit&) -> SemaphorePermit& = delete;
+        SemaphorePermit(SemaphorePermit&& other) noexcept
+          : m_semaphore{ std::exchange(other.m_semaphore, nullptr) }
+        {
+        }
+        auto operator=(SemaphorePermit&& other) noexcept -> SemaphorePermit&
+        {
+            if (this != &other) {
+                release();
+                m_semaphore = std::exchange(other.m_semaphore, nullptr);
+            }
+            return *this;
+        }
+
+        explicit operator bool() const { return m_semaphore != nullptr; }
+
+        inline auto release() -> void;
+
+      private:
+        AsyncSemaphore* m_semaphore{ nullptr };
+    };
+
+    /**
+     * Counting semaphore for coroutines. acquire() suspends while no permit is free and is resumed on
+     * the awaiting coroutine's executor once one is handed back, in FIFO order; a released permit goes
+     * straight to the longest waiter, so late arrivals cannot barge ahead. The semaphore must outlive
+     * its waiters and permits.
+     */
+    class AsyncSemaphore
+    {
+      public:
+        struct AcquireAwaiter : detail::SyncAwaiter<AsyncSemaphore>
+        {
+            using SyncAwaiter::SyncAwaiter;
+
+            auto await_resume() -> SemaphorePermit
+            {
+                const auto acquired{ SyncAwaiter::await_resume() };
+                return SemaphorePermit{ acquired ? owner : nullptr };
+            }
+        };
+
+        explicit AsyncSemaphore(size_t permits) : m_permits{ permits }, m_available{ permits } {}
+
+        AsyncSemaphore(const AsyncSemaphore&) = delete;
+        auto operator=(const AsyncSemaphore&) -> AsyncSemaphore& = delete;
+
+        auto acquire() -> AcquireAwaiter { return AcquireAwaiter{ *this }; }
+
+        // Never suspends; the permit is empty if none was free.
+        auto tryAcquire() -> SemaphorePermit
+        {
+            std::scoped_lock lock(m_mutex);
+            return SemaphorePermit{ tryTakeLocked() ? this : nullptr };
+        }
+
+        auto available() const -> size_t
+        {
+            std::scoped_lock lock(m_mutex);
+            return m_available;
+        }
+
+        // Coroutines currently suspended in acquire(); a snapshot for diagnostics.
+        auto waiterCount() const -> size_t
+        {
+            std::scoped_lock lock(m_mutex);
+            return m_waiters.size();
+        }
+
+        // Blocks the calling thread until every permit has been handed back, e.g. by work its owner has
+        // stopped waiting for. Meant for the owner's destructor; nothing may acquire meanwhile.
+        auto waitUntilIdle() -> void
+        {
+            std::unique_lock lock(m_mutex);
+            m_idle.wait(lock, [this] { return m_available == m_permits; });
+        }
+
+      private:
+        friend class SemaphorePermit;
+        friend struct detail::SyncAwaiter<AsyncSemaphore>;
+
+        auto tryTakeLocked() -> bool
+        {
+            if (m_available == 0 || !m_waiters.empty()) {
+                return false;
+            }
+            --m_available;
+            return true;
+        }
+
+        auto release() -> void
+        {
+            detail::SyncWaiter* next{ nullptr };
+            {
+                std::scoped_lock lock(m_mutex);
+                next = m_waiters.popFront();
+                if (!next) {
+                    // Notified under the lock: a waitUntilIdle() caller may destroy the semaphore as
+                    // soon as it can take the mutex.
+                    if (++m_available == m_permits) {
+                        m_idle.notify_all();
+                    }
+                    return;
+                }
+                next->linked = false;
+                next->granted = true;
+            }
+            detail::resumeSyncWaiters(next);
+        }
+
+        auto abandonGrant() -> void { release(); }
+
+        mutable std::mutex m_mutex{};
+        std::condition_variable m_idle{};
+        utils::list::IntrusiveList<detail::SyncWaiter> m_waiters{};
+        const size_t m_permits;
+        size_t m_available;
+    };
+
+    inline auto SemaphorePermit::release() -> void
+    {
+        if (auto* semaphore{ std::exchange(m_semaphore, nullptr) }) {
+            semaphore->release();
+        }
+    }
+
+    /**
+     * Mutual exclusion for coroutines: lock() suspends the coroutine instead of its thread, so holding
+     * the lock across a co_await does not stall the executor. Yields a guard that unlocks when
+     * destroyed; an empty guard means the wait was given up on a stop request. Not recursive.
+     */
+    class AsyncMutex
+    {
+      public:
+        using Guard = SemaphorePermit;
+
+        auto lock() -> AsyncSemaphore::AcquireAwaiter { return m_semaphore.acquire(); }
+        auto tryLock() -> Guard { return m_semaphore.tryAcquire(); }
+        auto isLocked() const -> bool { return m_semaphore.available() == 0; }
+
+      private:
+        AsyncSemaphore m_semaphore{ 1 };
+    };
+
+    /**
+     * Event that stays set until reset(). wait() completes immediately while set and otherwise
+     * suspends until set() resumes every waiter on its own executor. Yields false if a stop request
+     * ended the wait first.
+     */
+    class AsyncManualResetEvent
+    {
+      public:
+        using WaitAwaiter = detail::SyncAwaiter<AsyncManualResetEvent>;
+
+        explicit AsyncManualResetEvent(bool initiallySet = false) : m_set{ initiallySet } {}
+
+        AsyncManualResetEvent(const AsyncManualResetEvent&) = delete;
+        auto operator=(const AsyncManualResetEvent&) -> AsyncManualResetEvent& = delete;
+
+        auto wait() -> WaitAwaiter { return WaitAwaiter{ *this }; }
+
+        auto set() -> void
+        {
+            detail::SyncWaiter* waiters{ nullptr };
+            {
+                std::scoped_lock lock(m_mutex);
+                m_set = true;
+                waiters = m_waiters.takeAll();
+                for (auto* waiter{ waiters }; waiter; waiter = waiter->next) {
+                    waiter->linked = false;
+                    waiter->granted = true;
+                }
+            }
+            detail::resumeSyncWaiters(waiters);
+        }
+
+        auto reset() -> void
+        {
+            std::scoped_lock lock(m_mutex);
+            m_set = false;
+        }
+
+        auto isSet() const -> bool
+        {
+            std::scoped_lock lock(m_mutex);
+            return m_set;
+        }
+
+        auto waiterCount() const -> size_t
+        {
+            std::scoped_lock lock(m_mutex);
+            return m_waiters.size();
+        }
+
+      private:
+        friend struct detail::SyncAwaiter<AsyncManualResetEvent>;
+
+        auto tryTakeLocked() const -> bool { return m_set; }
+        auto abandonGrant() -> void {}
+
+        mutable std::mutex m_mutex{};
+        utils::list::IntrusiveList<detail::SyncWaiter> m_waiters{};
+        bool m_set;
+    };
+}
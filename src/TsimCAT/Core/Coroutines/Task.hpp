@@ -1,12 +1,14 @@
 #pragma once
 
+#include "BlockingPool.hpp"
+#include "Cancellation.hpp"
 #include "Context.hpp"
+#include "FrameAllocator.hpp"
 
 #include <exception>
 #include <utility>
-#include <future>
-#include <thread>
 #include <optional>
+#include <stop_token>
 
 namespace core::coro
 {
@@ -35,6 +37,8 @@ namespace core::coro
         DetachedTask(DetachedTask&& other) noexcept : m_handle{ std::exchange(other.m_handle, nullptr) } {}
         auto operator=(DetachedTask&& other) noexcept -> DetachedTask& { m_handle = std::exchange(other.m_handle, nullptr); return *this; }
 
+        auto getHandle() const -> const handle_type& { return m_handle; }
+
       private:
         handle_type m_handle;
     };
@@ -78,21 +82,59 @@ namespace core::coro
     // 3. Promise Definitions
     namespace detail
     {
-        struct DetachedTaskPromise
+        // Child tasks inherit the executor, stop token and priority of the coroutine awaiting them, so
+        // awaiters deeper in the chain know where to resume, in which lane and when to give up.
+        template<typename Child, typename Parent>
+        auto inheritPromise(Child& child, const Parent& parent) -> void
+        {
+            if (!child.executor) {
+                child.executor = parent.executor;
+            }
+            if (parent.stopToken.stop_possible() && !child.stopToken.stop_possible()) {
+                child.stopToken = parent.stopToken;
+            }
+            if (!child.priority) {
+                child.priority = parent.priority;
+            }
+        }
+
+        template<typename U, typename Parent>
+        auto inheritFrom(Task<U>& childTask, const Parent& parent) -> void
+        {
+            if (const auto& handle{ childTask.getHandle() }) {
+                inheritPromise(handle.promise(), parent);
+            }
+        }
+
+        struct DetachedTaskPromise : PooledFrame
         {
+            IExecutor* executor{ nullptr };
+            std::stop_token stopToken{};
+            std::optional<Priority> priority{};
+
             auto get_return_object() -> DetachedTask;
             auto initial_suspend() -> std::suspend_always { return {}; }
             auto final_suspend() noexcept -> std::suspend_never { return {}; }
             auto unhandled_exception() -> void { std::terminate(); }
             auto return_void() -> void {}
+            template<typename U>
+            auto await_transform(Task<U>&& childTask) -> Task<U>&&
+            {
+                inheritFrom(childTask, *this);
+                return std::move(childTask);
+            }
+            template<typename U>
+            auto await_transform(U&& task) -> U&& { return std::forward<U>(task); }
         };
 
         template<typename T>
-        struct TaskPromiseBase
+        struct TaskPromiseBase : PooledFrame
         {
             std::coroutine_handle<> waiter{};
             std::exception_ptr exception{};
             IExecutor* executor{ nullptr };
+            std::stop_token stopToken{};
+            std::optional<Priority> priority{}; // unset: inherited from the awaiting coroutine
 
             auto initial_suspend() -> std::suspend_always { return {}; }
             auto final_suspend() noexcept
@@ -109,7 +151,11 @@ namespace core::coro
             }
             auto unhandled_exception() -> void { exception = std::current_exception(); }
             template<typename U>
-            auto await_transform(Task<U>&& childTask) -> Task<U>&& { return std::move(childTask); }
+            auto await_transform(Task<U>&& childTask) -> Task<U>&&
+            {
+                inheritFrom(childTask, *this);
+                return std::move(childTask);
+            }
             template<typename U>
             auto await_transform(U&& task) -> U&& { return std::forward<U>(task); }
         };
@@ -136,47 +182,185 @@ namespace core::coro
     }
 
     // 4. Async Helpers
+
+    // Runs a blocking callable on the BlockingPool. The awaiting coroutine continues on its own
+    // executor (or on the pool thread if it has none); exceptions thrown by func are rethrown there.
+    // A stop request resumes the coroutine right away with std::errc::operation_canceled (as an error
+    // for Result types, thrown as std::system_error otherwise) and func is skipped if it has not
+    // started yet; func must therefore own everything it touches. A pool that is shutting down skips
+    // func the same way.
     template<typename T>
-    auto runAsync(auto&& func) -> Task<T>
+    auto runAsync(auto&& func, BlockingPool& pool = BlockingPool::instance())
+      -> detail::AsyncAwaiter<T, std::decay_t<decltype(func)>>
     {
-        struct Awaiter
+        return { std::forward<decltype(func)>(func), pool };
+    }
+
+    namespace detail
+    {
+        // Shared by a cancellable sleep and its timer: whichever of the two claims it resumes the coroutine.
+        struct Wakeup
+        {
+            std::atomic<bool> claimed{ false };
+            std::atomic<TimerId> timer{ 0 };
+            std::coroutine_handle<> handle{};
+            ResumeTarget target{};
+
+            auto tryResume() -> void
+            {
+                if (!claimed.exchange(true, std::memory_order_acq_rel)) {
+                    target.resume(handle);
+                }
+            }
+        };
+
+        struct SleepAwaiter
         {
-            std::decay_t<decltype(func)> f;
-            std::conditional_t<std::is_void_v<T>, bool, T> result{};
+            Clock::time_point deadline{};
+            std::shared_ptr<Wakeup> wakeup{};
+            StopRegistration<SleepAwaiter> stop{};
+
+            auto await_ready() const -> bool { return deadline <= Clock::now(); }
+
+            template<typename P>
+            auto await_suspend(std::coroutine_handle<P> handle) -> bool
+            {
+                auto token{ stopTokenOf(handle) };
+                if (!token.stop_possible()) {
+                    scheduleOnExecutor(handle);
+                    return true;
+                }
+
+                // The executor's own timer resumes the handle directly and cannot be raced against a
+                // stop request, so cancellable sleeps go through a callback on the TimerService.
+                auto shared{ std::make_shared<Wakeup>() };
+                shared->handle = handle;
+                shared->target = ResumeTarget::of(handle);
+                wakeup = shared;
+                const auto due{ deadline };
+                if (!stop.arm(this, std::move(token))) {
+                    return false;
+                }
 
-            bool await_ready() { return false; }
-            void await_suspend(std::coroutine_handle<> h)
+                // A stop request may resume the coroutine from here on; only locals are touched.
+                const auto timer{ TimerService::instance().addCallback(due,
+                                                                       [shared] { shared->tryResume(); }) };
+                shared->timer.store(timer, std::memory_order_release);
+                return true;
+            }
+
+            auto await_resume() -> void { stop.disarm(); }
+
+            auto onStop() -> void
             {
-                std::thread([this, h]() mutable {
-                    try {
-                        if constexpr (std::is_void_v<T>) f();
-                        else result = f();
-                    } catch (...) {}
-                    h.resume();
-                }).detach();
+                auto shared{ wakeup };
+                if (const auto timer{ shared->timer.load(std::memory_order_acquire) }) {
+                    TimerService::instance().cancel(timer);
+                }
+                shared->tryResume();
+            }
+
+          private:
+            template<typename P>
+            auto scheduleOnExecutor(std::coroutine_handle<P> handle) -> void
+            {
+                IExecutor* executor{ nullptr };
+                if constexpr (requires { handle.promise().executor; }) {
+                    executor = handle.promise().executor;
+                }
+
+                if (executor) {
+                    executor->scheduleAt(deadline, handle, priorityOf(handle));
+                }
+                else {
+                    TimerService::instance().add(deadline, handle);
+                }
             }
-            T await_resume() { if constexpr (!std::is_void_v<T>) return std::move(result); }
         };
-        co_return co_await Awaiter{ std::forward<decltype(func)>(func) };
+    }
+
+    // Suspends until the deadline and resumes on the awaiting coroutine's executor. Coroutines without
+    // an executor are resumed on the shared timer thread. No thread is created per call. A stop request
+    // on the coroutine's token ends the sleep early and removes its timer.
+    inline auto sleep_until(Clock::time_point deadline) -> detail::SleepAwaiter
+    {
+        return detail::SleepAwaiter{ deadline };
     }
 
     template<typename Rep, typename Period>
-    auto sleep(std::chrono::duration<Rep, Period> duration) -> Task<void>
+    auto sleep(std::chrono::duration<Rep, Period> duration) -> detail::SleepAwaiter
+    {
+        return sleep_until(Clock::now() + std::chrono::duration_cast<Clock::duration>(duration));
+    }
+
+    namespace detail
     {
-        struct Awaiter
+        // Stop source of a withTimeout scope, shared with the timer that may trip it.
+        struct Deadline
         {
-            std::chrono::duration<Rep, Period> d;
-            bool await_ready() { return d.count() <= 0; }
-            void await_suspend(std::coroutine_handle<> h)
+            std::stop_source source{};
+            std::atomic<bool> expired{ false };
+
+            auto expire() -> void
             {
-                std::thread([this, h]() {
-                    std::this_thread::sleep_for(d);
-                    h.resume();
-                }).detach();
+                expired.store(true, std::memory_order_release);
+                source.request_stop();
             }
-            void await_resume() {}
         };
-        co_await Awaiter{ duration };
-        co_return;
+    }
+
+    namespace detail
+    {
+        template<typename T>
+        auto awaitWithDeadline(Task<T> task, std::chrono::milliseconds timeout) -> Task<T>
+        {
+            const auto parent{ co_await currentStopToken() };
+            auto deadline{ std::make_shared<Deadline>() };
+            std::stop_callback forward{ parent, [&source = deadline->source] { source.request_stop(); } };
+            const auto timer{ TimerService::instance().addCallback(Clock::now() + timeout,
+                                                                   [deadline] { deadline->expire(); }) };
+            task.getHandle().promise().stopToken = deadline->source.get_token();
+
+            if constexpr (std::is_void_v<T>) {
+                co_await std::move(task);
+                TimerService::instance().cancel(timer);
+            }
+            else {
+                auto result{ co_await std::move(task) };
+                TimerService::instance().cancel(timer);
+                if constexpr (IS_RESULT<T>) {
+                    if (!result && result.error() == std::errc::operation_canceled &&
+                        deadline->expired.load(std::memory_order_acquire)) {
+                        co_return abandoned<T>(std::errc::timed_out);
+                    }
+                }
+                co_return result;
+            }
+        }
+    }
+
+    /**
+     * Runs task with a stop token that is requested when the caller's own token is, or once timeout
+     * has elapsed. Awaiters inside the task give up with std::errc::operation_canceled; if that was
+     * the deadline, a Result-typed task reports std::errc::timed_out instead. A zero timeout means no
+     * deadline and hands task back unchanged, without an extra frame.
+     */
+    template<typename T>
+    auto withTimeout(Task<T> task, std::chrono::milliseconds timeout) -> Task<T>
+    {
+        if (timeout <= std::chrono::milliseconds::zero() || !task.getHandle()) {
+            return task;
+        }
+        return detail::awaitWithDeadline(std::move(task), timeout);
+    }
+
+    // Pins the scheduling class of task and, unless they set their own, of everything it awaits.
+    template<typename T>
+    auto withPriority(Task<T> task, Priority priority) -> Task<T>
+    {
+        if (task.getHandle()) {
+            task.getHandle().promise().priority = priority;
+        }
+        return task;
     }
 }
@@ -0,0 +1,211 @@
+#pragma once
+
+#include "Context.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <coroutine>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace core::coro
+{
+    /**
+     * Multi-threaded executor with one run queue per worker.
+     *
+     * Handles scheduled from a worker thread go to that worker's own deque, handles scheduled from
+     * outside the pool are distributed round-robin. A worker that runs dry steals from the back of
+     * the other workers' deques before it parks.
+     *
+     * run() turns the calling thread into worker 0 and spawns the remaining workers. It returns
+     * once stop() was called and every queue has been drained, mirroring Context::run().
+     */
+    class ThreadPool : public IExecutor
+    {
+      public:
+        explicit ThreadPool(size_t threadCount = std::max(1u, std::thread::hardware_concurrency()))
+        {
+            threadCount = std::max<size_t>(threadCount, 1);
+            m_workers.reserve(threadCount);
+            for (size_t i = 0; i < threadCount; ++i) {
+                m_workers.push_back(std::make_unique<Worker>());
+            }
+        }
+
+        ~ThreadPool() override
+        {
+            stop();
+            joinThreads();
+        }
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+        ThreadPool(ThreadPool&&) = delete;
+        ThreadPool& operator=(ThreadPool&&) = delete;
+
+        auto run() -> void override
+        {
+            {
+                std::scoped_lock lock(m_parkMutex);
+                if (m_started) {
+                    return;
+                }
+                m_started = true;
+            }
+
+            for (size_t i = 1; i < m_workers.size(); ++i) {
+                m_threads.emplace_back([this, i] { workerLoop(i); });
+            }
+            workerLoop(0);
+            joinThreads();
+        }
+
+        auto stop() -> void override
+        {
+            {
+                std::scoped_lock lock(m_parkMutex);
+                m_running = false;
+            }
+            m_parkCv.notify_all();
+        }
+
+        using IExecutor::schedule;
+
+        auto schedule(std::coroutine_handle<> handle) -> void override
+        {
+            if (!handle) {
+                return;
+            }
+
+            auto index{ currentWorkerIndex() };
+            if (!index) {
+                index = m_nextWorker.fetch_add(1, std::memory_order_relaxed) % m_workers.size();
+            }
+
+            // Counted before it is queued, so a worker popping it at once cannot take m_pending below zero
+            m_pending.fetch_add(1, std::memory_order_seq_cst);
+            utils::queue::push(m_workers[*index]->queue, handle, m_workers[*index]->mutex);
+
+            // A worker registers as a sleeper before it checks m_pending, so with nobody registered there
+            // is nobody to wake. Otherwise taking the park mutex orders the wake-up against its wait.
+            if (m_sleepers.load(std::memory_order_seq_cst) == 0) {
+                return;
+            }
+            { std::scoped_lock lock(m_parkMutex); }
+            m_parkCv.notify_one();
+        }
+
+        auto getLifeToken() -> std::weak_ptr<void> override { return m_lifeToken; }
+
+        auto threadCount() const -> size_t { return m_workers.size(); }
+
+      private:
+        struct Worker
+        {
+            std::mutex mutex{};
+            std::deque<std::coroutine_handle<>> queue{};
+        };
+
+        struct CurrentWorker
+        {
+            const ThreadPool* pool{ nullptr };
+            size_t index{ 0 };
+        };
+
+        static auto current() -> CurrentWorker&
+        {
+            static thread_local CurrentWorker s_current{};
+            return s_current;
+        }
+
+        auto currentWorkerIndex() const -> std::optional<size_t>
+        {
+            const auto& worker{ current() };
+            if (worker.pool != this) {
+                return std::nullopt;
+            }
+            return worker.index;
+        }
+
+        auto popLocal(size_t index) -> std::optional<std::coroutine_handle<>>
+        {
+            return utils::queue::pop(m_workers[index]->queue, m_workers[index]->mutex);
+        }
+
+        auto steal(size_t thief) -> std::optional<std::coroutine_handle<>>
+        {
+            const auto count{ m_workers.size() };
+            for (size_t offset = 1; offset < count; ++offset) {
+                auto& victim{ *m_workers[(thief + offset) % count] };
+                std::scoped_lock lock(victim.mutex);
+                if (!victim.queue.empty()) {
+                    auto handle{ victim.queue.back() };
+                    victim.queue.pop_back();
+                    return handle;
+                }
+            }
+            return std::nullopt;
+        }
+
+        auto workerLoop(size_t index) -> void
+        {
+            current() = { this, index };
+
+            while (true) {
+                auto handle{ popLocal(index) };
+                if (!handle) {
+                    handle = steal(index);
+                }
+
+                if (handle) {
+                    m_pending.fetch_sub(1, std::memory_order_acq_rel);
+                    if (*handle && !handle->done()) {
+                        handle->resume();
+                    }
+                    continue;
+                }
+
+                std::unique_lock lock(m_parkMutex);
+                m_sleepers.fetch_add(1, std::memory_order_seq_cst);
+                m_parkCv.wait(lock, [this] {
+                    return m_pending.load(std::memory_order_seq_cst) > 0 || !m_running;
+                });
+                m_sleepers.fetch_sub(1, std::memory_order_relaxed);
+                if (!m_running && m_pending.load(std::memory_order_acquire) == 0) {
+                    break;
+                }
+            }
+
+            current() = {};
+        }
+
+        auto joinThreads() -> void
+        {
+            for (auto& thread : m_threads) {
+                if (thread.joinable() && thread.get_id() != std::this_thread::get_id()) {
+                    thread.join();
+                }
+            }
+            m_threads.clear();
+        }
+
+        std::vector<std::unique_ptr<Worker>> m_workers{};
+        std::vector<std::thread> m_threads{};
+        std::atomic<size_t> m_nextWorker{ 0 };
+        std::atomic<size_t> m_pending{ 0 };
+        // Workers parked on m_parkCv or about to be; schedule() skips the wake-up while there are none.
+        std::atomic<size_t> m_sleepers{ 0 };
+
+        std::mutex m_parkMutex{};
+        std::condition_variable m_parkCv{};
+        bool m_running{ true };
+        bool m_started{ false };
+
+        std::shared_ptr<bool> m_lifeToken{ std::make_shared<bool>(true) };
+    };
+}
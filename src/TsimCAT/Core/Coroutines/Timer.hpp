@@ -0,0 +1,106 @@
+#pragma once
+
+#include "Priority.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <coroutine>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace core::coro
+{
+    class IExecutor;
+
+    using Clock = std::chrono::steady_clock;
+    using TimerId = uint64_t;
+
+    namespace detail
+    {
+        struct TimerEntry
+        {
+            Clock::time_point deadline{};
+            TimerId id{ 0 };
+            std::coroutine_handle<> handle{};
+            IExecutor* executor{ nullptr };
+            std::weak_ptr<void> lifeToken{};
+            Priority priority{ Priority::Normal };
+            std::function<void()> callback{}; // runs instead of resuming a handle when set
+        };
+
+        /**
+         * Min-heap of pending timers ordered by deadline, ties broken by insertion order.
+         * Not synchronized; the owning executor guards it with its own lock.
+         */
+        class TimerQueue
+        {
+          public:
+            auto add(Clock::time_point deadline,
+                     std::coroutine_handle<> handle,
+                     IExecutor* executor = nullptr,
+                     std::weak_ptr<void> lifeToken = {},
+                     Priority priority = Priority::Normal) -> TimerId
+            {
+                const auto id{ m_nextId++ };
+                m_heap.push_back({ deadline, id, handle, executor, std::move(lifeToken), priority });
+                std::ranges::push_heap(m_heap, later);
+                return id;
+            }
+
+            auto addCallback(Clock::time_point deadline, std::function<void()> callback) -> TimerId
+            {
+                const auto id{ m_nextId++ };
+                m_heap.push_back({ .deadline = deadline, .id = id, .callback = std::move(callback) });
+                std::ranges::push_heap(m_heap, later);
+                return id;
+            }
+
+            // Returns true if the timer was still pending. Linear in the number of timers, which stays
+            // small (one per sleeping coroutine).
+            auto cancel(TimerId id) -> bool
+            {
+                auto it{ std::ranges::find(m_heap, id, &TimerEntry::id) };
+                if (it == m_heap.end()) {
+                    return false;
+                }
+                m_heap.erase(it);
+                std::ranges::make_heap(m_heap, later);
+                return true;
+            }
+
+            auto nextDeadline() const -> std::optional<Clock::time_point>
+            {
+                if (m_heap.empty()) {
+                    return std::nullopt;
+                }
+                return m_heap.front().deadline;
+            }
+
+            auto popExpired(Clock::time_point now) -> std::optional<TimerEntry>
+            {
+                if (m_heap.empty() || m_heap.front().deadline > now) {
+                    return std::nullopt;
+                }
+                std::ranges::pop_heap(m_heap, later);
+                auto entry{ std::move(m_heap.back()) };
+                m_heap.pop_back();
+                return entry;
+            }
+
+            auto empty() const -> bool { return m_heap.empty(); }
+            auto size() const -> size_t { return m_heap.size(); }
+
+          private:
+            static auto later(const TimerEntry& lhs, const TimerEntry& rhs) -> bool
+            {
+                return lhs.deadline != rhs.deadline ? lhs.deadline > rhs.deadline : lhs.id > rhs.id;
+            }
+
+            std::vector<TimerEntry> m_heap{};
+            TimerId m_nextId{ 1 };
+        };
+    }
+}
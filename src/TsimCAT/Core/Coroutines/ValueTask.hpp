@@ -0,0 +1,88 @@
+#pragma once
+
+#include "Task.hpp"
+
+#include <chrono>
+#include <concepts>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace core::coro
+{
+    /**
+     * Result of an operation that usually completes inline. Holds either the value itself, which
+     * co_await hands back without allocating or suspending, or a Task that is awaited as usual.
+     *
+     * A function returning ValueTask<T> may be a coroutine (its frame becomes the Task) or a plain
+     * function returning a T. Unlike a Task, a ready ValueTask has already done its work by the time
+     * it is returned.
+     */
+    template<typename T>
+    class ValueTask
+    {
+      public:
+        static_assert(!std::is_void_v<T>, "ValueTask carries a value; use Task<void>");
+
+        using promise_type = detail::TaskPromise<T>;
+
+        template<typename U>
+            requires std::constructible_from<T, U&&> && (!std::same_as<std::remove_cvref_t<U>, Task<T>>) &&
+                     (!std::same_as<std::remove_cvref_t<U>, ValueTask>)
+        ValueTask(U&& value) : m_state{ std::in_place_index<0>, std::forward<U>(value) }
+        {
+        }
+        ValueTask(Task<T> task) : m_state{ std::in_place_index<1>, std::move(task) } {}
+
+        ValueTask(ValueTask&&) noexcept = default;
+        auto operator=(ValueTask&&) noexcept -> ValueTask& = default;
+
+        auto isReady() const -> bool { return m_state.index() == 0; }
+
+        auto await_ready() const noexcept -> bool { return isReady() || std::get<1>(m_state).await_ready(); }
+
+        // The pending task is awaited through the generic await_transform, so it inherits the awaiting
+        // coroutine's executor and stop token here instead.
+        template<typename P>
+        auto await_suspend(std::coroutine_handle<P> handle) noexcept -> std::coroutine_handle<>
+        {
+            auto& task{ std::get<1>(m_state) };
+            if constexpr (requires { handle.promise().executor; }) {
+                detail::inheritFrom(task, handle.promise());
+            }
+            return task.await_suspend(handle);
+        }
+
+        auto await_resume() -> T
+        {
+            if (isReady()) {
+                return std::move(std::get<0>(m_state));
+            }
+            return std::get<1>(m_state).await_resume();
+        }
+
+        // For APIs that take a Task (whenAll, whenAny). A ready value is wrapped in a frame of its own.
+        auto toTask() && -> Task<T>
+        {
+            if (isReady()) {
+                return ready(std::move(std::get<0>(m_state)));
+            }
+            return std::move(std::get<1>(m_state));
+        }
+
+      private:
+        static auto ready(T value) -> Task<T> { co_return value; }
+
+        std::variant<T, Task<T>> m_state;
+    };
+
+    // A ready ValueTask is returned as is; the deadline only applies to work still pending.
+    template<typename T>
+    auto withTimeout(ValueTask<T> task, std::chrono::milliseconds timeout) -> ValueTask<T>
+    {
+        if (task.isReady() || timeout <= std::chrono::milliseconds::zero()) {
+            return task;
+        }
+        return withTimeout(std::move(task).toTask(), timeout);
+    }
+}
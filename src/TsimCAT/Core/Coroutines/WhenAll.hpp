@@ -0,0 +1,301 @@
+#pragma once
+
+#include "Cancellation.hpp"
+#include "Task.hpp"
+
+#include <array>
+#include <atomic>
+#include <limits>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <stop_token>
+#include <tuple>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace core::coro
+{
+    namespace detail
+    {
+        // Result slot of a child task; void children report std::monostate.
+        template<typename T>
+        using ValueOf = std::conditional_t<std::is_void_v<T>, std::monostate, T>;
+
+        // Completion state shared by the children of one whenAll/whenAny. `pending` starts one above the
+        // number of children so that none of them can resume the waiter before all have been started.
+        struct Join
+        {
+            static constexpr size_t NONE{ std::numeric_limits<size_t>::max() };
+
+            explicit Join(size_t count) : pending{ count + 1 } {}
+
+            std::atomic<size_t> pending;
+            std::coroutine_handle<> waiter{};
+            std::stop_source* race{ nullptr }; // set by whenAny: stopped once the first child finishes
+            std::atomic<size_t> winner{ NONE };
+
+            auto finish(size_t index) -> std::coroutine_handle<>
+            {
+                if (race) {
+                    auto none{ NONE };
+                    if (winner.compare_exchange_strong(none, index, std::memory_order_acq_rel)) {
+                        race->request_stop();
+                    }
+                }
+                return arrive();
+            }
+
+            auto arrive() -> std::coroutine_handle<>
+            {
+                if (pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                    return waiter;
+                }
+                return std::noop_coroutine();
+            }
+        };
+
+        struct BranchPromise;
+
+        // Runs one child task of a join. Owned by the joining coroutine, which outlives every branch.
+        class Branch
+        {
+          public:
+            using promise_type = BranchPromise;
+            using handle_type = std::coroutine_handle<promise_type>;
+
+            Branch(handle_type handle) : m_handle{ handle } {}
+            ~Branch()
+            {
+                if (m_handle) {
+                    m_handle.destroy();
+                }
+            }
+
+            Branch(const Branch&) = delete;
+            auto operator=(const Branch&) -> Branch& = delete;
+            Branch(Branch&& other) noexcept : m_handle{ std::exchange(other.m_handle, nullptr) } {}
+            auto operator=(Branch&&) -> Branch& = delete;
+
+            auto start(Join& join,
+                       size_t index,
+                       IExecutor* executor,
+                       std::stop_token token,
+                       Priority priority) -> void;
+            auto rethrow() const -> void;
+
+          private:
+            handle_type m_handle;
+        };
+
+        struct BranchPromise : PooledFrame
+        {
+            Join* join{ nullptr };
+            size_t index{ 0 };
+            IExecutor* executor{ nullptr };
+            std::stop_token stopToken{};
+            std::optional<Priority> priority{};
+            std::exception_ptr exception{};
+
+            auto get_return_object() -> Branch { return Branch::handle_type::from_promise(*this); }
+            auto initial_suspend() -> std::suspend_always { return {}; }
+            auto final_suspend() noexcept
+            {
+                struct awaiter
+                {
+                    auto await_ready() noexcept -> bool { return false; }
+                    auto await_suspend(std::coroutine_handle<BranchPromise> h) noexcept
+                      -> std::coroutine_handle<>
+                    {
+                        return h.promise().join->finish(h.promise().index);
+                    }
+                    auto await_resume() noexcept -> void {}
+                };
+                return awaiter{};
+            }
+            auto unhandled_exception() -> void { exception = std::current_exception(); }
+            auto return_void() -> void {}
+            template<typename U>
+            auto await_transform(Task<U>&& childTask) -> Task<U>&&
+            {
+                inheritFrom(childTask, *this);
+                return std::move(childTask);
+            }
+            template<typename U>
+            auto await_transform(U&& awaitable) -> U&& { return std::forward<U>(awaitable); }
+        };
+
+        inline auto Branch::start(
+          Join& join, size_t index, IExecutor* executor, std::stop_token token, Priority priority) -> void
+        {
+            auto& promise{ m_handle.promise() };
+            promise.join = &join;
+            promise.index = index;
+            promise.executor = executor;
+            promise.stopToken = std::move(token);
+            promise.priority = priority;
+            m_handle.resume();
+        }
+
+        inline auto Branch::rethrow() const -> void
+        {
+            if (m_handle.promise().exception) {
+                std::rethrow_exception(m_handle.promise().exception);
+            }
+        }
+
+        template<typename T>
+        auto runBranch(Task<T> task, std::optional<ValueOf<T>>& slot) -> Branch
+        {
+            if constexpr (std::is_void_v<T>) {
+                co_await std::move(task);
+                slot.emplace();
+            }
+            else {
+                auto value{ co_await std::move(task) };
+                slot.emplace(std::move(value));
+            }
+        }
+
+        // Starts every branch on the joining coroutine's executor and priority and suspends it until all
+        // have finished. Branches see the race token of a whenAny, otherwise the joining coroutine's own.
+        struct JoinAwaiter
+        {
+            Join* join{ nullptr };
+            std::span<Branch> branches{};
+
+            auto await_ready() const -> bool { return false; }
+
+            template<typename P>
+            auto await_suspend(std::coroutine_handle<P> handle) -> bool
+            {
+                IExecutor* executor{ nullptr };
+                if constexpr (requires { handle.promise().executor; }) {
+                    executor = handle.promise().executor;
+                }
+                const auto token{ join->race ? join->race->get_token() : stopTokenOf(handle) };
+                const auto priority{ priorityOf(handle) };
+
+                join->waiter = handle;
+                for (size_t i{ 0 }; i < branches.size(); ++i) {
+                    branches[i].start(*join, i, executor, token, priority);
+                }
+                return join->pending.fetch_sub(1, std::memory_order_acq_rel) != 1;
+            }
+
+            auto await_resume() const -> void {}
+        };
+
+        template<size_t... I, typename... Ts>
+        auto joinAll(std::index_sequence<I...>, Task<Ts>... tasks) -> Task<std::tuple<ValueOf<Ts>...>>
+        {
+            std::tuple<std::optional<ValueOf<Ts>>...> slots{};
+            std::array<Branch, sizeof...(Ts)> branches{ runBranch(std::move(tasks), std::get<I>(slots))... };
+            Join join{ sizeof...(Ts) };
+            co_await JoinAwaiter{ &join, branches };
+
+            (branches[I].rethrow(), ...);
+            co_return std::tuple<ValueOf<Ts>...>{ std::move(*std::get<I>(slots))... };
+        }
+
+        template<size_t... I, typename... Ts>
+        auto joinAny(std::index_sequence<I...>, Task<Ts>... tasks) -> Task<std::variant<ValueOf<Ts>...>>
+        {
+            const auto parent{ co_await currentStopToken() };
+            std::stop_source race{};
+            std::stop_callback forward{ parent, [&race] { race.request_stop(); } };
+
+            std::tuple<std::optional<ValueOf<Ts>>...> slots{};
+            std::array<Branch, sizeof...(Ts)> branches{ runBranch(std::move(tasks), std::get<I>(slots))... };
+            Join join{ sizeof...(Ts) };
+            join.race = &race;
+            co_await JoinAwaiter{ &join, branches };
+
+            const auto winner{ join.winner.load(std::memory_order_acquire) };
+            branches[winner].rethrow();
+            std::optional<std::variant<ValueOf<Ts>...>> result{};
+            ((I == winner ? (result.emplace(std::in_place_index<I>, std::move(*std::get<I>(slots))), 0) : 0),
+             ...);
+            co_return std::move(*result);
+        }
+    }
+
+    /**
+     * Runs all tasks concurrently and completes once every one of them has, with their results in
+     * argument order (std::monostate for void tasks). Each task starts on the awaiting coroutine's
+     * executor and shares its stop token. If any task throws, the first exception in argument order is
+     * rethrown after all have finished.
+     */
+    template<typename... Ts>
+    auto whenAll(Task<Ts>... tasks) -> Task<std::tuple<detail::ValueOf<Ts>...>>
+    {
+        return detail::joinAll(std::index_sequence_for<Ts...>{}, std::move(tasks)...);
+    }
+
+    template<typename T>
+    auto whenAll(std::vector<Task<T>> tasks)
+      -> Task<std::conditional_t<std::is_void_v<T>, void, std::vector<T>>>
+    {
+        std::vector<std::optional<detail::ValueOf<T>>> slots(tasks.size());
+        std::vector<detail::Branch> branches{};
+        branches.reserve(tasks.size());
+        for (size_t i{ 0 }; i < tasks.size(); ++i) {
+            branches.push_back(detail::runBranch(std::move(tasks[i]), slots[i]));
+        }
+        detail::Join join{ branches.size() };
+        co_await detail::JoinAwaiter{ &join, branches };
+
+        for (const auto& branch : branches) {
+            branch.rethrow();
+        }
+        if constexpr (!std::is_void_v<T>) {
+            std::vector<T> values{};
+            values.reserve(slots.size());
+            for (auto& slot : slots) {
+                values.push_back(std::move(*slot));
+            }
+            co_return values;
+        }
+    }
+
+    /**
+     * Runs all tasks concurrently and yields the result of the first to finish; the variant index
+     * tells which one it was. The others are then asked to stop through their stop token, and whenAny
+     * completes once they have wound down, so no task outlives the call. Their results and exceptions
+     * are discarded. A read raced against a sleep therefore returns as soon as either is done.
+     */
+    template<typename... Ts>
+    auto whenAny(Task<Ts>... tasks) -> Task<std::variant<detail::ValueOf<Ts>...>>
+    {
+        static_assert(sizeof...(Ts) > 0, "whenAny needs at least one task");
+        return detail::joinAny(std::index_sequence_for<Ts...>{}, std::move(tasks)...);
+    }
+
+    // Range form of whenAny: yields the index of the first task to finish together with its result.
+    template<typename T>
+    auto whenAny(std::vector<Task<T>> tasks) -> Task<std::pair<size_t, detail::ValueOf<T>>>
+    {
+        if (tasks.empty()) {
+            throw std::invalid_argument("whenAny needs at least one task");
+        }
+
+        const auto parent{ co_await currentStopToken() };
+        std::stop_source race{};
+        std::stop_callback forward{ parent, [&race] { race.request_stop(); } };
+
+        std::vector<std::optional<detail::ValueOf<T>>> slots(tasks.size());
+        std::vector<detail::Branch> branches{};
+        branches.reserve(tasks.size());
+        for (size_t i{ 0 }; i < tasks.size(); ++i) {
+            branches.push_back(detail::runBranch(std::move(tasks[i]), slots[i]));
+        }
+        detail::Join join{ branches.size() };
+        join.race = &race;
+        co_await detail::JoinAwaiter{ &join, branches };
+
+        const auto winner{ join.winner.load(std::memory_order_acquire) };
+        branches[winner].rethrow();
+        co_return std::pair<size_t, detail::ValueOf<T>>{ winner, std::move(*slots[winner]) };
+    }
+}
@@ -1,10 +1,20 @@
 #pragma once
 
+#include "Cancellation.hpp"
 #include "Channel.hpp"
 #include "Context.hpp"
+#include "ExecutorMonitor.hpp"
+#include "Generator.hpp"
+#include "Priority.hpp"
+#include "Strand.hpp"
+#include "Sync.hpp"
 #include "Task.hpp"
+#include "ThreadPool.hpp"
+#include "ValueTask.hpp"
+#include "WhenAll.hpp"
 
 #include <functional>
+#include <stop_token>
 
 namespace core::coro
 {
@@ -17,10 +27,25 @@ namespace core::coro
         }
     }
 
+    // `stopToken` is handed down to every task the spawned coroutine awaits; requesting stop on its
+    // source makes pending sleeps, channel reads and blocking calls give up.
     template<Executor Ex, std::invocable<Ex&> Coro>
-    auto co_spawn(Ex& ex, Coro&& coro) -> void
+    auto co_spawn(Ex& ex, Coro&& coro, std::stop_token stopToken = {}) -> void
     {
         auto detached{ detail::co_spawn_impl(ex, std::forward<Coro>(coro)) };
+        detached.getHandle().promise().executor = &ex;
+        detached.getHandle().promise().stopToken = std::move(stopToken);
         ex.schedule(detached.getHandle());
     }
+
+    // Spawns into a priority lane; the class is inherited by every task the coroutine awaits.
+    template<Executor Ex, std::invocable<Ex&> Coro>
+    auto co_spawn(Ex& ex, Coro&& coro, Priority priority, std::stop_token stopToken = {}) -> void
+    {
+        auto detached{ detail::co_spawn_impl(ex, std::forward<Coro>(coro)) };
+        detached.getHandle().promise().executor = &ex;
+        detached.getHandle().promise().stopToken = std::move(stopToken);
+        detached.getHandle().promise().priority = priority;
+        ex.schedule(detached.getHandle(), priority);
+    }
 }
\ No newline at end of file
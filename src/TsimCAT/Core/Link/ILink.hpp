@@ -8,6 +8,9 @@
 namespace core::link
 {
     static constexpr std::chrono::milliseconds NO_TIMEOUT{ std::chrono::milliseconds(0) };
+    // Blocking requests a single remote link may have on the BlockingPool at once, so one hung
+    // connection cannot occupy every pool thread. Further requests wait without blocking their executor.
+    static constexpr size_t MAX_PENDING_REQUESTS{ 2 };
 
     enum class Status { Disconnected, Connecting, Connected, Faulty };
     enum class Role { Server, Client };
@@ -1,5 +1,7 @@
 #include "LinkFactory.hpp"
 #include "Raw/TcpServer.hpp"
+#include "Replay/RecordingLink.hpp"
+#include "Replay/ReplayLink.hpp"
 #include "Symbolic/AdsClient.hpp"
 #include "Symbolic/LocalAdsLink.hpp"
 #include "Symbolic/OpcUaClient.hpp"
@@ -8,28 +10,71 @@
 
 namespace core::link
 {
-    auto create(Role role, Mode mode, Protocol proto, const LinkConfig& config)
-      -> result::Result<std::unique_ptr<ILink>>
+    namespace
     {
-        if (mode == Mode::Raw) {
-            if (role == Role::Server && proto == Protocol::Tcp) {
-                return std::make_unique<raw::TcpServer>(config.port);
+        auto makeLink(Role role, Mode mode, Protocol proto, const LinkConfig& config)
+          -> result::Result<std::unique_ptr<ILink>>
+        {
+            if (mode == Mode::Raw) {
+                if (role == Role::Server && proto == Protocol::Tcp) {
+                    return std::make_unique<raw::TcpServer>(config.port);
+                }
             }
-        }
 
-        if (mode == Mode::Symbolic && role == Role::Client) {
-            if (proto == Protocol::Ads) {
-                if (config.inProcess) {
-                    return std::make_unique<symbolic::LocalAdsLink>(config.instanceName);
+            if (mode == Mode::Symbolic && role == Role::Client) {
+                if (proto == Protocol::Ads) {
+                    if (config.inProcess && !config.sharedImage.empty()) {
+                        auto segment = symbolic::ProcessImage::mapShared(
+                          config.sharedImage, config.sharedImageSymbols, config.sharedImageBytes);
+                        if (!segment) {
+                            return std::unexpected(segment.error());
+                        }
+                        return std::make_unique<symbolic::LocalAdsLink>(config.instanceName,
+                                                                        std::move(*segment));
+                    }
+                    if (config.inProcess) {
+                        return std::make_unique<symbolic::LocalAdsLink>(config.instanceName);
+                    }
+                    return std::make_unique<symbolic::AdsClient>(
+                      config.remoteNetId, config.ip, config.port, config.localNetId);
+                }
+                if (proto == Protocol::OpcUa) {
+                    return std::make_unique<symbolic::OpcUaClient>(config.ip);
                 }
-                return std::make_unique<symbolic::AdsClient>(
-                  config.remoteNetId, config.ip, config.port, config.localNetId);
             }
-            if (proto == Protocol::OpcUa) {
-                return std::make_unique<symbolic::OpcUaClient>(config.ip);
+
+            return std::unexpected(std::make_error_code(std::errc::invalid_argument));
+        }
+    }
+
+    auto create(Role role, Mode mode, Protocol proto, const LinkConfig& config)
+      -> result::Result<std::unique_ptr<ILink>>
+    {
+        if (!config.replayFrom.empty()) {
+            auto replay = replay::ReplayLink::open(config.replayFrom, config.replaySpeed);
+            if (!replay) {
+                return std::unexpected(replay.error());
+            }
+            if ((*replay)->getRole() != role || (*replay)->getMode() != mode) {
+                return std::unexpected(std::make_error_code(std::errc::invalid_argument));
             }
+            return std::move(*replay);
         }
 
-        return std::unexpected(std::make_error_code(std::errc::invalid_argument));
+        // Simulators reach an in-process link's handles directly, which a RecordingLink would hide and
+        // could not log.
+        if (config.inProcess && !config.recordTo.empty()) {
+            return std::unexpected(std::make_error_code(std::errc::invalid_argument));
+        }
+
+        auto link = makeLink(role, mode, proto, config);
+        if (!link || config.recordTo.empty()) {
+            return link;
+        }
+        auto recording = replay::RecordingLink::open(std::move(*link), config.recordTo);
+        if (!recording) {
+            return std::unexpected(recording.error());
+        }
+        return std::move(*recording);
     }
-}
+}
\ No newline at end of file
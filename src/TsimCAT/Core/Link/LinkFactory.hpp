@@ -15,6 +15,17 @@ namespace core::link
         std::string remoteNetId;
         bool inProcess{ false };
         std::string instanceName{ "default" };
+        // In-process ADS only: names a shared-memory process image other processes can map. The sizes
+        // apply when this link creates it.
+        std::string sharedImage;
+        size_t sharedImageSymbols{ 4096 };
+        size_t sharedImageBytes{ 1024 * 1024 };
+        // Logs the link's traffic to this file through a replay::RecordingLink. Not for in-process links.
+        std::string recordTo;
+        // Serves a recorded log instead of opening a link; the role and mode must match the recording's.
+        // `replaySpeed` scales its timing, 0 serving it as fast as possible.
+        std::string replayFrom;
+        double replaySpeed{ 1.0 };
     };
 
     auto create(Role role, Mode mode, Protocol proto, const LinkConfig& config)
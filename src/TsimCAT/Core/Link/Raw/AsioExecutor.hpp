@@ -0,0 +1,188 @@
+#pragma once
+
+#include "Coroutines/Context.hpp"
+
+#include <asio.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+
+namespace core::link::raw
+{
+    /**
+     * IExecutor backed by an asio::io_context, so socket completions, asio timers and coroutine
+     * resumes share one reactor and one thread. Raw links built on the same AsioExecutor add no
+     * threads of their own, and a coroutine running here resumes inline when its I/O completes.
+     *
+     * Handles run in FIFO order; Priority is not honoured. run() blocks until stop(), which lets the
+     * handles already posted run first but does not wait for pending I/O; start() runs it on a new
+     * thread. shared() is the process-wide reactor on its own thread, used by links that are not given
+     * one.
+     */
+    class AsioExecutor : public coro::IExecutor
+    {
+      public:
+        AsioExecutor() = default;
+
+        AsioExecutor(const AsioExecutor&) = delete;
+        auto operator=(const AsioExecutor&) -> AsioExecutor& = delete;
+        AsioExecutor(AsioExecutor&&) = delete;
+        auto operator=(AsioExecutor&&) -> AsioExecutor& = delete;
+
+        static auto shared() -> AsioExecutor&;
+
+        auto run() -> void override
+        {
+            auto* previous{ std::exchange(s_current, this) };
+            m_running.store(true, std::memory_order_release);
+            m_context.run();
+            m_running.store(false, std::memory_order_release);
+            s_current = previous;
+        }
+
+        // Runs the reactor on a new thread. It counts as running from here on, so an invoke() made
+        // before the thread reaches run() is posted to it instead of running alongside it.
+        [[nodiscard]] auto start() -> std::jthread
+        {
+            m_running.store(true, std::memory_order_release);
+            return std::jthread{ [this] { run(); } };
+        }
+
+        auto stop() -> void override
+        {
+            asio::post(m_context, [this] {
+                m_work.reset();
+                m_context.stop();
+            });
+        }
+
+        auto schedule(std::coroutine_handle<> handle) -> void override
+        {
+            asio::post(m_context, [this, handle] {
+                m_counters.countResume();
+                handle.resume();
+            });
+        }
+
+        auto scheduleAt(coro::Clock::time_point deadline,
+                        std::coroutine_handle<> handle,
+                        coro::Priority = coro::Priority::Normal) -> coro::TimerId override
+        {
+            auto timer{ std::make_shared<asio::steady_timer>(m_context, deadline) };
+            coro::TimerId id{};
+            {
+                std::scoped_lock lock(m_timerMutex);
+                id = m_nextTimerId++;
+                m_timers.emplace(id, timer);
+            }
+            timer->async_wait([this, id, handle, timer](const asio::error_code&) {
+                // Whoever removes the entry owns the timer: here it fires, in cancelTimer() it does not.
+                {
+                    std::scoped_lock lock(m_timerMutex);
+                    if (m_timers.erase(id) == 0) {
+                        return;
+                    }
+                }
+                m_counters.countResume();
+                handle.resume();
+            });
+            return id;
+        }
+
+        auto cancelTimer(coro::TimerId id) -> bool override
+        {
+            std::shared_ptr<asio::steady_timer> timer{};
+            {
+                std::scoped_lock lock(m_timerMutex);
+                auto it{ m_timers.find(id) };
+                if (it == m_timers.end()) {
+                    return false;
+                }
+                timer = std::move(it->second);
+                m_timers.erase(it);
+            }
+            invoke([&timer] { timer->cancel(); });
+            return true;
+        }
+
+        auto getLifeToken() -> std::weak_ptr<void> override { return m_lifeToken; }
+
+        auto stats() const -> coro::ExecutorStats override
+        {
+            coro::ExecutorStats stats{ .takenAt = coro::Clock::now() };
+            m_counters.fill(stats);
+            return stats;
+        }
+
+        // Runs `fn` on the reactor thread and waits for it. asio I/O objects are not thread-safe, so
+        // other threads close and cancel through here. Runs inline on the reactor thread, and when no
+        // thread is running the reactor. A thread that calls run() itself only counts once it is inside;
+        // start() closes that gap.
+        auto invoke(const std::function<void()>& fn) -> void
+        {
+            if (runningInThisThread() || !m_running.load(std::memory_order_acquire)) {
+                fn();
+                return;
+            }
+
+            struct Call
+            {
+                std::atomic<bool> claimed{ false };
+                std::promise<void> done{};
+            };
+            auto call{ std::make_shared<Call>() };
+            auto finished{ call->done.get_future() };
+            asio::post(m_context, [call, &fn] {
+                if (!call->claimed.exchange(true)) {
+                    fn();
+                    call->done.set_value();
+                }
+            });
+            // If the reactor stops before getting to the call, take it back and run it here.
+            while (finished.wait_for(std::chrono::milliseconds{ 1 }) != std::future_status::ready) {
+                if (!m_running.load(std::memory_order_acquire) && !call->claimed.exchange(true)) {
+                    fn();
+                    return;
+                }
+            }
+        }
+
+        // True while the calling thread is inside this executor's run().
+        auto runningInThisThread() const -> bool { return s_current == this; }
+
+        auto context() -> asio::io_context& { return m_context; }
+
+      private:
+        static inline thread_local const AsioExecutor* s_current{ nullptr };
+
+        asio::io_context m_context{ 1 };
+        asio::executor_work_guard<asio::io_context::executor_type> m_work{ m_context.get_executor() };
+        std::atomic<bool> m_running{ false };
+        std::mutex m_timerMutex{};
+        std::unordered_map<coro::TimerId, std::shared_ptr<asio::steady_timer>> m_timers{};
+        coro::TimerId m_nextTimerId{ 1 };
+        coro::detail::ExecutorCounters m_counters{};
+        std::shared_ptr<bool> m_lifeToken{ std::make_shared<bool>(true) };
+    };
+
+    inline auto AsioExecutor::shared() -> AsioExecutor&
+    {
+        struct SharedReactor
+        {
+            AsioExecutor executor{};
+            std::jthread thread{ executor.start() };
+
+            ~SharedReactor() { executor.stop(); }
+        };
+
+        static SharedReactor s_reactor;
+        return s_reactor.executor;
+    }
+}
@@ -5,6 +5,7 @@
 #include "Common/Result.hpp"
 
 #include "Coroutines/Task.hpp"
+#include "Coroutines/ValueTask.hpp"
 
 #include <span>
 #include <string_view>
@@ -17,22 +18,31 @@ namespace core::link
         auto asRaw() -> IRawLink* override { return this; }
         auto getMode() const -> Mode override { return Mode::Raw; }
 
+        // Transports that complete inline may return a ready ValueTask instead of a pending Task.
         virtual auto receiveInto(std::string_view path,
                                  std::span<std::byte> dest,
                                  std::chrono::milliseconds timeout = NO_TIMEOUT)
-          -> coro::Task<result::Result<size_t>> = 0;
+          -> coro::ValueTask<result::Result<size_t>> = 0;
 
         virtual auto sendFrom(std::string_view path,
                               std::span<const std::byte> src,
                               std::chrono::milliseconds timeout = NO_TIMEOUT)
-          -> coro::Task<result::Result<void>> = 0;
+          -> coro::ValueTask<result::Result<void>> = 0;
 
+        // The typed helpers bound the whole call by `timeout` through the caller's stop token: once it
+        // elapses they return std::errc::timed_out even if the driver underneath is still blocked. A
+        // caller that has already been stopped is refused before the link is touched.
         template<typename T>
         auto receive(std::string_view path, std::chrono::milliseconds timeout = NO_TIMEOUT)
           -> coro::Task<result::Result<T>>
         {
+            const auto stopToken{ co_await coro::currentStopToken() };
+            if (stopToken.stop_requested()) {
+                co_return std::unexpected(std::make_error_code(std::errc::operation_canceled));
+            }
             T value{};
-            auto res{ co_await receiveInto(path, std::as_writable_bytes(std::span{ &value, 1 }), timeout) };
+            auto res{ co_await coro::withTimeout(
+              receiveInto(path, std::as_writable_bytes(std::span{ &value, 1 }), timeout), timeout) };
             if (!res) {
                 co_return std::unexpected(res.error());
             }
@@ -42,7 +52,13 @@ namespace core::link
         auto send(std::string_view path, const auto& value, std::chrono::milliseconds timeout = NO_TIMEOUT)
           -> coro::Task<result::Result<void>>
         {
-            co_return co_await sendFrom(path, std::as_bytes(std::span{ &value, 1 }), timeout);
+            const auto stopToken{ co_await coro::currentStopToken() };
+            if (stopToken.stop_requested()) {
+                co_return std::unexpected(std::make_error_code(std::errc::operation_canceled));
+            }
+            auto res{ co_await coro::withTimeout(
+              sendFrom(path, std::as_bytes(std::span{ &value, 1 }), timeout), timeout) };
+            co_return res;
         }
     };
 }
\ No newline at end of file
@@ -4,34 +4,52 @@
 #include "format_utils.hpp"
 
 #include <optional>
-#include <thread>
 #include <variant>
 
 namespace
 {
+    using core::link::raw::AsioExecutor;
+
+    // Runs an asio awaitable on the reactor and continues the awaiting coroutine on its own executor.
+    // A coroutine that already lives on the reactor is resumed inline, without another post.
     template<typename T>
     struct AsioAwaiter
     {
-        asio::io_context& ctx;
+        AsioExecutor& reactor;
         asio::awaitable<T> task;
-        std::optional<T> result;
-        std::exception_ptr ex;
+        std::optional<T> result{};
+        std::exception_ptr error{};
+
+        auto await_ready() const noexcept -> bool { return false; }
 
-        bool await_ready() { return false; }
-        void await_suspend(std::coroutine_handle<> h)
+        template<typename P>
+        auto await_suspend(std::coroutine_handle<P> awaiting) -> void
         {
-            asio::co_spawn(ctx, std::move(task), [this, h](std::exception_ptr e, T r) mutable {
-                if (e)
-                    ex = e;
-                else
-                    result = std::move(r);
-                h.resume();
-            });
+            asio::co_spawn(
+              reactor.context(),
+              std::move(task),
+              [this, awaiting, target = core::coro::detail::ResumeTarget::of(awaiting)](std::exception_ptr e,
+                                                                                        T value) {
+                  if (e) {
+                      error = e;
+                  }
+                  else {
+                      result = std::move(value);
+                  }
+                  if (target.executor == &reactor) {
+                      awaiting.resume();
+                  }
+                  else {
+                      target.resume(awaiting);
+                  }
+              });
         }
-        T await_resume()
+
+        auto await_resume() -> T
         {
-            if (ex)
-                std::rethrow_exception(ex);
+            if (error) {
+                std::rethrow_exception(error);
+            }
             return std::move(*result);
         }
     };
@@ -40,9 +58,10 @@ namespace
 namespace core::link::raw
 {
 
-    TcpServer::TcpServer(uint16_t port)
-      : m_acceptor{ m_context, asio::ip::tcp::endpoint{ asio::ip::address_v4(), port } }
-      , m_socket{ m_context }
+    TcpServer::TcpServer(uint16_t port, AsioExecutor& reactor)
+      : m_reactor{ reactor }
+      , m_acceptor{ reactor.context(), asio::ip::tcp::endpoint{ asio::ip::address_v4(), port } }
+      , m_socket{ reactor.context() }
     {
     }
 
@@ -53,81 +72,37 @@ namespace core::link::raw
 
     auto TcpServer::start() -> result::Result<void>
     {
-        if (m_thread.joinable()) {
-            return result::success();
-        }
-
         m_status = Status::Disconnected;
-        // Capture work guard to keep run() alive
-        m_thread = std::thread([this, work = asio::make_work_guard(m_context)]() { m_context.run(); });
-
         return result::success();
     }
 
     auto TcpServer::stop() -> result::Result<void>
     {
         m_status = Status::Disconnected;
-        if (!m_context.stopped()) {
-            m_context.stop();
-        }
-        if (m_thread.joinable()) {
-            m_thread.join();
-        }
-        if (m_socket.is_open()) {
-            m_socket.close();
-        }
-        
-        // Reset context for potential restart
-        m_context.restart();
+        // Pending accepts and transfers complete with operation_aborted and resume their callers.
+        m_reactor.invoke([this] {
+            asio::error_code ec;
+            m_acceptor.cancel(ec);
+            m_socket.close(ec);
+        });
         return result::success();
     }
 
     auto TcpServer::accept(std::chrono::milliseconds timeout) -> coro::Task<result::Result<void>>
     {
-        if (m_socket.is_open()) {
+        m_reactor.invoke([this] {
             asio::error_code ec;
             m_socket.close(ec);
-        }
+        });
 
         m_status = Status::Connecting;
-        auto res = co_await AsioAwaiter<result::Result<void>>{
-            m_context,
-            [&]() -> asio::awaitable<result::Result<void>> {
-                // If timeout > 0, we need a timer.
-                // However, commonly accept might block indefinitely.
-                // Using timeout if provided.
-
-                using namespace asio::experimental::awaitable_operators;
-                
-                try {
-                    if (timeout != NO_TIMEOUT) {
-                        asio::steady_timer timer(co_await asio::this_coro::executor);
-                        timer.expires_after(timeout);
-                        
-                        // We need a wrapper to match return types or handle the variant
-                        auto result = co_await (m_acceptor.async_accept(m_socket, asio::use_awaitable) ||
-                                                timer.async_wait(asio::use_awaitable));
-                        
-                        if (result.index() == 0) {
-                            co_return result::success();
-                        } else {
-                            co_return std::unexpected(make_error_code(asio::error::timed_out));
-                        }
-                    } else {
-                        co_await m_acceptor.async_accept(m_socket, asio::use_awaitable);
-                        co_return result::success();
-                    }
-                } catch (const std::exception& ex) {
-                    // map asio error?
-                     co_return std::unexpected(make_error_code(asio::error::basic_errors::connection_aborted));
-                }
-            }()
-        };
+        AsioAwaiter<result::Result<void>> accepting{ m_reactor, acceptOn(timeout) };
+        auto res = co_await std::move(accepting);
 
         if (res) {
             m_status = Status::Connected;
         } else {
-            m_status = Status::Faulty; 
+            m_status = Status::Faulty;
         }
         co_return res;
     }
@@ -142,73 +117,106 @@ namespace core::link::raw
 
     auto TcpServer::receiveInto(std::string_view path,
                                 std::span<std::byte> dest,
-                                std::chrono::milliseconds timeout) -> coro::Task<result::Result<size_t>>
+                                std::chrono::milliseconds timeout) -> coro::ValueTask<result::Result<size_t>>
     {
         if (!m_socket.is_open()) {
             co_return std::unexpected(make_error_code(asio::error::not_connected));
         }
 
-        co_return co_await AsioAwaiter<result::Result<size_t>>{
-            m_context,
-            [&]() -> asio::awaitable<result::Result<size_t>> {
-                try {
-                    if (timeout != NO_TIMEOUT) {
-                        asio::steady_timer timer(co_await asio::this_coro::executor);
-                        timer.expires_after(timeout);
-
-                        using namespace asio::experimental::awaitable_operators;
-                        auto result = co_await (m_socket.async_read_some(asio::buffer(dest), asio::use_awaitable) ||
-                                                timer.async_wait(asio::use_awaitable));
-
-                        if (result.index() == 0) {
-                            co_return std::get<0>(result);
-                        }
-                        co_return std::unexpected(make_error_code(asio::error::timed_out));
-                    } else {
-                        auto result = co_await m_socket.async_read_some(asio::buffer(dest), asio::use_awaitable);
-                        co_return result;
-                    }
-                } catch (const asio::system_error& ex) {
-                    co_return std::unexpected(ex.code());
-                } catch (...) {
-                    co_return std::unexpected(make_error_code(asio::error::basic_errors::network_down));
-                }
-            }()
-        };
+        AsioAwaiter<result::Result<size_t>> reading{ m_reactor, readSome(dest, timeout) };
+        co_return co_await std::move(reading);
     }
 
     auto TcpServer::sendFrom(std::string_view path,
                              std::span<const std::byte> src,
-                             std::chrono::milliseconds timeout) -> coro::Task<result::Result<void>>
+                             std::chrono::milliseconds timeout) -> coro::ValueTask<result::Result<void>>
     {
         if (!m_socket.is_open()) {
             co_return std::unexpected(make_error_code(asio::error::not_connected));
         }
 
-        co_return co_await AsioAwaiter<result::Result<void>>{
-            m_context,
-            [&]() -> asio::awaitable<result::Result<void>> {
-                try {
-                    if (timeout != NO_TIMEOUT) {
-                        asio::steady_timer timer(co_await asio::this_coro::executor);
-                        timer.expires_after(timeout);
-                        using namespace asio::experimental::awaitable_operators;
-                        auto result = co_await (asio::async_write(m_socket, asio::buffer(src), asio::use_awaitable) ||
-                                                timer.async_wait(asio::use_awaitable));
-                        if (result.index() == 0) {
-                            co_return result::success();
-                        }
-                        co_return std::unexpected(make_error_code(asio::error::timed_out));
-                    } else {
-                        co_await asio::async_write(m_socket, asio::buffer(src), asio::use_awaitable);
-                        co_return result::success();
-                    }
-                } catch (const asio::system_error& ex) {
-                    co_return std::unexpected(ex.code());
-                } catch (...) {
-                    co_return std::unexpected(make_error_code(asio::error::basic_errors::network_down));
+        AsioAwaiter<result::Result<void>> writing{ m_reactor, writeAll(src, timeout) };
+        co_return co_await std::move(writing);
+    }
+
+    // The asio coroutines below run on the reactor thread. Their arguments are copied into the frame,
+    // so they stay valid after the initiating call returns.
+
+    auto TcpServer::acceptOn(std::chrono::milliseconds timeout) -> asio::awaitable<result::Result<void>>
+    {
+        using namespace asio::experimental::awaitable_operators;
+
+        try {
+            if (timeout != NO_TIMEOUT) {
+                asio::steady_timer timer(co_await asio::this_coro::executor);
+                timer.expires_after(timeout);
+
+                auto result = co_await (m_acceptor.async_accept(m_socket, asio::use_awaitable) ||
+                                        timer.async_wait(asio::use_awaitable));
+
+                if (result.index() == 0) {
+                    co_return result::success();
+                }
+                co_return std::unexpected(make_error_code(asio::error::timed_out));
+            }
+            co_await m_acceptor.async_accept(m_socket, asio::use_awaitable);
+            co_return result::success();
+        } catch (const std::exception&) {
+            co_return std::unexpected(make_error_code(asio::error::basic_errors::connection_aborted));
+        }
+    }
+
+    auto TcpServer::readSome(std::span<std::byte> dest, std::chrono::milliseconds timeout)
+      -> asio::awaitable<result::Result<size_t>>
+    {
+        using namespace asio::experimental::awaitable_operators;
+
+        try {
+            if (timeout != NO_TIMEOUT) {
+                asio::steady_timer timer(co_await asio::this_coro::executor);
+                timer.expires_after(timeout);
+
+                auto result = co_await (m_socket.async_read_some(asio::buffer(dest), asio::use_awaitable) ||
+                                        timer.async_wait(asio::use_awaitable));
+
+                if (result.index() == 0) {
+                    co_return std::get<0>(result);
                 }
-            }()
-        };
+                co_return std::unexpected(make_error_code(asio::error::timed_out));
+            }
+            auto result = co_await m_socket.async_read_some(asio::buffer(dest), asio::use_awaitable);
+            co_return result;
+        } catch (const asio::system_error& ex) {
+            co_return std::unexpected(ex.code());
+        } catch (...) {
+            co_return std::unexpected(make_error_code(asio::error::basic_errors::network_down));
+        }
     }
-}
\ No newline at end of file
+
+    auto TcpServer::writeAll(std::span<const std::byte> src, std::chrono::milliseconds timeout)
+      -> asio::awaitable<result::Result<void>>
+    {
+        using namespace asio::experimental::awaitable_operators;
+
+        try {
+            if (timeout != NO_TIMEOUT) {
+                asio::steady_timer timer(co_await asio::this_coro::executor);
+                timer.expires_after(timeout);
+
+                auto result = co_await (asio::async_write(m_socket, asio::buffer(src), asio::use_awaitable) ||
+                                        timer.async_wait(asio::use_awaitable));
+
+                if (result.index() == 0) {
+                    co_return result::success();
+                }
+                co_return std::unexpected(make_error_code(asio::error::timed_out));
+            }
+            co_await asio::async_write(m_socket, asio::buffer(src), asio::use_awaitable);
+            co_return result::success();
+        } catch (const asio::system_error& ex) {
+            co_return std::unexpected(ex.code());
+        } catch (...) {
+            co_return std::unexpected(make_error_code(asio::error::basic_errors::network_down));
+        }
+    }
+}
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "AsioExecutor.hpp"
 #include "IRawLink.hpp"
 
 #include <asio.hpp>
@@ -7,12 +8,17 @@
 
 namespace core::link::raw
 {
+    /**
+     * Single-connection TCP server. Its sockets live on an AsioExecutor, the process-wide shared()
+     * reactor unless one is passed in, so the server owns no thread. Completions resume the awaiting
+     * coroutine on that coroutine's executor.
+     */
     class TcpServer
       : public IServer
       , public IRawLink
     {
       public:
-        TcpServer(uint16_t port);
+        explicit TcpServer(uint16_t port, AsioExecutor& reactor = AsioExecutor::shared());
         ~TcpServer() override;
 
         auto start() -> result::Result<void> override;
@@ -25,18 +31,23 @@ namespace core::link::raw
         auto receiveInto(std::string_view path,
                          std::span<std::byte> dest,
                          std::chrono::milliseconds timeout = NO_TIMEOUT)
-          -> coro::Task<result::Result<size_t>> override;
+          -> coro::ValueTask<result::Result<size_t>> override;
 
         auto sendFrom(std::string_view path,
                       std::span<const std::byte> src,
                       std::chrono::milliseconds timeout = NO_TIMEOUT)
-          -> coro::Task<result::Result<void>> override;
+          -> coro::ValueTask<result::Result<void>> override;
 
       private:
-        asio::io_context m_context;
+        auto acceptOn(std::chrono::milliseconds timeout) -> asio::awaitable<result::Result<void>>;
+        auto readSome(std::span<std::byte> dest, std::chrono::milliseconds timeout)
+          -> asio::awaitable<result::Result<size_t>>;
+        auto writeAll(std::span<const std::byte> src, std::chrono::milliseconds timeout)
+          -> asio::awaitable<result::Result<void>>;
+
+        AsioExecutor& m_reactor;
         asio::ip::tcp::acceptor m_acceptor;
         asio::ip::tcp::socket m_socket;
         std::atomic<Status> m_status{ Status::Disconnected };
-        std::thread m_thread;
     };
 }
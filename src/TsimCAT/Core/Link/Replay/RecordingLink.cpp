@@ -0,0 +1,325 @@
+#include "RecordingLink.hpp"
+
+#include "Link/Raw/AsioExecutor.hpp"
+
+#include "Coroutines/coroutine.hpp"
+
+#include <algorithm>
+#include <system_error>
+
+namespace core::link::replay
+{
+    namespace
+    {
+        // Hands the wrapped subscription's values on to the one the caller holds, recording each, and
+        // closes the caller's once the wrapped one is closed.
+        auto forward(std::shared_ptr<TrafficRecorder> recorder,
+                     std::shared_ptr<RawSubscription> inner,
+                     std::shared_ptr<RawSubscription> outer,
+                     std::string path,
+                     uint32_t tag) -> coro::Task<void>
+        {
+            while (true) {
+                std::optional<coro::RawBinaryChannel::SharedBytes> value;
+                co_await inner->stream.next(value);
+                if (!value) {
+                    break;
+                }
+                recorder->record(RecordKind::Sample, path, **value, tag);
+                outer->stream.push(std::move(*value));
+            }
+            outer->stream.close();
+        }
+
+        auto notSupported() -> std::error_code
+        {
+            return std::make_error_code(std::errc::operation_not_supported);
+        }
+    }
+
+    auto RecordingLink::open(std::unique_ptr<ILink> link, const std::filesystem::path& file)
+      -> result::Result<std::unique_ptr<RecordingLink>>
+    {
+        if (!link) {
+            return std::unexpected(std::make_error_code(std::errc::invalid_argument));
+        }
+        auto recording = std::make_unique<RecordingLink>(std::move(link));
+        if (auto opened = recording->m_recorder->open(file, recording->getRole(), recording->getMode());
+            !opened) {
+            return std::unexpected(opened.error());
+        }
+        return recording;
+    }
+
+    RecordingLink::RecordingLink(std::unique_ptr<ILink> link)
+      : m_link(std::move(link))
+      , m_client(m_link->asClient())
+      , m_server(m_link->asServer())
+      , m_symbolic(m_link->asSymbolic())
+      , m_raw(m_link->asRaw())
+    {
+    }
+
+    RecordingLink::~RecordingLink()
+    {
+        std::unordered_map<uint64_t, std::shared_ptr<RawSubscription>> subscriptions;
+        {
+            std::scoped_lock lock(m_mutex);
+            subscriptions.swap(m_subscriptions);
+        }
+        for (const auto& [id, subscription] : subscriptions) {
+            m_symbolic->unsubscribeRawSync(id);
+        }
+        m_recorder->close();
+    }
+
+    auto RecordingLink::connect(std::chrono::milliseconds timeout) -> coro::Task<result::Result<void>>
+    {
+        if (!m_client) {
+            co_return std::unexpected(notSupported());
+        }
+        co_return co_await m_client->connect(timeout);
+    }
+
+    auto RecordingLink::disconnect(std::chrono::milliseconds timeout) -> coro::Task<result::Result<void>>
+    {
+        if (!m_client) {
+            co_return std::unexpected(notSupported());
+        }
+        co_return co_await m_client->disconnect(timeout);
+    }
+
+    auto RecordingLink::start() -> result::Result<void>
+    {
+        if (!m_server) {
+            return std::unexpected(notSupported());
+        }
+        return m_server->start();
+    }
+
+    auto RecordingLink::stop() -> result::Result<void>
+    {
+        if (!m_server) {
+            return std::unexpected(notSupported());
+        }
+        return m_server->stop();
+    }
+
+    auto RecordingLink::accept(std::chrono::milliseconds timeout) -> coro::Task<result::Result<void>>
+    {
+        if (!m_server) {
+            co_return std::unexpected(notSupported());
+        }
+        co_return co_await m_server->accept(timeout);
+    }
+
+    auto RecordingLink::readInto(std::string_view path,
+                                 std::span<std::byte> dest,
+                                 std::chrono::milliseconds timeout)
+      -> coro::ValueTask<result::Result<size_t>>
+    {
+        auto read = m_symbolic->readInto(path, dest, timeout);
+        if (!read.isReady()) {
+            return finishRead(std::move(read), RecordKind::Read, path, dest);
+        }
+        auto res = read.await_resume();
+        recordRead(RecordKind::Read, path, dest, res);
+        return res;
+    }
+
+    auto RecordingLink::writeFrom(std::string_view path,
+                                  std::span<const std::byte> src,
+                                  std::chrono::milliseconds timeout) -> coro::ValueTask<result::Result<void>>
+    {
+        auto written = m_symbolic->writeFrom(path, src, timeout);
+        if (!written.isReady()) {
+            return finishWrite(std::move(written), RecordKind::Write, path, src);
+        }
+        auto res = written.await_resume();
+        recordWrite(RecordKind::Write, path, src, res);
+        return res;
+    }
+
+    auto RecordingLink::readMany(std::span<const SymbolRead> symbols, std::chrono::milliseconds timeout)
+      -> coro::ValueTask<result::Result<void>>
+    {
+        auto read = m_symbolic->readMany(symbols, timeout);
+        if (!read.isReady()) {
+            return finishReads(std::move(read), symbols);
+        }
+        auto res = read.await_resume();
+        recordReads(symbols, res);
+        return res;
+    }
+
+    auto RecordingLink::writeMany(std::span<const SymbolWrite> symbols, std::chrono::milliseconds timeout)
+      -> coro::ValueTask<result::Result<void>>
+    {
+        auto written = m_symbolic->writeMany(symbols, timeout);
+        if (!written.isReady()) {
+            return finishWrites(std::move(written), symbols);
+        }
+        auto res = written.await_resume();
+        recordWrites(symbols, res);
+        return res;
+    }
+
+    auto RecordingLink::subscribeRaw(std::string_view path,
+                                     size_t size,
+                                     SubscriptionType type,
+                                     std::chrono::milliseconds interval,
+                                     coro::ChannelOptions options)
+      -> coro::Task<result::Result<std::shared_ptr<RawSubscription>>>
+    {
+        // Kept before the await: the caller's path may not outlive it.
+        std::string name{ path };
+        auto inner = co_await m_symbolic->subscribeRaw(name, size, type, interval);
+        if (!inner) {
+            m_recorder->recordError(RecordKind::Subscribe, name, inner.error());
+            co_return std::unexpected(inner.error());
+        }
+
+        uint32_t tag = 0;
+        {
+            std::scoped_lock lock(m_mutex);
+            tag = m_nextTag++;
+            m_subscriptions.emplace((*inner)->id, *inner);
+        }
+        m_recorder->record(RecordKind::Subscribe, name, {}, tag);
+
+        auto outer = std::make_shared<RawSubscription>((*inner)->id, options);
+        coro::co_spawn(raw::AsioExecutor::shared(),
+                       [recorder = m_recorder, inner = *inner, outer, name = std::move(name), tag](
+                         raw::AsioExecutor&) { return forward(recorder, inner, outer, name, tag); });
+        co_return outer;
+    }
+
+    auto RecordingLink::unsubscribeRaw(std::shared_ptr<RawSubscription> subscription)
+      -> coro::Task<result::Result<void>>
+    {
+        if (subscription) {
+            unsubscribeRawSync(subscription->id);
+        }
+        co_return result::success();
+    }
+
+    // The forwarding coroutine closes the caller's stream once the wrapped link has closed its own.
+    auto RecordingLink::unsubscribeRawSync(uint64_t id) -> void
+    {
+        {
+            std::scoped_lock lock(m_mutex);
+            if (m_subscriptions.erase(id) == 0) {
+                return;
+            }
+        }
+        m_symbolic->unsubscribeRawSync(id);
+    }
+
+    auto RecordingLink::receiveInto(std::string_view path,
+                                    std::span<std::byte> dest,
+                                    std::chrono::milliseconds timeout)
+      -> coro::ValueTask<result::Result<size_t>>
+    {
+        auto received = m_raw->receiveInto(path, dest, timeout);
+        if (!received.isReady()) {
+            return finishRead(std::move(received), RecordKind::Receive, path, dest);
+        }
+        auto res = received.await_resume();
+        recordRead(RecordKind::Receive, path, dest, res);
+        return res;
+    }
+
+    auto RecordingLink::sendFrom(std::string_view path,
+                                 std::span<const std::byte> src,
+                                 std::chrono::milliseconds timeout) -> coro::ValueTask<result::Result<void>>
+    {
+        auto sent = m_raw->sendFrom(path, src, timeout);
+        if (!sent.isReady()) {
+            return finishWrite(std::move(sent), RecordKind::Send, path, src);
+        }
+        auto res = sent.await_resume();
+        recordWrite(RecordKind::Send, path, src, res);
+        return res;
+    }
+
+    auto RecordingLink::recordRead(RecordKind kind,
+                                   std::string_view path,
+                                   std::span<const std::byte> dest,
+                                   const result::Result<size_t>& read) -> void
+    {
+        if (!read) {
+            m_recorder->recordError(kind, path, read.error());
+            return;
+        }
+        m_recorder->record(kind, path, dest.first(std::min(*read, dest.size())));
+    }
+
+    auto RecordingLink::recordWrite(RecordKind kind,
+                                    std::string_view path,
+                                    std::span<const std::byte> src,
+                                    const result::Result<void>& written) -> void
+    {
+        if (!written) {
+            m_recorder->recordError(kind, path, written.error());
+            return;
+        }
+        m_recorder->record(kind, path, src);
+    }
+
+    // A batch is logged per symbol, so a replay can serve it to single accesses and vice versa.
+    auto RecordingLink::recordReads(std::span<const SymbolRead> symbols, const result::Result<void>& read)
+      -> void
+    {
+        for (const auto& symbol : symbols) {
+            if (!read) {
+                m_recorder->recordError(RecordKind::Read, symbol.path, read.error());
+                continue;
+            }
+            m_recorder->record(RecordKind::Read, symbol.path, symbol.dest);
+        }
+    }
+
+    auto RecordingLink::recordWrites(std::span<const SymbolWrite> symbols,
+                                     const result::Result<void>& written) -> void
+    {
+        for (const auto& symbol : symbols) {
+            recordWrite(RecordKind::Write, symbol.path, symbol.src, written);
+        }
+    }
+
+    auto RecordingLink::finishRead(coro::ValueTask<result::Result<size_t>> read,
+                                   RecordKind kind,
+                                   std::string_view path,
+                                   std::span<std::byte> dest) -> coro::Task<result::Result<size_t>>
+    {
+        auto res = co_await std::move(read);
+        recordRead(kind, path, dest, res);
+        co_return res;
+    }
+
+    auto RecordingLink::finishWrite(coro::ValueTask<result::Result<void>> written,
+                                    RecordKind kind,
+                                    std::string_view path,
+                                    std::span<const std::byte> src) -> coro::Task<result::Result<void>>
+    {
+        auto res = co_await std::move(written);
+        recordWrite(kind, path, src, res);
+        co_return res;
+    }
+
+    auto RecordingLink::finishReads(coro::ValueTask<result::Result<void>> read,
+                                    std::span<const SymbolRead> symbols) -> coro::Task<result::Result<void>>
+    {
+        auto res = co_await std::move(read);
+        recordReads(symbols, res);
+        co_return res;
+    }
+
+    auto RecordingLink::finishWrites(coro::ValueTask<result::Result<void>> written,
+                                     std::span<const SymbolWrite> symbols) -> coro::Task<result::Result<void>>
+    {
+        auto res = co_await std::move(written);
+        recordWrites(symbols, res);
+        co_return res;
+    }
+}
@@ -0,0 +1,129 @@
+#pragma once
+
+#include "TrafficLog.hpp"
+
+#include "Link/Raw/IRawLink.hpp"
+#include "Link/Symbolic/ISymbolicLink.hpp"
+
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace core::link::replay
+{
+    /**
+     * Decorates a link and logs its traffic to a TrafficRecorder file: every read, write, receive and
+     * send with its outcome, and every value a subscription delivers. A ReplayLink serves the file back.
+     *
+     * It exposes the same role and mode as the link it wraps, and the as*() casts only succeed where
+     * that link's do. Calls complete as the wrapped link's do: an inline access is recorded and handed
+     * back inline. Subscription values pass through a forwarding coroutine on the shared reactor, which
+     * records each one before handing it on.
+     */
+    class RecordingLink
+      : public IClient
+      , public IServer
+      , public ISymbolicLink
+      , public IRawLink
+    {
+      public:
+        static auto open(std::unique_ptr<ILink> link, const std::filesystem::path& file)
+          -> result::Result<std::unique_ptr<RecordingLink>>;
+
+        explicit RecordingLink(std::unique_ptr<ILink> link);
+        ~RecordingLink() override;
+
+        auto getRole() const -> Role override { return m_link->getRole(); }
+        auto getMode() const -> Mode override { return m_link->getMode(); }
+        auto status() const -> Status override { return m_link->status(); }
+
+        auto asServer() -> IServer* override { return m_server ? this : nullptr; }
+        auto asClient() -> IClient* override { return m_client ? this : nullptr; }
+        auto asRaw() -> IRawLink* override { return m_raw ? this : nullptr; }
+        auto asSymbolic() -> ISymbolicLink* override { return m_symbolic ? this : nullptr; }
+
+        auto connect(std::chrono::milliseconds timeout = NO_TIMEOUT)
+          -> coro::Task<result::Result<void>> override;
+        auto disconnect(std::chrono::milliseconds timeout = NO_TIMEOUT)
+          -> coro::Task<result::Result<void>> override;
+
+        auto start() -> result::Result<void> override;
+        auto stop() -> result::Result<void> override;
+        auto accept(std::chrono::milliseconds timeout = NO_TIMEOUT)
+          -> coro::Task<result::Result<void>> override;
+
+        auto readInto(std::string_view path,
+                      std::span<std::byte> dest,
+                      std::chrono::milliseconds timeout = NO_TIMEOUT)
+          -> coro::ValueTask<result::Result<size_t>> override;
+        auto writeFrom(std::string_view path,
+                       std::span<const std::byte> src,
+                       std::chrono::milliseconds timeout = NO_TIMEOUT)
+          -> coro::ValueTask<result::Result<void>> override;
+        auto readMany(std::span<const SymbolRead> symbols, std::chrono::milliseconds timeout = NO_TIMEOUT)
+          -> coro::ValueTask<result::Result<void>> override;
+        auto writeMany(std::span<const SymbolWrite> symbols, std::chrono::milliseconds timeout = NO_TIMEOUT)
+          -> coro::ValueTask<result::Result<void>> override;
+
+        auto subscribeRaw(std::string_view path,
+                          size_t size,
+                          SubscriptionType type = SubscriptionType::OnChange,
+                          std::chrono::milliseconds interval = NO_TIMEOUT,
+                          coro::ChannelOptions options = {})
+          -> coro::Task<result::Result<std::shared_ptr<RawSubscription>>> override;
+        auto unsubscribeRaw(std::shared_ptr<RawSubscription> subscription)
+          -> coro::Task<result::Result<void>> override;
+        auto unsubscribeRawSync(uint64_t id) -> void override;
+
+        auto receiveInto(std::string_view path,
+                         std::span<std::byte> dest,
+                         std::chrono::milliseconds timeout = NO_TIMEOUT)
+          -> coro::ValueTask<result::Result<size_t>> override;
+        auto sendFrom(std::string_view path,
+                      std::span<const std::byte> src,
+                      std::chrono::milliseconds timeout = NO_TIMEOUT)
+          -> coro::ValueTask<result::Result<void>> override;
+
+        auto link() const -> ILink& { return *m_link; }
+
+      private:
+        auto recordRead(RecordKind kind,
+                        std::string_view path,
+                        std::span<const std::byte> dest,
+                        const result::Result<size_t>& read) -> void;
+        auto recordWrite(RecordKind kind,
+                         std::string_view path,
+                         std::span<const std::byte> src,
+                         const result::Result<void>& written) -> void;
+        auto recordReads(std::span<const SymbolRead> symbols, const result::Result<void>& read) -> void;
+        auto recordWrites(std::span<const SymbolWrite> symbols, const result::Result<void>& written) -> void;
+
+        // Await a call the wrapped link left pending and record its outcome.
+        auto finishRead(coro::ValueTask<result::Result<size_t>> read,
+                        RecordKind kind,
+                        std::string_view path,
+                        std::span<std::byte> dest) -> coro::Task<result::Result<size_t>>;
+        auto finishWrite(coro::ValueTask<result::Result<void>> written,
+                         RecordKind kind,
+                         std::string_view path,
+                         std::span<const std::byte> src) -> coro::Task<result::Result<void>>;
+        auto finishReads(coro::ValueTask<result::Result<void>> read, std::span<const SymbolRead> symbols)
+          -> coro::Task<result::Result<void>>;
+        auto finishWrites(coro::ValueTask<result::Result<void>> written, std::span<const SymbolWrite> symbols)
+          -> coro::Task<result::Result<void>>;
+
+        std::unique_ptr<ILink> m_link;
+        IClient* m_client;
+        IServer* m_server;
+        ISymbolicLink* m_symbolic;
+        IRawLink* m_raw;
+        // Shared with the forwarding coroutines, which may outlive the link by a moment.
+        std::shared_ptr<TrafficRecorder> m_recorder{ std::make_shared<TrafficRecorder>() };
+
+        std::mutex m_mutex;
+        uint32_t m_nextTag{ 0 };
+        // The wrapped link's subscriptions, by the id they share with the ones handed out.
+        std::unordered_map<uint64_t, std::shared_ptr<RawSubscription>> m_subscriptions;
+    };
+}
@@ -0,0 +1,407 @@
+#include "ReplayLink.hpp"
+
+#include "Link/Raw/AsioExecutor.hpp"
+
+#include "Coroutines/coroutine.hpp"
+
+#include <algorithm>
+#include <system_error>
+
+namespace core::link::replay
+{
+    namespace
+    {
+        auto notRecorded() -> std::error_code
+        {
+            return std::make_error_code(std::errc::no_message_available);
+        }
+
+        auto cancelled() -> std::error_code
+        {
+            return std::make_error_code(std::errc::operation_canceled);
+        }
+
+        // Pushes a subscription's recorded values as their times come due. The log is shared so the
+        // coroutine may outlive the link until its stop request is seen.
+        auto play(std::shared_ptr<const TrafficLog> log,
+                  std::vector<coro::Clock::time_point> due,
+                  std::vector<const Record*> samples,
+                  std::shared_ptr<RawSubscription> subscription) -> coro::Task<void>
+        {
+            for (size_t i = 0; i < samples.size(); ++i) {
+                co_await coro::sleep_until(due[i]);
+                const auto stopToken{ co_await coro::currentStopToken() };
+                if (stopToken.stop_requested()) {
+                    co_return;
+                }
+                subscription->stream.push(log->data(*samples[i]));
+            }
+        }
+    }
+
+    auto ReplayLink::open(const std::filesystem::path& file, double speed)
+      -> result::Result<std::unique_ptr<ReplayLink>>
+    {
+        if (speed < 0.0) {
+            return std::unexpected(std::make_error_code(std::errc::invalid_argument));
+        }
+        auto log = TrafficLog::load(file);
+        if (!log) {
+            return std::unexpected(log.error());
+        }
+        return std::make_unique<ReplayLink>(std::move(*log), speed);
+    }
+
+    ReplayLink::ReplayLink(TrafficLog log, double speed)
+      : m_log(std::make_shared<const TrafficLog>(std::move(log)))
+      , m_speed(speed)
+    {
+        for (uint32_t id = 0; id < m_log->pathCount(); ++id) {
+            m_paths.emplace(std::string{ m_log->path(id) }, id);
+        }
+        for (const auto& record : m_log->records()) {
+            if (record.kind == RecordKind::Sample) {
+                m_samples[record.tag].push_back(&record);
+                continue;
+            }
+            m_queues[key(record.kind, record.path)].records.push_back(&record);
+        }
+    }
+
+    ReplayLink::~ReplayLink()
+    {
+        closeFeeds();
+    }
+
+    auto ReplayLink::connect(std::chrono::milliseconds) -> coro::Task<result::Result<void>>
+    {
+        m_status = Status::Connected;
+        co_return result::success();
+    }
+
+    auto ReplayLink::disconnect(std::chrono::milliseconds) -> coro::Task<result::Result<void>>
+    {
+        m_status = Status::Disconnected;
+        closeFeeds();
+        co_return result::success();
+    }
+
+    auto ReplayLink::start() -> result::Result<void>
+    {
+        m_status = Status::Connected;
+        return result::success();
+    }
+
+    auto ReplayLink::stop() -> result::Result<void>
+    {
+        m_status = Status::Disconnected;
+        closeFeeds();
+        return result::success();
+    }
+
+    auto ReplayLink::accept(std::chrono::milliseconds) -> coro::Task<result::Result<void>>
+    {
+        co_return result::success();
+    }
+
+    auto ReplayLink::readInto(std::string_view path, std::span<std::byte> dest, std::chrono::milliseconds)
+      -> coro::ValueTask<result::Result<size_t>>
+    {
+        return serveRead(RecordKind::Read, path, dest);
+    }
+
+    auto ReplayLink::writeFrom(std::string_view path,
+                               std::span<const std::byte> src,
+                               std::chrono::milliseconds) -> coro::ValueTask<result::Result<void>>
+    {
+        return serveWrite(RecordKind::Write, path, src);
+    }
+
+    // Batches were recorded per symbol, so each symbol takes its own next answer.
+    auto ReplayLink::readMany(std::span<const SymbolRead> symbols, std::chrono::milliseconds)
+      -> coro::ValueTask<result::Result<void>>
+    {
+        std::vector<const Record*> records;
+        records.reserve(symbols.size());
+        auto due = Clock::time_point::min();
+        {
+            std::scoped_lock lock(m_mutex);
+            for (const auto& symbol : symbols) {
+                const auto* record = takeLocked(RecordKind::Read, symbol.path, true);
+                if (record) {
+                    due = std::max(due, dueLocked(*record));
+                }
+                records.push_back(record);
+            }
+        }
+        if (paced(due)) {
+            return readManyAt(due, std::move(records), symbols);
+        }
+        return copyAll(records, symbols);
+    }
+
+    auto ReplayLink::writeMany(std::span<const SymbolWrite> symbols, std::chrono::milliseconds)
+      -> coro::ValueTask<result::Result<void>>
+    {
+        result::Result<void> outcome;
+        auto due = Clock::time_point::min();
+        {
+            std::scoped_lock lock(m_mutex);
+            for (const auto& symbol : symbols) {
+                const auto* record = takeLocked(RecordKind::Write, symbol.path, false);
+                if (record) {
+                    due = std::max(due, dueLocked(*record));
+                }
+                if (auto written = compareLocked(record, symbol.src); !written && outcome) {
+                    outcome = written;
+                }
+            }
+        }
+        if (paced(due)) {
+            return completeAt(due, outcome);
+        }
+        return outcome;
+    }
+
+    auto ReplayLink::subscribeRaw(std::string_view path,
+                                  size_t,
+                                  SubscriptionType,
+                                  std::chrono::milliseconds,
+                                  coro::ChannelOptions options)
+      -> coro::Task<result::Result<std::shared_ptr<RawSubscription>>>
+    {
+        std::shared_ptr<RawSubscription> subscription;
+        std::vector<const Record*> samples;
+        std::vector<Clock::time_point> due;
+        std::stop_token stop;
+        {
+            std::scoped_lock lock(m_mutex);
+            const auto* record = takeLocked(RecordKind::Subscribe, path, false);
+            if (!record) {
+                co_return std::unexpected(notRecorded());
+            }
+            if (record->error) {
+                co_return std::unexpected(record->error);
+            }
+            if (auto it = m_samples.find(record->tag); it != m_samples.end()) {
+                samples = it->second;
+            }
+            for (const auto* sample : samples) {
+                due.push_back(dueLocked(*sample));
+            }
+
+            subscription = std::make_shared<RawSubscription>(m_nextSubscriptionId++, options);
+            auto& feed = m_feeds[subscription->id];
+            feed.subscription = subscription;
+            stop = feed.stop.get_token();
+        }
+
+        if (m_speed == AS_FAST_AS_POSSIBLE) {
+            for (const auto* sample : samples) {
+                subscription->stream.push(m_log->data(*sample));
+            }
+            co_return subscription;
+        }
+        coro::co_spawn(
+          raw::AsioExecutor::shared(),
+          [log = m_log, due = std::move(due), samples = std::move(samples), subscription](
+            raw::AsioExecutor&) { return play(log, due, samples, subscription); },
+          std::move(stop));
+        co_return subscription;
+    }
+
+    auto ReplayLink::unsubscribeRaw(std::shared_ptr<RawSubscription> subscription)
+      -> coro::Task<result::Result<void>>
+    {
+        if (subscription) {
+            unsubscribeRawSync(subscription->id);
+        }
+        co_return result::success();
+    }
+
+    auto ReplayLink::unsubscribeRawSync(uint64_t id) -> void
+    {
+        Feed feed;
+        {
+            std::scoped_lock lock(m_mutex);
+            auto it = m_feeds.find(id);
+            if (it == m_feeds.end()) {
+                return;
+            }
+            feed = std::move(it->second);
+            m_feeds.erase(it);
+        }
+        feed.stop.request_stop();
+        feed.subscription->stream.close();
+    }
+
+    auto ReplayLink::receiveInto(std::string_view path, std::span<std::byte> dest, std::chrono::milliseconds)
+      -> coro::ValueTask<result::Result<size_t>>
+    {
+        return serveRead(RecordKind::Receive, path, dest);
+    }
+
+    auto ReplayLink::sendFrom(std::string_view path,
+                              std::span<const std::byte> src,
+                              std::chrono::milliseconds) -> coro::ValueTask<result::Result<void>>
+    {
+        return serveWrite(RecordKind::Send, path, src);
+    }
+
+    auto ReplayLink::takeLocked(RecordKind kind, std::string_view path, bool repeatLast) -> const Record*
+    {
+        const auto id = m_paths.find(path);
+        if (id == m_paths.end()) {
+            return nullptr;
+        }
+        const auto queue = m_queues.find(key(kind, id->second));
+        if (queue == m_queues.end()) {
+            return nullptr;
+        }
+        auto& [records, next] = queue->second;
+        if (next < records.size()) {
+            return records[next++];
+        }
+        return repeatLast ? records.back() : nullptr;
+    }
+
+    auto ReplayLink::dueLocked(const Record& record) const -> Clock::time_point
+    {
+        if (m_speed == AS_FAST_AS_POSSIBLE) {
+            return m_start;
+        }
+        const auto scaled = std::chrono::duration<double, std::nano>(record.time) / m_speed;
+        return m_start + std::chrono::duration_cast<Clock::duration>(scaled);
+    }
+
+    auto ReplayLink::paced(Clock::time_point due) const -> bool
+    {
+        return m_speed != AS_FAST_AS_POSSIBLE && due > Clock::now();
+    }
+
+    // A write past the end of the recording has nothing to differ from and succeeds.
+    auto ReplayLink::compareLocked(const Record* record, std::span<const std::byte> src)
+      -> result::Result<void>
+    {
+        if (!record) {
+            return result::success();
+        }
+        if (record->error) {
+            return std::unexpected(record->error);
+        }
+        if (!std::ranges::equal(m_log->data(*record), src)) {
+            ++m_divergences;
+        }
+        return result::success();
+    }
+
+    auto ReplayLink::copyOut(const Record& record, std::span<std::byte> dest) const -> result::Result<size_t>
+    {
+        if (record.error) {
+            return std::unexpected(record.error);
+        }
+        const auto data = m_log->data(record);
+        const auto size = std::min(data.size(), dest.size());
+        std::ranges::copy(data.first(size), dest.begin());
+        return size;
+    }
+
+    auto ReplayLink::copyAll(std::span<const Record* const> records,
+                             std::span<const SymbolRead> symbols) const -> result::Result<void>
+    {
+        for (size_t i = 0; i < symbols.size(); ++i) {
+            if (!records[i]) {
+                return std::unexpected(notRecorded());
+            }
+            if (auto read = copyOut(*records[i], symbols[i].dest); !read) {
+                return std::unexpected(read.error());
+            }
+        }
+        return result::success();
+    }
+
+    auto ReplayLink::serveRead(RecordKind kind, std::string_view path, std::span<std::byte> dest)
+      -> coro::ValueTask<result::Result<size_t>>
+    {
+        const Record* record = nullptr;
+        auto due = Clock::time_point::min();
+        {
+            std::scoped_lock lock(m_mutex);
+            record = takeLocked(kind, path, true);
+            if (!record) {
+                return std::unexpected(notRecorded());
+            }
+            due = dueLocked(*record);
+        }
+        if (paced(due)) {
+            return readAt(due, *record, dest);
+        }
+        return copyOut(*record, dest);
+    }
+
+    auto ReplayLink::serveWrite(RecordKind kind, std::string_view path, std::span<const std::byte> src)
+      -> coro::ValueTask<result::Result<void>>
+    {
+        result::Result<void> outcome;
+        auto due = Clock::time_point::min();
+        {
+            std::scoped_lock lock(m_mutex);
+            const auto* record = takeLocked(kind, path, false);
+            if (record) {
+                due = dueLocked(*record);
+            }
+            outcome = compareLocked(record, src);
+        }
+        if (paced(due)) {
+            return completeAt(due, outcome);
+        }
+        return outcome;
+    }
+
+    auto ReplayLink::readAt(Clock::time_point due, const Record& record, std::span<std::byte> dest)
+      -> coro::Task<result::Result<size_t>>
+    {
+        co_await coro::sleep_until(due);
+        const auto stopToken{ co_await coro::currentStopToken() };
+        if (stopToken.stop_requested()) {
+            co_return std::unexpected(cancelled());
+        }
+        co_return copyOut(record, dest);
+    }
+
+    auto ReplayLink::readManyAt(Clock::time_point due,
+                                std::vector<const Record*> records,
+                                std::span<const SymbolRead> symbols) -> coro::Task<result::Result<void>>
+    {
+        co_await coro::sleep_until(due);
+        const auto stopToken{ co_await coro::currentStopToken() };
+        if (stopToken.stop_requested()) {
+            co_return std::unexpected(cancelled());
+        }
+        co_return copyAll(records, symbols);
+    }
+
+    auto ReplayLink::completeAt(Clock::time_point due, result::Result<void> outcome)
+      -> coro::Task<result::Result<void>>
+    {
+        co_await coro::sleep_until(due);
+        const auto stopToken{ co_await coro::currentStopToken() };
+        if (stopToken.stop_requested()) {
+            co_return std::unexpected(cancelled());
+        }
+        co_return outcome;
+    }
+
+    auto ReplayLink::closeFeeds() -> void
+    {
+        std::unordered_map<uint64_t, Feed> feeds;
+        {
+            std::scoped_lock lock(m_mutex);
+            feeds.swap(m_feeds);
+        }
+        for (auto& [id, feed] : feeds) {
+            feed.stop.request_stop();
+            feed.subscription->stream.close();
+        }
+    }
+}
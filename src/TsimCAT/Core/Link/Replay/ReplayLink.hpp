@@ -0,0 +1,163 @@
+#pragma once
+
+#include "TrafficLog.hpp"
+
+#include "Link/Raw/IRawLink.hpp"
+#include "Link/Symbolic/ISymbolicLink.hpp"
+
+#include "Coroutines/Timer.hpp"
+
+#include <atomic>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <stop_token>
+#include <unordered_map>
+#include <vector>
+
+namespace core::link::replay
+{
+    /**
+     * Serves a traffic log written by a RecordingLink back, in place of the link it was recorded from.
+     *
+     * Each path answers reads and receives with the values recorded for it, in order, and keeps
+     * answering with the last one once they run out; a path that was never read fails with
+     * std::errc::no_message_available. The n-th subscription to a path replays the values the n-th
+     * recorded one received. Writes and sends succeed or fail as they did when recorded; one whose
+     * value differs from the recorded one counts towards divergenceCount().
+     *
+     * At a positive `speed` an answer is held back until its recorded time, scaled by 1/speed, has
+     * passed since the link was opened. AS_FAST_AS_POSSIBLE serves every answer at once and hands a
+     * subscription all its values as soon as it is made.
+     */
+    class ReplayLink
+      : public IClient
+      , public IServer
+      , public ISymbolicLink
+      , public IRawLink
+    {
+      public:
+        static constexpr double AS_FAST_AS_POSSIBLE{ 0.0 };
+
+        static auto open(const std::filesystem::path& file, double speed = 1.0)
+          -> result::Result<std::unique_ptr<ReplayLink>>;
+
+        ReplayLink(TrafficLog log, double speed);
+        ~ReplayLink() override;
+
+        auto getRole() const -> Role override { return m_log->role(); }
+        auto getMode() const -> Mode override { return m_log->mode(); }
+        auto status() const -> Status override { return m_status.load(); }
+
+        auto asServer() -> IServer* override { return getRole() == Role::Server ? this : nullptr; }
+        auto asClient() -> IClient* override { return getRole() == Role::Client ? this : nullptr; }
+        auto asRaw() -> IRawLink* override { return getMode() == Mode::Raw ? this : nullptr; }
+        auto asSymbolic() -> ISymbolicLink* override { return getMode() == Mode::Symbolic ? this : nullptr; }
+
+        auto connect(std::chrono::milliseconds timeout = NO_TIMEOUT)
+          -> coro::Task<result::Result<void>> override;
+        auto disconnect(std::chrono::milliseconds timeout = NO_TIMEOUT)
+          -> coro::Task<result::Result<void>> override;
+
+        auto start() -> result::Result<void> override;
+        auto stop() -> result::Result<void> override;
+        auto accept(std::chrono::milliseconds timeout = NO_TIMEOUT)
+          -> coro::Task<result::Result<void>> override;
+
+        auto readInto(std::string_view path,
+                      std::span<std::byte> dest,
+                      std::chrono::milliseconds timeout = NO_TIMEOUT)
+          -> coro::ValueTask<result::Result<size_t>> override;
+        auto writeFrom(std::string_view path,
+                       std::span<const std::byte> src,
+                       std::chrono::milliseconds timeout = NO_TIMEOUT)
+          -> coro::ValueTask<result::Result<void>> override;
+        auto readMany(std::span<const SymbolRead> symbols, std::chrono::milliseconds timeout = NO_TIMEOUT)
+          -> coro::ValueTask<result::Result<void>> override;
+        auto writeMany(std::span<const SymbolWrite> symbols, std::chrono::milliseconds timeout = NO_TIMEOUT)
+          -> coro::ValueTask<result::Result<void>> override;
+
+        auto subscribeRaw(std::string_view path,
+                          size_t size,
+                          SubscriptionType type = SubscriptionType::OnChange,
+                          std::chrono::milliseconds interval = NO_TIMEOUT,
+                          coro::ChannelOptions options = {})
+          -> coro::Task<result::Result<std::shared_ptr<RawSubscription>>> override;
+        auto unsubscribeRaw(std::shared_ptr<RawSubscription> subscription)
+          -> coro::Task<result::Result<void>> override;
+        auto unsubscribeRawSync(uint64_t id) -> void override;
+
+        auto receiveInto(std::string_view path,
+                         std::span<std::byte> dest,
+                         std::chrono::milliseconds timeout = NO_TIMEOUT)
+          -> coro::ValueTask<result::Result<size_t>> override;
+        auto sendFrom(std::string_view path,
+                      std::span<const std::byte> src,
+                      std::chrono::milliseconds timeout = NO_TIMEOUT)
+          -> coro::ValueTask<result::Result<void>> override;
+
+        // Writes and sends whose value differed from the recorded one.
+        auto divergenceCount() const -> size_t { return m_divergences.load(); }
+
+      private:
+        using Clock = coro::Clock;
+
+        // The recorded answers of one kind for one path and how many have been served.
+        struct Queue
+        {
+            std::vector<const Record*> records;
+            size_t next{ 0 };
+        };
+
+        struct Feed
+        {
+            std::shared_ptr<RawSubscription> subscription;
+            std::stop_source stop;
+        };
+
+        static auto key(RecordKind kind, uint32_t path) -> uint64_t
+        {
+            return (uint64_t{ static_cast<uint8_t>(kind) } << 32) | path;
+        }
+
+        // The next recorded answer, or the last one again if `repeatLast` and they have run out.
+        auto takeLocked(RecordKind kind, std::string_view path, bool repeatLast) -> const Record*;
+        auto dueLocked(const Record& record) const -> Clock::time_point;
+        auto paced(Clock::time_point due) const -> bool;
+        // Checks a write against its recorded counterpart and returns the recorded outcome.
+        auto compareLocked(const Record* record, std::span<const std::byte> src) -> result::Result<void>;
+        auto copyOut(const Record& record, std::span<std::byte> dest) const -> result::Result<size_t>;
+        auto copyAll(std::span<const Record* const> records, std::span<const SymbolRead> symbols) const
+          -> result::Result<void>;
+
+        auto serveRead(RecordKind kind, std::string_view path, std::span<std::byte> dest)
+          -> coro::ValueTask<result::Result<size_t>>;
+        auto serveWrite(RecordKind kind, std::string_view path, std::span<const std::byte> src)
+          -> coro::ValueTask<result::Result<void>>;
+
+        auto readAt(Clock::time_point due, const Record& record, std::span<std::byte> dest)
+          -> coro::Task<result::Result<size_t>>;
+        auto readManyAt(Clock::time_point due,
+                        std::vector<const Record*> records,
+                        std::span<const SymbolRead> symbols) -> coro::Task<result::Result<void>>;
+        static auto completeAt(Clock::time_point due, result::Result<void> outcome)
+          -> coro::Task<result::Result<void>>;
+
+        auto closeFeeds() -> void;
+
+        std::shared_ptr<const TrafficLog> m_log;
+        const double m_speed;
+        const Clock::time_point m_start{ Clock::now() };
+        std::atomic<Status> m_status{ Status::Connected };
+        std::atomic<size_t> m_divergences{ 0 };
+
+        std::unordered_map<std::string, uint32_t, PathHash, std::equal_to<>> m_paths;
+        // Subscription samples by the tag of the subscription that received them.
+        std::unordered_map<uint32_t, std::vector<const Record*>> m_samples;
+
+        std::mutex m_mutex;
+        std::unordered_map<uint64_t, Queue> m_queues;
+        uint64_t m_nextSubscriptionId{ 1 };
+        std::unordered_map<uint64_t, Feed> m_feeds;
+    };
+}
@@ -0,0 +1,180 @@
+#include "TrafficLog.hpp"
+
+#include <array>
+#include <cstring>
+
+namespace core::link::replay
+{
+    namespace
+    {
+        constexpr std::array<char, 8> MAGIC{ 'T', 'S', 'I', 'M', 'T', 'R', 'C', '1' };
+        constexpr uint16_t VERSION{ 1 };
+        constexpr size_t FILE_HEADER_SIZE{ 16 };
+        constexpr size_t RECORD_HEADER_SIZE{ 24 };
+
+        template<typename T>
+        auto put(std::byte* at, T value) -> void
+        {
+            std::memcpy(at, &value, sizeof(value));
+        }
+
+        template<typename T>
+        auto get(const std::byte* at) -> T
+        {
+            T value{};
+            std::memcpy(&value, at, sizeof(value));
+            return value;
+        }
+    }
+
+    auto TrafficRecorder::open(const std::filesystem::path& file, Role role, Mode mode)
+      -> result::Result<void>
+    {
+        std::scoped_lock lock(m_mutex);
+        if (file.has_parent_path()) {
+            std::error_code ec;
+            std::filesystem::create_directories(file.parent_path(), ec);
+        }
+        m_stream.open(file, std::ios::binary | std::ios::trunc);
+        if (!m_stream) {
+            return std::unexpected(std::make_error_code(std::errc::io_error));
+        }
+
+        std::array<std::byte, FILE_HEADER_SIZE> header{};
+        std::memcpy(header.data(), MAGIC.data(), MAGIC.size());
+        put(header.data() + 8, static_cast<uint8_t>(role));
+        put(header.data() + 9, static_cast<uint8_t>(mode));
+        put(header.data() + 10, VERSION);
+        m_stream.write(reinterpret_cast<const char*>(header.data()), header.size());
+
+        m_paths.clear();
+        m_start = Clock::now();
+        return result::success();
+    }
+
+    auto TrafficRecorder::close() -> void
+    {
+        std::scoped_lock lock(m_mutex);
+        if (m_stream.is_open()) {
+            m_stream.close();
+        }
+    }
+
+    auto TrafficRecorder::record(RecordKind kind,
+                                 std::string_view path,
+                                 std::span<const std::byte> data,
+                                 uint32_t tag) -> void
+    {
+        std::scoped_lock lock(m_mutex);
+        if (m_stream.is_open()) {
+            writeLocked(kind, pathLocked(path), tag, 0, data);
+        }
+    }
+
+    auto TrafficRecorder::recordError(RecordKind kind,
+                                      std::string_view path,
+                                      std::error_code error,
+                                      uint32_t tag) -> void
+    {
+        std::scoped_lock lock(m_mutex);
+        if (m_stream.is_open()) {
+            // A failure with value 0 would read back as success.
+            writeLocked(kind, pathLocked(path), tag, error.value() != 0 ? error.value() : -1, {});
+        }
+    }
+
+    auto TrafficRecorder::pathLocked(std::string_view path) -> uint32_t
+    {
+        if (auto it = m_paths.find(path); it != m_paths.end()) {
+            return it->second;
+        }
+        const auto id = static_cast<uint32_t>(m_paths.size());
+        m_paths.emplace(std::string{ path }, id);
+        writeLocked(RecordKind::Path, id, 0, 0, std::as_bytes(std::span{ path }));
+        return id;
+    }
+
+    auto TrafficRecorder::writeLocked(RecordKind kind,
+                                      uint32_t path,
+                                      uint32_t tag,
+                                      int32_t error,
+                                      std::span<const std::byte> data) -> void
+    {
+        const auto time = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - m_start);
+        const auto payload = error != 0 ? std::as_bytes(std::span{ &error, 1 }) : data;
+
+        std::array<std::byte, RECORD_HEADER_SIZE> header{};
+        put(header.data(), static_cast<uint64_t>(time.count()));
+        put(header.data() + 8, path);
+        put(header.data() + 12, tag);
+        put(header.data() + 16, static_cast<uint32_t>(payload.size()));
+        put(header.data() + 20, static_cast<uint8_t>(kind));
+        put(header.data() + 21, static_cast<uint8_t>(error != 0));
+        m_stream.write(reinterpret_cast<const char*>(header.data()), header.size());
+        m_stream.write(reinterpret_cast<const char*>(payload.data()),
+                       static_cast<std::streamsize>(payload.size()));
+    }
+
+    // A record cut short at the end, as a crashed recording leaves it, ends the log instead of failing it.
+    auto TrafficLog::load(const std::filesystem::path& file) -> result::Result<TrafficLog>
+    {
+        std::error_code ec;
+        const auto fileSize = std::filesystem::file_size(file, ec);
+        std::ifstream stream(file, std::ios::binary);
+        if (ec || !stream) {
+            return std::unexpected(std::make_error_code(std::errc::io_error));
+        }
+
+        TrafficLog log;
+        log.m_bytes.resize(static_cast<size_t>(fileSize));
+        stream.read(reinterpret_cast<char*>(log.m_bytes.data()),
+                    static_cast<std::streamsize>(log.m_bytes.size()));
+        if (!stream) {
+            return std::unexpected(std::make_error_code(std::errc::io_error));
+        }
+
+        const auto* bytes = log.m_bytes.data();
+        if (log.m_bytes.size() < FILE_HEADER_SIZE || std::memcmp(bytes, MAGIC.data(), MAGIC.size()) != 0 ||
+            get<uint16_t>(bytes + 10) != VERSION) {
+            return std::unexpected(std::make_error_code(std::errc::invalid_argument));
+        }
+        log.m_role = static_cast<Role>(get<uint8_t>(bytes + 8));
+        log.m_mode = static_cast<Mode>(get<uint8_t>(bytes + 9));
+
+        for (size_t offset = FILE_HEADER_SIZE; offset + RECORD_HEADER_SIZE <= log.m_bytes.size();) {
+            const auto* header = bytes + offset;
+            const auto size = size_t{ get<uint32_t>(header + 16) };
+            const auto payload = offset + RECORD_HEADER_SIZE;
+            if (payload + size > log.m_bytes.size()) {
+                break;
+            }
+            offset = payload + size;
+
+            const auto kind = static_cast<RecordKind>(get<uint8_t>(header + 20));
+            const auto path = get<uint32_t>(header + 8);
+            if (kind == RecordKind::Path) {
+                if (path != log.m_paths.size()) {
+                    return std::unexpected(std::make_error_code(std::errc::invalid_argument));
+                }
+                log.m_paths.emplace_back(reinterpret_cast<const char*>(bytes + payload), size);
+                continue;
+            }
+            if (path >= log.m_paths.size()) {
+                return std::unexpected(std::make_error_code(std::errc::invalid_argument));
+            }
+
+            Record record{ .time = std::chrono::nanoseconds{ get<uint64_t>(header) },
+                           .kind = kind,
+                           .path = path,
+                           .tag = get<uint32_t>(header + 12),
+                           .offset = payload,
+                           .size = size };
+            if (get<uint8_t>(header + 21) != 0 && size == sizeof(int32_t)) {
+                record.error = std::error_code(get<int32_t>(bytes + payload), std::generic_category());
+                record.size = 0;
+            }
+            log.m_records.push_back(record);
+        }
+        return log;
+    }
+}
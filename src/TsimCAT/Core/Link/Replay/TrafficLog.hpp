@@ -0,0 +1,111 @@
+#pragma once
+
+#include "Link/ILink.hpp"
+
+#include "Common/Result.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <unordered_map>
+#include <vector>
+
+namespace core::link::replay
+{
+    enum class RecordKind : uint8_t
+    {
+        Path, // names the path id it defines; consumed by TrafficLog::load()
+        Read,
+        Write,
+        Subscribe, // `tag` numbers the subscription
+        Sample,    // a value delivered to subscription `tag`
+        Receive,
+        Send
+    };
+
+    // Lets path maps be searched by string_view.
+    struct PathHash
+    {
+        using is_transparent = void;
+        auto operator()(std::string_view path) const -> size_t { return std::hash<std::string_view>{}(path); }
+    };
+
+    struct Record
+    {
+        std::chrono::nanoseconds time{};
+        RecordKind kind{ RecordKind::Path };
+        uint32_t path{ 0 };
+        uint32_t tag{ 0 };
+        // Set if the call failed; the payload is then empty.
+        std::error_code error{};
+        size_t offset{ 0 };
+        size_t size{ 0 };
+    };
+
+    /**
+     * Writes a traffic log: a 16-byte file header naming the recorded link's role and mode, then per
+     * record a fixed 24-byte header and the payload. A path is spelled out once, in a Path record, and
+     * referred to by id afterwards. Times count from open(). Integers are stored in host byte order,
+     * which is little-endian on every platform the simulator runs on.
+     *
+     * Errors keep their value; a replay reports them in the generic category. Thread-safe.
+     */
+    class TrafficRecorder
+    {
+      public:
+        auto open(const std::filesystem::path& file, Role role, Mode mode) -> result::Result<void>;
+        // Flushes and stops recording; later records are dropped.
+        auto close() -> void;
+
+        auto record(RecordKind kind, std::string_view path, std::span<const std::byte> data, uint32_t tag = 0)
+          -> void;
+        auto recordError(RecordKind kind, std::string_view path, std::error_code error, uint32_t tag = 0)
+          -> void;
+
+      private:
+        using Clock = std::chrono::steady_clock;
+
+        auto pathLocked(std::string_view path) -> uint32_t;
+        auto writeLocked(RecordKind kind,
+                         uint32_t path,
+                         uint32_t tag,
+                         int32_t error,
+                         std::span<const std::byte> data) -> void;
+
+        std::mutex m_mutex;
+        std::ofstream m_stream;
+        Clock::time_point m_start{};
+        std::unordered_map<std::string, uint32_t, PathHash, std::equal_to<>> m_paths;
+    };
+
+    // A traffic log read back whole. Records keep the order they were written in, Path records aside.
+    class TrafficLog
+    {
+      public:
+        static auto load(const std::filesystem::path& file) -> result::Result<TrafficLog>;
+
+        auto role() const -> Role { return m_role; }
+        auto mode() const -> Mode { return m_mode; }
+        auto records() const -> std::span<const Record> { return m_records; }
+        auto data(const Record& record) const -> std::span<const std::byte>
+        {
+            return std::span{ m_bytes }.subspan(record.offset, record.size);
+        }
+        auto path(uint32_t id) const -> std::string_view { return m_paths[id]; }
+        auto pathCount() const -> size_t { return m_paths.size(); }
+
+      private:
+        Role m_role{ Role::Client };
+        Mode m_mode{ Mode::Symbolic };
+        std::vector<std::byte> m_bytes;
+        std::vector<Record> m_records;
+        std::vector<std::string> m_paths;
+    };
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Coroutines/Channel.hpp"
+#include "Coroutines/Generator.hpp"
 
 namespace core::link
 {
@@ -14,9 +15,11 @@ namespace core::link
     {
         const uint64_t id;
         coro::RawBinaryChannel stream;
-        RawSubscription(uint64_t i)
+        // The options are in place before the link can push the first value.
+        RawSubscription(uint64_t i, coro::ChannelOptions options = {})
           : id(i)
         {
+            stream.setOptions(options);
         }
     };
 
@@ -35,7 +38,28 @@ namespace core::link
         auto isValid() const noexcept -> bool { return raw != nullptr; }
         auto id() const noexcept -> uint64_t { return raw ? raw->id : 0; }
 
+        // The received values as a stream for the coro adapters, e.g.
+        // `sub.values() | coro::distinctUntilChanged() | coro::sample(100ms)`. The stream keeps the
+        // subscription alive and ends when it is closed.
+        auto values() const -> coro::AsyncGenerator<T> { return generate(raw, stream); }
+
         coro::BinaryChannel<T> stream;
         std::shared_ptr<RawSubscription> raw;
+
+      private:
+        static auto generate(std::shared_ptr<RawSubscription> keepAlive, coro::BinaryChannel<T> channel)
+          -> coro::AsyncGenerator<T>
+        {
+            if (!keepAlive) {
+                co_return;
+            }
+            while (true) {
+                auto value{ co_await channel.next() };
+                if (!value) {
+                    co_return;
+                }
+                co_yield std::move(*value);
+            }
+        }
     };
 }
\ No newline at end of file
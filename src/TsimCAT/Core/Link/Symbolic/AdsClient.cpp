@@ -3,12 +3,15 @@
 
 #include "format_utils.hpp"
 
+#include <algorithm>
 #include <atomic>
 #include <cassert>
+#include <cstring>
 #include <iostream>
 #include <mutex>
 #include <print>
 #include <unordered_map>
+#include <vector>
 
 namespace
 {
@@ -161,6 +164,44 @@ namespace
         return AdsError::Unknown;
     }
 
+    // TwinCAT serves at most this many sub-requests in one sum command.
+    constexpr size_t MAX_SUM_SYMBOLS{ 500 };
+
+    // A sum command's answer starts with one error code per sub-request; the first failure fails the batch.
+    static auto firstSumError(std::span<const std::byte> response, size_t count) -> AdsError
+    {
+        for (size_t i{ 0 }; i < count; ++i) {
+            uint32_t code{ 0 };
+            std::memcpy(&code, response.data() + i * sizeof(code), sizeof(code));
+            if (code != 0) {
+                return static_cast<AdsError>(code);
+            }
+        }
+        return AdsError::None;
+    }
+
+    // Errors after which a cached symbol handle can no longer be trusted, e.g. after an online change.
+    static auto isStaleHandle(AdsError err) -> bool
+    {
+        return err == AdsError::DeviceInvalidOffset || err == AdsError::DeviceSymbolNotFound ||
+               err == AdsError::DeviceSymbolVersionInvalid || err == AdsError::DeviceSymbolNotActive;
+    }
+
+    // runAsync() as a Task, which withTimeout() can bound.
+    template<typename T>
+    auto runJob(auto job) -> core::coro::Task<T>
+    {
+        co_return co_await core::coro::runAsync<T>(std::move(job));
+    }
+
+    // A request is bounded by its own timeout on the awaiting side. The route's timeout is shared by every
+    // request in flight, so it stays as connect() left it.
+    template<typename T>
+    auto onPool(auto job, std::chrono::milliseconds timeout) -> core::coro::Task<T>
+    {
+        co_return co_await core::coro::withTimeout(runJob<T>(std::move(job)), timeout);
+    }
+
     // Registry for safe 64-bit -> 32-bit callback handling
     static std::mutex s_registryMutex;
     static std::unordered_map<uint32_t, core::link::symbolic::AdsClient*> s_registry;
@@ -185,8 +226,6 @@ namespace core::link::symbolic
       : m_remoteNetId{ strToNetId(remoteNetId) }
       , m_ipAddress(std::move(ipAddress))
       , m_port{ port }
-      , m_route{ nullptr }
-      , m_defaultTimeout{}
       , m_driverId{ s_nextDriverId++ }
     {
         if (!localNetId.empty()) {
@@ -201,6 +240,8 @@ namespace core::link::symbolic
 
     AdsClient::~AdsClient()
     {
+        // Requests a caller gave up on may still be running on the BlockingPool against this client.
+        m_pending.waitUntilIdle();
         (void)disconnect(std::chrono::milliseconds(0));
 
         {
@@ -211,47 +252,67 @@ namespace core::link::symbolic
 
     auto AdsClient::connect(std::chrono::milliseconds timeout) -> coro::Task<result::Result<void>>
     {
-        co_return co_await coro::runAsync<result::Result<void>>([this, timeout]() {
-            auto err{ AdsError::None };
-            try {
-                m_route = std::make_unique<AdsDevice>(m_ipAddress, m_remoteNetId, m_port);
-
-                m_defaultTimeout = getTimeout();
-                m_route->SetTimeout(timeout.count());
-
-                (void)m_route->GetDeviceInfo();
-            } catch (const std::exception& ex) {
-                err = handleException(ex);
-                m_route.reset();
-            }
+        // Holds a permit like the requests do, so the destructor also waits for an abandoned connect.
+        auto permit{ co_await m_pending.acquire() };
+        if (!permit) {
+            co_return std::unexpected(std::make_error_code(std::errc::operation_canceled));
+        }
 
-            return err == AdsError::None ? result::success() : std::unexpected(make_error_code(err));
-        });
+        co_return co_await coro::runAsync<result::Result<void>>(
+          [this, permit = std::make_shared<coro::SemaphorePermit>(std::move(permit)), timeout]() {
+              auto err{ AdsError::None };
+              try {
+                  // Nothing else can use the new route yet, so the connect timeout may be set on it.
+                  auto route{ std::make_shared<Route>(m_ipAddress, m_remoteNetId, m_port) };
+                  const auto defaultTimeout{ route->device.GetTimeout() };
+                  if (timeout.count() > 0) {
+                      route->device.SetTimeout(timeout.count());
+                  }
+                  (void)route->device.GetDeviceInfo();
+                  route->device.SetTimeout(defaultTimeout);
+
+                  std::scoped_lock lock(m_mutex);
+                  m_route = std::move(route);
+              } catch (const std::exception& ex) {
+                  err = handleException(ex);
+              }
+
+              return err == AdsError::None ? result::success() : std::unexpected(make_error_code(err));
+          });
     }
 
-    auto AdsClient::status() const -> Status { return m_route ? Status::Connected : Status::Disconnected; }
+    auto AdsClient::status() const -> Status { return route() ? Status::Connected : Status::Disconnected; }
 
-    auto AdsClient::disconnect(std::chrono::milliseconds timeout) -> coro::Task<result::Result<void>>
+    auto AdsClient::route() const -> std::shared_ptr<Route>
     {
-        if (!m_route) {
-            co_return result::success();
-        }
+        std::scoped_lock lock(m_mutex);
+        return m_route;
+    }
 
+    // Requests still running keep the route until they return; the last one out releases it. Handles
+    // are released with the route's own timeout, which requests in flight share.
+    auto AdsClient::disconnect(std::chrono::milliseconds) -> coro::Task<result::Result<void>>
+    {
         auto err{ AdsError::None };
         try {
-            setTimeout(timeout);
-
+            std::unordered_map<uint32_t, SubscriptionContext> contexts;
+            std::shared_ptr<Route> route;
             {
                 std::scoped_lock lock(m_mutex);
-                for (auto& [id, context] : m_subscriptionContexts) {
-                    if (context.stream) {
-                        context.stream->stream.close();
-                    }
-                }
-                m_subscriptionContexts.clear();
+                route = std::exchange(m_route, nullptr);
+                contexts.swap(m_subscriptionContexts);
+            }
+            if (!route) {
+                co_return result::success();
             }
 
-            m_route.reset();
+            for (auto& [id, context] : contexts) {
+                if (context.stream) {
+                    context.stream->stream.close();
+                }
+            }
+            contexts.clear();
+            route->forgetSymbolHandles();
         } catch (const std::exception& ex) {
             err = handleException(ex);
         }
@@ -259,49 +320,245 @@ namespace core::link::symbolic
         co_return err == AdsError::None ? result::success() : std::unexpected(make_error_code(err));
     }
 
+    // Requests run on the BlockingPool so a hung route stalls a pool thread rather than the station's
+    // executor. The job works on its own copy of the data: a caller that stops waiting (stop request
+    // or timeout) may already have released `dest`/`src` by the time the request returns. The job also
+    // holds the route it was submitted on and the pending-request permit, so an abandoned request keeps
+    // counting until the route answers and the destructor waits for it.
     auto AdsClient::readInto(std::string_view path,
                              std::span<std::byte> dest,
-                             std::chrono::milliseconds timeout) -> coro::Task<result::Result<size_t>>
+                             std::chrono::milliseconds timeout) -> coro::ValueTask<result::Result<size_t>>
     {
-        uint32_t bytesRead = 0;
-        auto err{ AdsError::None };
-        try {
-            setTimeout(timeout);
-
-            auto handle{ m_route->GetHandle(std::string(path)) };
-            err = static_cast<AdsError>(
-              m_route->ReadReqEx2(ADSIGRP_SYM_VALBYHND, *handle, dest.size(), dest.data(), &bytesRead));
-        } catch (const std::exception& ex) {
-            err = handleException(ex);
+        auto permit{ co_await m_pending.acquire() };
+        if (!permit) {
+            co_return std::unexpected(std::make_error_code(std::errc::operation_canceled));
         }
-
-        if (err != AdsError::None) {
-            co_return std::unexpected(make_error_code(err));
+        auto route{ this->route() };
+        if (!route) {
+            co_return std::unexpected(std::make_error_code(std::errc::not_connected));
         }
 
-        if (bytesRead != dest.size()) {
-            co_return std::unexpected(make_error_code(AdsError::Unknown));
+        auto read{ co_await onPool<result::Result<std::vector<std::byte>>>(
+          [route = std::move(route),
+           permit = std::make_shared<coro::SemaphorePermit>(std::move(permit)),
+           symbol = std::string(path),
+           size = dest.size()]() -> result::Result<std::vector<std::byte>> {
+              std::vector<std::byte> buffer(size);
+              uint32_t bytesRead = 0;
+              auto err{ AdsError::None };
+              try {
+                  auto handle{ route->device.GetHandle(symbol) };
+                  err = static_cast<AdsError>(route->device.ReadReqEx2(
+                    ADSIGRP_SYM_VALBYHND, *handle, buffer.size(), buffer.data(), &bytesRead));
+              } catch (const std::exception& ex) {
+                  err = handleException(ex);
+              }
+
+              if (err != AdsError::None) {
+                  return std::unexpected(make_error_code(err));
+              }
+
+              if (bytesRead != buffer.size()) {
+                  return std::unexpected(make_error_code(AdsError::Unknown));
+              }
+
+              return buffer;
+          },
+          timeout) };
+
+        if (!read) {
+            co_return std::unexpected(read.error());
         }
 
-        co_return bytesRead;
+        std::ranges::copy(*read, dest.begin());
+        co_return read->size();
     }
 
     auto AdsClient::writeFrom(std::string_view path,
                               std::span<const std::byte> src,
-                              std::chrono::milliseconds timeout) -> coro::Task<result::Result<void>>
+                              std::chrono::milliseconds timeout) -> coro::ValueTask<result::Result<void>>
     {
-        auto err{ AdsError::None };
-        try {
-            setTimeout(timeout);
+        auto permit{ co_await m_pending.acquire() };
+        if (!permit) {
+            co_return std::unexpected(std::make_error_code(std::errc::operation_canceled));
+        }
+        auto route{ this->route() };
+        if (!route) {
+            co_return std::unexpected(std::make_error_code(std::errc::not_connected));
+        }
 
-            auto handle{ m_route->GetHandle(std::string(path)) };
-            err = static_cast<AdsError>(
-              m_route->WriteReqEx(ADSIGRP_SYM_VALBYHND, *handle, src.size(), src.data()));
-        } catch (const std::exception& ex) {
-            err = handleException(ex);
+        co_return co_await onPool<result::Result<void>>(
+          [route = std::move(route),
+           permit = std::make_shared<coro::SemaphorePermit>(std::move(permit)),
+           symbol = std::string(path),
+           data = std::vector<std::byte>(src.begin(), src.end())] {
+              auto err{ AdsError::None };
+              try {
+                  auto handle{ route->device.GetHandle(symbol) };
+                  err = static_cast<AdsError>(
+                    route->device.WriteReqEx(ADSIGRP_SYM_VALBYHND, *handle, data.size(), data.data()));
+              } catch (const std::exception& ex) {
+                  err = handleException(ex);
+              }
+
+              return err == AdsError::None ? result::success() : std::unexpected(make_error_code(err));
+          },
+          timeout);
+    }
+
+    // The batch goes out as ADS sum commands of up to MAX_SUM_SYMBOLS symbols each, so a station's
+    // exchange costs one round trip instead of one per symbol. Symbol handles are cached for the next
+    // cycle. As with readInto/writeFrom, the job owns copies of the paths and data.
+    auto AdsClient::readMany(std::span<const SymbolRead> symbols, std::chrono::milliseconds timeout)
+      -> coro::ValueTask<result::Result<void>>
+    {
+        auto permit{ co_await m_pending.acquire() };
+        if (!permit) {
+            co_return std::unexpected(std::make_error_code(std::errc::operation_canceled));
+        }
+        auto route{ this->route() };
+        if (!route) {
+            co_return std::unexpected(std::make_error_code(std::errc::not_connected));
         }
 
-        co_return err == AdsError::None ? result::success() : std::unexpected(make_error_code(err));
+        std::vector<std::string> paths;
+        std::vector<uint32_t> sizes;
+        for (const auto& [path, dest] : symbols) {
+            paths.emplace_back(path);
+            sizes.push_back(static_cast<uint32_t>(dest.size()));
+        }
+
+        auto read{ co_await onPool<result::Result<std::vector<std::byte>>>(
+          [route = std::move(route),
+           permit = std::make_shared<coro::SemaphorePermit>(std::move(permit)),
+           paths = std::move(paths),
+           sizes = std::move(sizes)]() -> result::Result<std::vector<std::byte>> {
+              std::vector<std::byte> values;
+              auto err{ AdsError::None };
+              try {
+                  for (size_t first{ 0 }; first < paths.size() && err == AdsError::None;
+                       first += MAX_SUM_SYMBOLS) {
+                      const auto count{ std::min(MAX_SUM_SYMBOLS, paths.size() - first) };
+                      // One {group, offset, length} triple per symbol, read by handle.
+                      std::vector<uint32_t> request;
+                      size_t valueBytes{ 0 };
+                      for (auto i{ first }; i < first + count; ++i) {
+                          request.insert(request.end(),
+                                         { ADSIGRP_SYM_VALBYHND, route->symbolHandle(paths[i]), sizes[i] });
+                          valueBytes += sizes[i];
+                      }
+
+                      // Answered with the error codes, then every value back to back.
+                      std::vector<std::byte> response(count * sizeof(uint32_t) + valueBytes);
+                      uint32_t bytesRead = 0;
+                      err = static_cast<AdsError>(
+                        route->device.ReadWriteReqEx2(ADSIGRP_SUMUP_READ,
+                                                      static_cast<uint32_t>(count),
+                                                      response.size(),
+                                                      response.data(),
+                                                      request.size() * sizeof(uint32_t),
+                                                      request.data(),
+                                                      &bytesRead));
+                      if (err == AdsError::None) {
+                          err = firstSumError(response, count);
+                      }
+                      if (err == AdsError::None && bytesRead != response.size()) {
+                          err = AdsError::Unknown;
+                      }
+                      const auto errors{ static_cast<std::ptrdiff_t>(count * sizeof(uint32_t)) };
+                      values.insert(values.end(), response.begin() + errors, response.end());
+                  }
+              } catch (const std::exception& ex) {
+                  err = handleException(ex);
+              }
+
+              if (err != AdsError::None) {
+                  if (isStaleHandle(err)) {
+                      route->forgetSymbolHandles();
+                  }
+                  return std::unexpected(make_error_code(err));
+              }
+              return values;
+          },
+          timeout) };
+
+        if (!read) {
+            co_return std::unexpected(read.error());
+        }
+
+        auto value{ read->begin() };
+        for (const auto& [path, dest] : symbols) {
+            value = std::ranges::copy_n(value, static_cast<std::ptrdiff_t>(dest.size()), dest.begin()).in;
+        }
+        co_return result::success();
+    }
+
+    auto AdsClient::writeMany(std::span<const SymbolWrite> symbols, std::chrono::milliseconds timeout)
+      -> coro::ValueTask<result::Result<void>>
+    {
+        auto permit{ co_await m_pending.acquire() };
+        if (!permit) {
+            co_return std::unexpected(std::make_error_code(std::errc::operation_canceled));
+        }
+        auto route{ this->route() };
+        if (!route) {
+            co_return std::unexpected(std::make_error_code(std::errc::not_connected));
+        }
+
+        std::vector<std::string> paths;
+        std::vector<std::vector<std::byte>> values;
+        for (const auto& [path, src] : symbols) {
+            paths.emplace_back(path);
+            values.emplace_back(src.begin(), src.end());
+        }
+
+        co_return co_await onPool<result::Result<void>>(
+          [route = std::move(route),
+           permit = std::make_shared<coro::SemaphorePermit>(std::move(permit)),
+           paths = std::move(paths),
+           values = std::move(values)] {
+              auto err{ AdsError::None };
+              try {
+                  for (size_t first{ 0 }; first < paths.size() && err == AdsError::None;
+                       first += MAX_SUM_SYMBOLS) {
+                      const auto count{ std::min(MAX_SUM_SYMBOLS, paths.size() - first) };
+                      // One {group, offset, length} triple per symbol, then every value back to back.
+                      std::vector<std::byte> request(count * 3 * sizeof(uint32_t));
+                      for (auto i{ first }; i < first + count; ++i) {
+                          const uint32_t header[]{ ADSIGRP_SYM_VALBYHND,
+                                                   route->symbolHandle(paths[i]),
+                                                   static_cast<uint32_t>(values[i].size()) };
+                          std::memcpy(request.data() + (i - first) * sizeof(header), header, sizeof(header));
+                      }
+                      for (auto i{ first }; i < first + count; ++i) {
+                          request.insert(request.end(), values[i].begin(), values[i].end());
+                      }
+
+                      // Answered with one error code per symbol.
+                      std::vector<std::byte> response(count * sizeof(uint32_t));
+                      uint32_t bytesRead = 0;
+                      err = static_cast<AdsError>(
+                        route->device.ReadWriteReqEx2(ADSIGRP_SUMUP_WRITE,
+                                                      static_cast<uint32_t>(count),
+                                                      response.size(),
+                                                      response.data(),
+                                                      request.size(),
+                                                      request.data(),
+                                                      &bytesRead));
+                      if (err == AdsError::None) {
+                          err = firstSumError(response, count);
+                      }
+                  }
+              } catch (const std::exception& ex) {
+                  err = handleException(ex);
+              }
+
+              if (err != AdsError::None && isStaleHandle(err)) {
+                  route->forgetSymbolHandles();
+              }
+              return err == AdsError::None ? result::success() : std::unexpected(make_error_code(err));
+          },
+          timeout);
     }
 
     void AdsClient::NotificationCallback(const AmsAddr* pAddr,
@@ -327,27 +584,27 @@ namespace core::link::symbolic
     void AdsClient::OnNotification(const AdsNotificationHeader* pNotification)
     {
         std::shared_ptr<RawSubscription> stream;
-        std::vector<std::byte> data;
 
         {
             std::scoped_lock lock(m_mutex);
             if (auto it = m_subscriptionContexts.find(pNotification->hNotification);
                 it != m_subscriptionContexts.end()) {
                 stream = it->second.stream;
-                const auto* dataPtr = reinterpret_cast<const std::byte*>(pNotification + 1);
-                data.assign(dataPtr, dataPtr + pNotification->cbSampleSize);
             }
         }
 
+        // The sample stays valid for the duration of the callback; small samples are copied inline.
         if (stream) {
-            stream->stream.push(std::move(data));
+            const auto* dataPtr = reinterpret_cast<const std::byte*>(pNotification + 1);
+            stream->stream.push(std::span{ dataPtr, pNotification->cbSampleSize });
         }
     }
 
     auto AdsClient::subscribeRaw(std::string_view path,
                                  size_t size,
                                  SubscriptionType type,
-                                 std::chrono::milliseconds interval)
+                                 std::chrono::milliseconds interval,
+                                 coro::ChannelOptions options)
       -> coro::Task<result::Result<std::shared_ptr<RawSubscription>>>
     {
         uint32_t transMode{ static_cast<uint32_t>(
@@ -359,24 +616,30 @@ namespace core::link::symbolic
                                       .nMaxDelay = 0,
                                       .nCycleTime = cycleTime };
 
+        auto route{ this->route() };
+        if (!route) {
+            co_return std::unexpected(std::make_error_code(std::errc::not_connected));
+        }
+
         auto err{ AdsError::None };
         try {
-            auto symbolHandle{ m_route->GetHandle(std::string(path)) };
-            auto notificationHandle{ m_route->GetHandle(
+            auto symbolHandle{ route->device.GetHandle(std::string(path)) };
+            auto notificationHandle{ route->device.GetHandle(
               ADSIGRP_SYM_VALBYHND, *symbolHandle, attrib, &AdsClient::NotificationCallback, m_driverId) };
             auto id{ *notificationHandle };
 
             std::scoped_lock lock(m_mutex);
             // Custom deleter to ensure we unsubscribe ONLY when the last reference dies
             auto rawSub =
-              std::shared_ptr<RawSubscription>(new RawSubscription(id), [this](RawSubscription* p) {
+              std::shared_ptr<RawSubscription>(new RawSubscription(id, options), [this](RawSubscription* p) {
                 this->unsubscribeRawSync(p->id);
                 delete p;
             });
 
             m_subscriptionContexts.emplace(
               id,
-              SubscriptionContext{ .symbolHandle = std::move(symbolHandle),
+              SubscriptionContext{ .route = std::move(route),
+                                   .symbolHandle = std::move(symbolHandle),
                                    .notificationHandle = std::move(notificationHandle),
                                    .stream = rawSub });
 
@@ -412,15 +675,30 @@ namespace core::link::symbolic
         }
     }
 
-    auto AdsClient::getTimeout() -> std::chrono::milliseconds
+    // Resolving is a round trip of its own, so it happens outside the lock.
+    auto AdsClient::Route::symbolHandle(const std::string& path) -> uint32_t
     {
-        return std::chrono::milliseconds(m_route->GetTimeout());
+        {
+            std::scoped_lock lock(mutex);
+            if (auto it = symbolHandles.find(path); it != symbolHandles.end()) {
+                return *it->second;
+            }
+        }
+
+        auto handle{ device.GetHandle(path) };
+        std::scoped_lock lock(mutex);
+        // Another batch may have resolved it meanwhile; ours is then released once the lock is gone.
+        auto [it, inserted] = symbolHandles.try_emplace(path, std::move(handle));
+        return *it->second;
     }
 
-    auto AdsClient::setTimeout(std::chrono::milliseconds timeout) -> void
+    auto AdsClient::Route::forgetSymbolHandles() -> void
     {
-        auto ms{ timeout.count() };
-        m_route->SetTimeout(ms ? ms : m_defaultTimeout.count());
+        std::unordered_map<std::string, AdsHandle> handles;
+        {
+            std::scoped_lock lock(mutex);
+            handles.swap(symbolHandles);
+        }
     }
 
 }
\ No newline at end of file
@@ -2,11 +2,15 @@
 
 #include "ISymbolicLink.hpp"
 
+#include "Coroutines/Sync.hpp"
+
 #include <AdsLib/AdsDevice.h>
 #include <AdsLib/AdsLib.h>
 #include <AdsLib/AdsNotificationOOI.h>
 #include <AdsLib/AdsVariable.h>
 
+#include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 
@@ -29,15 +33,20 @@ namespace core::link::symbolic
 
         auto readInto(std::string_view path,
                       std::span<std::byte> dest,
-                      std::chrono::milliseconds timeout = NO_TIMEOUT) -> coro::Task<result::Result<size_t>> override;
+                      std::chrono::milliseconds timeout = NO_TIMEOUT) -> coro::ValueTask<result::Result<size_t>> override;
         auto writeFrom(std::string_view path,
                        std::span<const std::byte> src,
-                       std::chrono::milliseconds timeout = NO_TIMEOUT) -> coro::Task<result::Result<void>> override;
+                       std::chrono::milliseconds timeout = NO_TIMEOUT) -> coro::ValueTask<result::Result<void>> override;
+        auto readMany(std::span<const SymbolRead> symbols,
+                      std::chrono::milliseconds timeout = NO_TIMEOUT) -> coro::ValueTask<result::Result<void>> override;
+        auto writeMany(std::span<const SymbolWrite> symbols,
+                       std::chrono::milliseconds timeout = NO_TIMEOUT) -> coro::ValueTask<result::Result<void>> override;
 
         auto subscribeRaw(std::string_view path,
                        size_t size,
                        SubscriptionType type = SubscriptionType::OnChange,
-                       std::chrono::milliseconds interval = NO_TIMEOUT) -> coro::Task<result::Result<std::shared_ptr<RawSubscription>>> override;
+                       std::chrono::milliseconds interval = NO_TIMEOUT,
+                       coro::ChannelOptions options = {}) -> coro::Task<result::Result<std::shared_ptr<RawSubscription>>> override;
         auto unsubscribeRaw(std::shared_ptr<RawSubscription> subscription) -> coro::Task<result::Result<void>> override;
         auto unsubscribeRawSync(uint64_t id) -> void override;
         // clang-format on
@@ -45,11 +54,31 @@ namespace core::link::symbolic
         auto status() const -> Status override;
 
       private:
-        auto getTimeout() -> std::chrono::milliseconds;
-        auto setTimeout(std::chrono::milliseconds timeout) -> void;
+        // One connection. Requests hold it while they run, so a disconnect or reconnect meanwhile cannot
+        // free the device under them. Its symbol handles are released before the device.
+        struct Route
+        {
+            Route(const std::string& ipAddress, const AmsNetId& netId, uint16_t port)
+              : device{ ipAddress, netId, port }
+            {
+            }
+
+            // Sum commands address symbols by handle; these are kept until an error suggests they went
+            // stale.
+            auto symbolHandle(const std::string& path) -> uint32_t;
+            auto forgetSymbolHandles() -> void;
+
+            AdsDevice device;
+            std::mutex mutex{};
+            std::unordered_map<std::string, AdsHandle> symbolHandles{};
+        };
+
+        // Null while disconnected.
+        auto route() const -> std::shared_ptr<Route>;
 
         struct SubscriptionContext
         {
+            std::shared_ptr<Route> route;
             AdsHandle symbolHandle;
             AdsHandle notificationHandle;
             std::shared_ptr<RawSubscription> stream;
@@ -64,10 +93,9 @@ namespace core::link::symbolic
         std::string m_ipAddress;
         uint16_t m_port;
 
-        std::unique_ptr<AdsDevice> m_route;
-        std::chrono::milliseconds m_defaultTimeout;
-
-        std::mutex m_mutex;
+        mutable std::mutex m_mutex;
+        std::shared_ptr<Route> m_route;
+        coro::AsyncSemaphore m_pending{ MAX_PENDING_REQUESTS };
         uint32_t m_driverId;
         std::unordered_map<uint32_t, SubscriptionContext> m_subscriptionContexts;
     };
@@ -0,0 +1,161 @@
+#include "CyclicSampler.hpp"
+
+#include <algorithm>
+#include <iterator>
+
+namespace core::link::symbolic
+{
+    CyclicSampler::CyclicSampler(const ProcessImage& image, raw::AsioExecutor& reactor)
+      : m_image(image)
+      , m_reactor(reactor)
+      , m_timer(reactor.context())
+    {
+    }
+
+    auto CyclicSampler::add(SymbolHandle symbol,
+                            std::chrono::milliseconds interval,
+                            std::shared_ptr<RawSubscription> stream) -> void
+    {
+        {
+            std::scoped_lock lock(m_mutex);
+            auto group = std::ranges::find(m_groups, interval, &Group::interval);
+            if (group == m_groups.end()) {
+                m_groups.push_back(Group{ .interval = interval, .due = Clock::now() + interval });
+                group = std::prev(m_groups.end());
+            }
+            auto at = std::ranges::upper_bound(
+              group->members, symbol.index, {}, [](const Member& member) { return member.symbol.index; });
+            group->members.insert(at, Member{ .symbol = symbol, .stream = std::move(stream) });
+        }
+        // A new group may come due before the timer would fire.
+        asio::post(m_reactor.context(), [self = shared_from_this()] { self->arm(); });
+    }
+
+    auto CyclicSampler::remove(uint64_t id) -> std::shared_ptr<RawSubscription>
+    {
+        std::scoped_lock lock(m_mutex);
+        for (auto group = m_groups.begin(); group != m_groups.end(); ++group) {
+            auto member = std::ranges::find_if(
+              group->members, [id](const Member& member) { return member.stream->id == id; });
+            if (member == group->members.end()) {
+                continue;
+            }
+            auto stream = std::move(member->stream);
+            group->members.erase(member);
+            if (group->members.empty()) {
+                m_groups.erase(group);
+            }
+            return stream;
+        }
+        return nullptr;
+    }
+
+    auto CyclicSampler::clear() -> std::vector<std::shared_ptr<RawSubscription>>
+    {
+        std::vector<std::shared_ptr<RawSubscription>> streams;
+        std::scoped_lock lock(m_mutex);
+        for (auto& group : m_groups) {
+            for (auto& member : group.members) {
+                streams.push_back(std::move(member.stream));
+            }
+        }
+        m_groups.clear();
+        return streams;
+    }
+
+    // Waits out a sample already running on the reactor; none starts afterwards.
+    auto CyclicSampler::stop() -> void
+    {
+        m_reactor.invoke([this] {
+            {
+                std::scoped_lock lock(m_mutex);
+                m_stopped = true;
+                m_groups.clear();
+            }
+            m_timer.cancel();
+        });
+    }
+
+    auto CyclicSampler::subscriptionCount() const -> size_t
+    {
+        std::scoped_lock lock(m_mutex);
+        size_t count = 0;
+        for (const auto& group : m_groups) {
+            count += group.members.size();
+        }
+        return count;
+    }
+
+    auto CyclicSampler::arm() -> void
+    {
+        auto due = Clock::time_point::max();
+        {
+            std::scoped_lock lock(m_mutex);
+            if (m_stopped) {
+                return;
+            }
+            for (const auto& group : m_groups) {
+                due = std::min(due, group.due);
+            }
+        }
+        if (due == Clock::time_point::max()) {
+            m_timer.cancel();
+            return;
+        }
+
+        // Re-arming cancels the previous wait, which then completes with operation_aborted.
+        m_timer.expires_at(due);
+        m_timer.async_wait([self = shared_from_this()](const asio::error_code& ec) {
+            if (!ec) {
+                self->tick();
+            }
+        });
+    }
+
+    auto CyclicSampler::tick() -> void
+    {
+        {
+            std::scoped_lock lock(m_mutex);
+            if (m_stopped) {
+                return;
+            }
+            const auto now = Clock::now();
+            for (auto& group : m_groups) {
+                if (group.due > now) {
+                    continue;
+                }
+                sampleLocked(group);
+                // A group that fell behind skips the periods it missed rather than bursting.
+                group.due += group.interval;
+                if (group.due <= now) {
+                    group.due = now + group.interval;
+                }
+            }
+        }
+        arm();
+    }
+
+    auto CyclicSampler::sampleLocked(Group& group) -> void
+    {
+        for (size_t i = 0; i < group.members.size();) {
+            const auto symbol = group.members[i].symbol;
+            m_buffer.resize(m_image.size(symbol));
+            const auto size = m_image.read(symbol, m_buffer);
+            const auto value = std::span<const std::byte>{ m_buffer }.first(std::min(size, m_buffer.size()));
+
+            coro::RawBinaryChannel::SharedBytes shared;
+            for (; i < group.members.size() && group.members[i].symbol == symbol; ++i) {
+                auto& stream = group.members[i].stream->stream;
+                if (value.size() <= coro::RawBinaryChannel::INLINE_CAPACITY) {
+                    stream.push(value);
+                    continue;
+                }
+                if (!shared) {
+                    shared =
+                      std::make_shared<const coro::RawBinaryChannel::Bytes>(value.begin(), value.end());
+                }
+                stream.push(shared);
+            }
+        }
+    }
+}
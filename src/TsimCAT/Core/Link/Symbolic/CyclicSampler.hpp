@@ -0,0 +1,74 @@
+#pragma once
+
+#include "Link/Raw/AsioExecutor.hpp"
+#include "Link/Subscription.hpp"
+#include "ProcessImage.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace core::link::symbolic
+{
+    /**
+     * Delivers cyclic subscriptions at the rate they asked for instead of on every write. Subscriptions
+     * with the same interval form one group that shares a deadline; when it comes due, each symbol in
+     * the group is read from the image once and its value pushed to all of the group's subscribers of
+     * that symbol. One timer on the reactor serves every group.
+     *
+     * Sampling reads the image without locking, so it never holds up writers. stop() must be called
+     * before the image goes away; afterwards no sample touches it.
+     */
+    class CyclicSampler : public std::enable_shared_from_this<CyclicSampler>
+    {
+      public:
+        CyclicSampler(const ProcessImage& image, raw::AsioExecutor& reactor);
+
+        CyclicSampler(const CyclicSampler&) = delete;
+        auto operator=(const CyclicSampler&) -> CyclicSampler& = delete;
+
+        auto add(SymbolHandle symbol,
+                 std::chrono::milliseconds interval,
+                 std::shared_ptr<RawSubscription> stream) -> void;
+        // Returns the removed subscription, or null if it was not sampled here.
+        auto remove(uint64_t id) -> std::shared_ptr<RawSubscription>;
+        // Drops every subscription and hands them back, e.g. for closing on disconnect.
+        auto clear() -> std::vector<std::shared_ptr<RawSubscription>>;
+        auto stop() -> void;
+
+        auto subscriptionCount() const -> size_t;
+
+      private:
+        using Clock = std::chrono::steady_clock;
+
+        struct Member
+        {
+            SymbolHandle symbol{};
+            std::shared_ptr<RawSubscription> stream;
+        };
+
+        struct Group
+        {
+            std::chrono::milliseconds interval{};
+            Clock::time_point due{};
+            // Kept sorted by symbol so one read serves every subscriber of a symbol.
+            std::vector<Member> members;
+        };
+
+        // Both run on the reactor thread, which owns the timer.
+        auto arm() -> void;
+        auto tick() -> void;
+        auto sampleLocked(Group& group) -> void;
+
+        const ProcessImage& m_image;
+        raw::AsioExecutor& m_reactor;
+        asio::steady_timer m_timer;
+        mutable std::mutex m_mutex;
+        std::vector<Group> m_groups;
+        std::vector<std::byte> m_buffer;
+        bool m_stopped{ false };
+    };
+}
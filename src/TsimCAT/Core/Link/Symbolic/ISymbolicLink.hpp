@@ -6,42 +6,78 @@
 #include "Common/Result.hpp"
 
 #include "Coroutines/Task.hpp"
+#include "Coroutines/ValueTask.hpp"
 
 #include <span>
 #include <string_view>
 
 namespace core::link
 {
+    // One symbol of a batched access: its path and the caller's buffer for the value.
+    struct SymbolRead
+    {
+        std::string_view path;
+        std::span<std::byte> dest;
+    };
+
+    struct SymbolWrite
+    {
+        std::string_view path;
+        std::span<const std::byte> src;
+    };
+
     class ISymbolicLink : virtual public ILink
     {
       public:
         auto asSymbolic() -> ISymbolicLink* override { return this; }
         auto getMode() const -> Mode override { return Mode::Symbolic; }
 
+        // In-process links complete these inline and return a ready ValueTask, so the access itself has
+        // already happened when the call returns; remote links return a pending Task.
         // clang-format off
         virtual auto readInto(std::string_view path,
                               std::span<std::byte> dest,
-                              std::chrono::milliseconds timeout = NO_TIMEOUT) -> coro::Task<result::Result<size_t>> = 0;
+                              std::chrono::milliseconds timeout = NO_TIMEOUT) -> coro::ValueTask<result::Result<size_t>> = 0;
 
         virtual auto writeFrom(std::string_view path,
                                std::span<const std::byte> src,
-                               std::chrono::milliseconds timeout = NO_TIMEOUT) -> coro::Task<result::Result<void>> = 0;
+                               std::chrono::milliseconds timeout = NO_TIMEOUT) -> coro::ValueTask<result::Result<void>> = 0;
 
+        // Batched access for a station's per-cycle exchange: one request to a remote device, one lock on
+        // a local image. A batch fails as a whole with the first error; after a failed write some of its
+        // symbols may already hold their new value.
+        virtual auto readMany(std::span<const SymbolRead> symbols,
+                              std::chrono::milliseconds timeout = NO_TIMEOUT) -> coro::ValueTask<result::Result<void>> = 0;
+
+        virtual auto writeMany(std::span<const SymbolWrite> symbols,
+                               std::chrono::milliseconds timeout = NO_TIMEOUT) -> coro::ValueTask<result::Result<void>> = 0;
+
+        // `options` are applied to the stream before the subscription goes live. Links push from under
+        // their own locks, so a bounded stream must not use OverflowPolicy::Block.
         virtual auto subscribeRaw(std::string_view path,
                                   size_t size,
                                   SubscriptionType type = SubscriptionType::OnChange,
-                                  std::chrono::milliseconds interval = NO_TIMEOUT) -> coro::Task<result::Result<std::shared_ptr<RawSubscription>>> = 0;
+                                  std::chrono::milliseconds interval = NO_TIMEOUT,
+                                  coro::ChannelOptions options = {}) -> coro::Task<result::Result<std::shared_ptr<RawSubscription>>> = 0;
 
         virtual auto unsubscribeRaw(std::shared_ptr<RawSubscription> subscription) -> coro::Task<result::Result<void>> = 0;
         virtual auto unsubscribeRawSync(uint64_t id) -> void = 0;
         // clang-format on
 
+        // The typed helpers bound the whole call by `timeout` through the caller's stop token: once it
+        // elapses they return std::errc::timed_out even if the driver underneath is still blocked. A
+        // caller that has already been stopped is refused before the link is touched.
         template<typename T>
         auto read(std::string_view path, std::chrono::milliseconds timeout = NO_TIMEOUT)
           -> coro::Task<result::Result<T>>
         {
+            const auto stopToken{ co_await coro::currentStopToken() };
+            if (stopToken.stop_requested()) {
+                co_return std::unexpected(std::make_error_code(std::errc::operation_canceled));
+            }
             T value{};
-            auto res{ co_await readInto(path, std::as_writable_bytes(std::span{ &value, 1 }), timeout) };
+            auto res{ co_await coro::withTimeout(
+              readInto(path, std::as_writable_bytes(std::span{ &value, 1 }), timeout), timeout) };
             if (!res) {
                 co_return std::unexpected(res.error());
             }
@@ -51,16 +87,29 @@ namespace core::link
         auto write(std::string_view path, const auto& value, std::chrono::milliseconds timeout = NO_TIMEOUT)
           -> coro::Task<result::Result<void>>
         {
-            co_return co_await writeFrom(path, std::as_bytes(std::span{ &value, 1 }), timeout);
+            const auto stopToken{ co_await coro::currentStopToken() };
+            if (stopToken.stop_requested()) {
+                co_return std::unexpected(std::make_error_code(std::errc::operation_canceled));
+            }
+            auto res{ co_await coro::withTimeout(
+              writeFrom(path, std::as_bytes(std::span{ &value, 1 }), timeout), timeout) };
+            co_return res;
         }
 
+        // `options` bound the subscription's buffer for consumers that fall behind; cyclic process data
+        // usually wants OverflowPolicy::Conflate. A bounded OverflowPolicy::Block would stall the link's
+        // producer thread and is refused with std::errc::invalid_argument.
         template<typename T>
         auto subscribe(std::string_view path,
                        SubscriptionType type = SubscriptionType::OnChange,
-                       std::chrono::milliseconds interval = NO_TIMEOUT)
-          -> coro::Task<result::Result<Subscription<T>>>
+                       std::chrono::milliseconds interval = NO_TIMEOUT,
+                       coro::ChannelOptions options = {}) -> coro::Task<result::Result<Subscription<T>>>
         {
-            auto rawSub{ co_await subscribeRaw(path, sizeof(T), type, interval) };
+            if (options.overflow == coro::OverflowPolicy::Block
+                && options.capacity != coro::ChannelOptions::UNBOUNDED) {
+                co_return std::unexpected(std::make_error_code(std::errc::invalid_argument));
+            }
+            auto rawSub{ co_await subscribeRaw(path, sizeof(T), type, interval, options) };
             if (!rawSub) {
                 co_return std::unexpected(rawSub.error());
             }
@@ -1,6 +1,80 @@
 #include "LocalAdsLink.hpp"
+#include "CyclicSampler.hpp"
 
 #include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+    using core::link::symbolic::SymbolHandle;
+
+    // Writes staged by the cycle open on this thread. The buffers keep their capacity between cycles.
+    struct StagedCycle
+    {
+        struct Write
+        {
+            SymbolHandle symbol{};
+            size_t offset{ 0 };
+            size_t size{ 0 };
+            bool changed{ false };
+        };
+
+        const void* link{ nullptr };
+        uint32_t depth{ 0 };
+        std::vector<Write> writes;
+        std::vector<std::byte> bytes;
+
+        auto value(const Write& write) const -> std::span<const std::byte>
+        {
+            return std::span{ bytes }.subspan(write.offset, write.size);
+        }
+
+        auto find(SymbolHandle symbol) -> Write*
+        {
+            auto it = std::ranges::find(writes, symbol, &Write::symbol);
+            return it != writes.end() ? &*it : nullptr;
+        }
+
+        // A symbol written again keeps one entry holding its latest value.
+        auto stage(SymbolHandle symbol, std::span<const std::byte> src) -> void
+        {
+            auto* write = find(symbol);
+            if (write && write->size == src.size()) {
+                std::ranges::copy(src, bytes.begin() + static_cast<std::ptrdiff_t>(write->offset));
+                return;
+            }
+            const auto offset = bytes.size();
+            bytes.insert(bytes.end(), src.begin(), src.end());
+            if (write) {
+                write->offset = offset;
+                write->size = src.size();
+                return;
+            }
+            writes.push_back(Write{ .symbol = symbol, .offset = offset, .size = src.size() });
+        }
+    };
+
+    thread_local StagedCycle s_cycle;
+
+    // Serves a read from the cycle `link` has open on this thread, if it staged the symbol.
+    auto readStaged(const void* link, SymbolHandle symbol, std::span<std::byte> dest) -> bool
+    {
+        if (s_cycle.link != link) {
+            return false;
+        }
+        const auto* staged = s_cycle.find(symbol);
+        if (staged == nullptr) {
+            return false;
+        }
+        const auto value = s_cycle.value(*staged);
+        const auto count = std::min(value.size(), dest.size());
+        std::memcpy(dest.data(), value.data(), count);
+        std::ranges::fill(dest.subspan(count), std::byte{});
+        return true;
+    }
+}
 
 namespace core::link::symbolic
 {
@@ -9,6 +83,19 @@ namespace core::link::symbolic
     {
     }
 
+    LocalAdsLink::LocalAdsLink(std::string instanceName, SharedSegment sharedImage)
+      : m_instanceName(std::move(instanceName))
+      , m_image(std::move(sharedImage))
+    {
+    }
+
+    LocalAdsLink::~LocalAdsLink()
+    {
+        if (m_sampler) {
+            m_sampler->stop();
+        }
+    }
+
     auto LocalAdsLink::connect(std::chrono::milliseconds) -> coro::Task<result::Result<void>>
     {
         std::scoped_lock lock(m_mutex);
@@ -18,60 +105,117 @@ namespace core::link::symbolic
 
     auto LocalAdsLink::disconnect(std::chrono::milliseconds) -> coro::Task<result::Result<void>>
     {
-        std::unordered_map<uint64_t, SubscriptionContext> subscriptions;
+        std::vector<std::vector<Subscriber>> subscribers;
+        std::vector<std::shared_ptr<RawSubscription>> sampled;
         {
             std::scoped_lock lock(m_mutex);
             m_status = Status::Disconnected;
-            subscriptions = std::move(m_subscriptions);
+            subscribers = std::move(m_subscribers);
+            m_subscribers.clear();
             m_subscriptions.clear();
+            if (m_sampler) {
+                sampled = m_sampler->clear();
+            }
         }
 
-        for (auto& [id, context] : subscriptions) {
-            if (context.stream) {
-                context.stream->stream.close();
+        for (auto& symbolSubscribers : subscribers) {
+            for (auto& subscriber : symbolSubscribers) {
+                subscriber.stream->stream.close();
             }
         }
+        for (auto& subscription : sampled) {
+            subscription->stream.close();
+        }
 
         co_return result::success();
     }
 
+    // Local access never blocks: both complete inline and hand back a ready value without a coroutine
+    // frame. The timeout has nothing to bound; stopped callers are refused by the typed helpers.
     auto LocalAdsLink::readInto(std::string_view path, std::span<std::byte> dest, std::chrono::milliseconds)
-      -> coro::Task<result::Result<size_t>>
+      -> coro::ValueTask<result::Result<size_t>>
     {
-        co_return readBytesSync(path, dest);
+        return readBytesSync(path, dest);
     }
 
     auto LocalAdsLink::writeFrom(std::string_view path,
                                  std::span<const std::byte> src,
-                                 std::chrono::milliseconds) -> coro::Task<result::Result<void>>
+                                 std::chrono::milliseconds) -> coro::ValueTask<result::Result<void>>
     {
         writeBytesSync(path, src);
-        co_return result::success();
+        return result::success();
+    }
+
+    auto LocalAdsLink::readMany(std::span<const SymbolRead> symbols, std::chrono::milliseconds)
+      -> coro::ValueTask<result::Result<void>>
+    {
+        std::scoped_lock lock(m_mutex);
+        for (const auto& [path, dest] : symbols) {
+            const auto symbol = m_image.add(path, dest.size());
+            if (!readStaged(this, symbol, dest)) {
+                m_image.read(symbol, dest);
+            }
+        }
+        return result::success();
+    }
+
+    // The batch is staged like a cycle of its own, or joins the cycle already open on this thread.
+    auto LocalAdsLink::writeMany(std::span<const SymbolWrite> symbols, std::chrono::milliseconds)
+      -> coro::ValueTask<result::Result<void>>
+    {
+        if (s_cycle.link != nullptr && s_cycle.link != this) {
+            // This thread is staging for another link; write straight through instead.
+            std::scoped_lock lock(m_mutex);
+            for (const auto& [path, src] : symbols) {
+                writeLocked(m_image.add(path, src.size()), src);
+            }
+            return result::success();
+        }
+
+        const ScopedCycle cycle{ this };
+        std::scoped_lock lock(m_mutex);
+        for (const auto& [path, src] : symbols) {
+            s_cycle.stage(m_image.add(path, src.size()), src);
+        }
+        return result::success();
     }
 
     auto LocalAdsLink::subscribeRaw(std::string_view path,
                                     size_t size,
                                     SubscriptionType type,
-                                    std::chrono::milliseconds)
+                                    std::chrono::milliseconds interval,
+                                    coro::ChannelOptions options)
       -> coro::Task<result::Result<std::shared_ptr<RawSubscription>>>
     {
-        auto subscription = std::make_shared<RawSubscription>(m_nextSubscriptionId++);
-        std::vector<std::byte> currentValue;
+        // A cyclic subscription with an interval is sampled at that rate; without one it hears every write.
+        const bool sampled = type == SubscriptionType::Cyclic && interval > NO_TIMEOUT;
 
+        std::shared_ptr<RawSubscription> subscription;
         {
             std::scoped_lock lock(m_mutex);
-            auto& symbol = ensureSymbolLocked(path, size);
-            currentValue = symbol;
-            m_subscriptions.emplace(subscription->id,
-                                    SubscriptionContext{ .path = std::string(path),
-                                                         .size = size,
-                                                         .type = type,
-                                                         .stream = subscription,
-                                                         .lastValue = currentValue });
-        }
+            subscription = std::make_shared<RawSubscription>(m_nextSubscriptionId++, options);
+            const auto symbol = m_image.add(path, size);
+            if (!sampled) {
+                if (m_subscribers.size() <= symbol.index) {
+                    m_subscribers.resize(symbol.index + 1);
+                }
+                m_subscribers[symbol.index].push_back(
+                  Subscriber{ .id = subscription->id, .type = type, .stream = subscription });
+                m_subscriptions.emplace(subscription->id, symbol);
+            }
 
-        if (!currentValue.empty()) {
-            subscription->stream.push(currentValue);
+            // Under the lock, so the current value cannot overtake a concurrent write.
+            if (std::vector<std::byte> bytes(m_image.size(symbol)); !bytes.empty()) {
+                m_image.read(symbol, bytes);
+                subscription->stream.push(std::span<const std::byte>{ bytes });
+            }
+
+            if (sampled) {
+                if (!m_sampler) {
+                    m_sampler = std::make_shared<CyclicSampler>(m_image, raw::AsioExecutor::shared());
+                }
+                m_sampler->add(symbol, interval, subscription);
+            }
         }
 
         co_return subscription;
@@ -92,9 +236,15 @@ namespace core::link::symbolic
         {
             std::scoped_lock lock(m_mutex);
             if (auto it = m_subscriptions.find(id); it != m_subscriptions.end()) {
-                subscription = it->second.stream;
+                auto& subscribers = m_subscribers[it->second.index];
+                auto subscriber = std::ranges::find(subscribers, id, &Subscriber::id);
+                subscription = std::move(subscriber->stream);
+                subscribers.erase(subscriber);
                 m_subscriptions.erase(it);
             }
+            else if (m_sampler) {
+                subscription = m_sampler->remove(id);
+            }
         }
 
         if (subscription) {
@@ -103,63 +253,147 @@ namespace core::link::symbolic
     }
 
     auto LocalAdsLink::status() const -> Status
+    {
+        return m_status.load(std::memory_order_acquire);
+    }
+
+    auto LocalAdsLink::registerSymbol(std::string_view path, size_t size) -> SymbolHandle
     {
         std::scoped_lock lock(m_mutex);
-        return m_status;
+        return m_image.add(path, size);
+    }
+
+    auto LocalAdsLink::findSymbol(std::string_view path) const -> SymbolHandle
+    {
+        return m_image.find(path);
     }
 
     auto LocalAdsLink::readBytesSync(std::string_view path, std::span<std::byte> dest) -> size_t
     {
+        if (const auto symbol = m_image.find(path); symbol) {
+            return readBytesSync(symbol, dest);
+        }
         std::scoped_lock lock(m_mutex);
-        auto& symbol = ensureSymbolLocked(path, dest.size());
-        const auto bytesToCopy = std::min(dest.size(), symbol.size());
-        std::copy_n(symbol.begin(), bytesToCopy, dest.begin());
-        if (bytesToCopy < dest.size()) {
-            std::fill(dest.begin() + static_cast<std::ptrdiff_t>(bytesToCopy), dest.end(), std::byte{});
+        return readGrowing(m_image.add(path, dest.size()), dest);
+    }
+
+    auto LocalAdsLink::readBytesSync(SymbolHandle symbol, std::span<std::byte> dest) -> size_t
+    {
+        if (!symbol) {
+            return 0;
         }
-        return dest.size();
+        if (readStaged(this, symbol, dest)) {
+            return dest.size();
+        }
+        if (m_image.size(symbol) >= dest.size()) {
+            m_image.read(symbol, dest);
+            return dest.size();
+        }
+        std::scoped_lock lock(m_mutex);
+        return readGrowing(symbol, dest);
     }
 
     auto LocalAdsLink::writeBytesSync(std::string_view path, std::span<const std::byte> src) -> void
     {
+        if (s_cycle.link == this) {
+            s_cycle.stage(registerSymbol(path, src.size()), src);
+            return;
+        }
         std::scoped_lock lock(m_mutex);
-        auto& symbol = ensureSymbolLocked(path, src.size());
-        const bool changed =
-          symbol.size() != src.size() || !std::equal(symbol.begin(), symbol.end(), src.begin(), src.end());
+        writeLocked(m_image.add(path, src.size()), src);
+    }
 
-        symbol.assign(src.begin(), src.end());
-        publishLocked(path, symbol, changed);
+    auto LocalAdsLink::writeBytesSync(SymbolHandle symbol, std::span<const std::byte> src) -> void
+    {
+        if (!symbol) {
+            return;
+        }
+        if (s_cycle.link == this) {
+            s_cycle.stage(symbol, src);
+            return;
+        }
+        std::scoped_lock lock(m_mutex);
+        writeLocked(symbol, src);
+    }
+
+    auto LocalAdsLink::beginCycle() -> void
+    {
+        if (s_cycle.link != nullptr && s_cycle.link != this) {
+            throw std::logic_error("another link's cycle is already open on this thread");
+        }
+        if (s_cycle.link == nullptr) {
+            // Left over only if the last commit() threw.
+            s_cycle.writes.clear();
+            s_cycle.bytes.clear();
+        }
+        s_cycle.link = this;
+        ++s_cycle.depth;
+    }
+
+    // Every staged value lands before the first notification goes out, so a subscriber woken by this
+    // cycle reads the whole cycle's state and never a half-applied one.
+    auto LocalAdsLink::commit() -> void
+    {
+        if (s_cycle.link != this || --s_cycle.depth > 0) {
+            return;
+        }
+        s_cycle.link = nullptr;
+
+        std::scoped_lock lock(m_mutex);
+        const auto sequence = m_cycleSequence.load(std::memory_order_relaxed);
+        m_cycleSequence.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        for (auto& write : s_cycle.writes) {
+            write.changed = m_image.write(write.symbol, s_cycle.value(write));
+        }
+        m_cycleSequence.store(sequence + 2, std::memory_order_release);
+
+        for (const auto& write : s_cycle.writes) {
+            publishLocked(write.symbol, s_cycle.value(write), write.changed);
+        }
+        s_cycle.writes.clear();
+        s_cycle.bytes.clear();
     }
 
-    auto LocalAdsLink::ensureSymbolLocked(std::string_view path, size_t size) -> std::vector<std::byte>&
+    // A read wider than the symbol grows it with zeroes, as the path overloads always have. This is the
+    // only read that takes the lock.
+    auto LocalAdsLink::readGrowing(SymbolHandle symbol, std::span<std::byte> dest) -> size_t
     {
-        auto& symbol = m_symbols[std::string(path)];
-        if (symbol.size() < size) {
-            symbol.resize(size, std::byte{});
+        if (m_image.size(symbol) < dest.size()) {
+            m_image.resize(symbol, dest.size());
         }
-        return symbol;
+        m_image.read(symbol, dest);
+        return dest.size();
+    }
+
+    auto LocalAdsLink::writeLocked(SymbolHandle symbol, std::span<const std::byte> src) -> void
+    {
+        const bool changed = m_image.write(symbol, src);
+        publishLocked(symbol, src, changed);
     }
 
-    auto LocalAdsLink::publishLocked(std::string_view path,
-                                     const std::vector<std::byte>& value,
-                                     bool changedOnly) -> void
+    // Change detection happened once, in ProcessImage::write(). Values small enough to travel inline are
+    // copied into each channel; larger ones go out as one immutable buffer shared by every subscriber.
+    auto LocalAdsLink::publishLocked(SymbolHandle symbol, std::span<const std::byte> value, bool changed)
+      -> void
     {
-        for (auto& [id, context] : m_subscriptions) {
-            if (context.path != path || !context.stream) {
+        if (m_subscribers.size() <= symbol.index) {
+            return;
+        }
+
+        coro::RawBinaryChannel::SharedBytes shared;
+        for (auto& subscriber : m_subscribers[symbol.index]) {
+            if (!changed && subscriber.type != SubscriptionType::Cyclic) {
                 continue;
             }
-
-            if (context.size != value.size()) {
-                context.lastValue = value;
-                context.stream->stream.push(value);
+            if (value.size() <= coro::RawBinaryChannel::INLINE_CAPACITY) {
+                subscriber.stream->stream.push(value);
                 continue;
             }
-
-            const bool changed = context.lastValue != value;
-            if (!changedOnly || context.type == SubscriptionType::Cyclic || changed) {
-                context.lastValue = value;
-                context.stream->stream.push(value);
+            if (!shared) {
+                shared = std::make_shared<const coro::RawBinaryChannel::Bytes>(value.begin(), value.end());
             }
+            subscriber.stream->stream.push(shared);
         }
     }
-}
\ No newline at end of file
+}
@@ -1,10 +1,13 @@
 #pragma once
 
 #include "ISymbolicLink.hpp"
+#include "ProcessImage.hpp"
 
+#include <atomic>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <mutex>
 #include <span>
 #include <string>
@@ -14,13 +17,23 @@
 
 namespace core::link::symbolic
 {
+    class CyclicSampler;
+
+    /**
+     * In-process ADS stand-in. Symbols live in a ProcessImage; hot paths resolve a SymbolHandle once
+     * with registerSymbol() and access by handle, the path overloads add unknown symbols on first use.
+     * Reads never take the lock; writes, registration and subscriptions serialize on one mutex.
+     */
     class LocalAdsLink
       : public IClient
       , public ISymbolicLink
     {
       public:
         explicit LocalAdsLink(std::string instanceName = "default");
-        ~LocalAdsLink() override = default;
+        // Keeps the image in shared memory, where other processes can map it with
+        // ProcessImage::mapShared(). Their writes show up in reads here but notify no subscribers.
+        LocalAdsLink(std::string instanceName, SharedSegment sharedImage);
+        ~LocalAdsLink() override;
 
         auto connect(std::chrono::milliseconds timeout = NO_TIMEOUT)
           -> coro::Task<result::Result<void>> override;
@@ -30,23 +43,44 @@ namespace core::link::symbolic
         auto readInto(std::string_view path,
                       std::span<std::byte> dest,
                       std::chrono::milliseconds timeout = NO_TIMEOUT)
-          -> coro::Task<result::Result<size_t>> override;
+          -> coro::ValueTask<result::Result<size_t>> override;
         auto writeFrom(std::string_view path,
                        std::span<const std::byte> src,
                        std::chrono::milliseconds timeout = NO_TIMEOUT)
-          -> coro::Task<result::Result<void>> override;
+          -> coro::ValueTask<result::Result<void>> override;
+        // Reads under the writers' lock, so it sees all of a writeMany() or commit() or none of it.
+        auto readMany(std::span<const SymbolRead> symbols, std::chrono::milliseconds timeout = NO_TIMEOUT)
+          -> coro::ValueTask<result::Result<void>> override;
+        // Lands as one cycle and notifies once per symbol.
+        auto writeMany(std::span<const SymbolWrite> symbols, std::chrono::milliseconds timeout = NO_TIMEOUT)
+          -> coro::ValueTask<result::Result<void>> override;
 
+        // A Cyclic subscription with an interval is sampled once per period by a CyclicSampler on the
+        // shared reactor; without one it still pushes on every write.
         auto subscribeRaw(std::string_view path,
                           size_t size,
                           SubscriptionType type = SubscriptionType::OnChange,
-                          std::chrono::milliseconds interval = NO_TIMEOUT)
+                          std::chrono::milliseconds interval = NO_TIMEOUT,
+                          coro::ChannelOptions options = {})
           -> coro::Task<result::Result<std::shared_ptr<RawSubscription>>> override;
         auto unsubscribeRaw(std::shared_ptr<RawSubscription> subscription)
           -> coro::Task<result::Result<void>> override;
         auto unsubscribeRawSync(uint64_t id) -> void override;
 
+        // Lock-free, like findSymbol().
         auto status() const -> Status override;
 
+        // Returns the symbol's handle, adding it with at least `size` zeroed bytes if it is new.
+        auto registerSymbol(std::string_view path, size_t size) -> SymbolHandle;
+        // An invalid handle if the symbol was never registered, read or written.
+        auto findSymbol(std::string_view path) const -> SymbolHandle;
+
+        template<typename T>
+        auto registerSymbol(std::string_view path) -> SymbolHandle
+        {
+            return registerSymbol(path, sizeof(T));
+        }
+
         template<typename T>
         auto readSync(std::string_view path) -> T
         {
@@ -55,7 +89,17 @@ namespace core::link::symbolic
             return value;
         }
 
+        template<typename T>
+        auto readSync(SymbolHandle symbol) -> T
+        {
+            T value{};
+            readBytesSync(symbol, std::as_writable_bytes(std::span{ &value, 1 }));
+            return value;
+        }
+
         auto readBytesSync(std::string_view path, std::span<std::byte> dest) -> size_t;
+        // An invalid handle, e.g. a findSymbol() miss, reads nothing and returns 0.
+        auto readBytesSync(SymbolHandle symbol, std::span<std::byte> dest) -> size_t;
 
         template<typename T>
         auto writeSync(std::string_view path, const T& value) -> void
@@ -63,28 +107,75 @@ namespace core::link::symbolic
             writeBytesSync(path, std::as_bytes(std::span{ &value, 1 }));
         }
 
+        template<typename T>
+        auto writeSync(SymbolHandle symbol, const T& value) -> void
+        {
+            writeBytesSync(symbol, std::as_bytes(std::span{ &value, 1 }));
+        }
+
         auto writeBytesSync(std::string_view path, std::span<const std::byte> src) -> void;
+        // Writing through an invalid handle does nothing.
+        auto writeBytesSync(SymbolHandle symbol, std::span<const std::byte> src) -> void;
         auto instanceName() const -> const std::string& { return m_instanceName; }
 
+        // Bracket one PLC-style task cycle on the calling thread. Its writes are staged and read back
+        // staged; commit() applies them in one step and notifies each changed symbol once, with the
+        // cycle's last value. Cycles nest on one link and only the outermost commit() applies. A
+        // thread may have one link's cycle open at a time.
+        auto beginCycle() -> void;
+        auto commit() -> void;
+        // Odd while a commit is being applied. A reader of several symbols can retry if it moved.
+        auto cycleSequence() const -> uint32_t { return m_cycleSequence.load(std::memory_order_acquire); }
+
       private:
-        struct SubscriptionContext
+        struct Subscriber
         {
-            std::string path;
-            size_t size{ 0 };
+            uint64_t id{ 0 };
             SubscriptionType type{ SubscriptionType::OnChange };
             std::shared_ptr<RawSubscription> stream;
-            std::vector<std::byte> lastValue;
         };
 
-        auto ensureSymbolLocked(std::string_view path, size_t size) -> std::vector<std::byte>&;
-        auto publishLocked(std::string_view path, const std::vector<std::byte>& value, bool changedOnly)
-          -> void;
+        auto readGrowing(SymbolHandle symbol, std::span<std::byte> dest) -> size_t;
+        auto writeLocked(SymbolHandle symbol, std::span<const std::byte> src) -> void;
+        auto publishLocked(SymbolHandle symbol, std::span<const std::byte> value, bool changed) -> void;
 
         std::string m_instanceName;
         mutable std::mutex m_mutex;
-        Status m_status{ Status::Connected };
+        std::atomic<Status> m_status{ Status::Connected };
+        std::atomic<uint32_t> m_cycleSequence{ 0 };
         uint64_t m_nextSubscriptionId{ 1 };
-        std::unordered_map<std::string, std::vector<std::byte>> m_symbols;
-        std::unordered_map<uint64_t, SubscriptionContext> m_subscriptions;
+        ProcessImage m_image;
+        // Subscribers of each symbol, indexed by SymbolHandle::index, so a write only visits its own.
+        std::vector<std::vector<Subscriber>> m_subscribers;
+        std::unordered_map<uint64_t, SymbolHandle> m_subscriptions;
+        // Created with the first cyclic subscription that asks for an interval.
+        std::shared_ptr<CyclicSampler> m_sampler;
+    };
+
+    // Commits on scope exit. A null link makes it a no-op, so callers with an optional local link need
+    // no branch.
+    class ScopedCycle
+    {
+      public:
+        explicit ScopedCycle(LocalAdsLink* link)
+          : m_link{ link }
+        {
+            if (m_link) {
+                m_link->beginCycle();
+            }
+        }
+
+        ~ScopedCycle()
+        {
+            if (m_link) {
+                m_link->commit();
+            }
+        }
+
+        ScopedCycle(const ScopedCycle&) = delete;
+        auto operator=(const ScopedCycle&) -> ScopedCycle& = delete;
+
+      private:
+        LocalAdsLink* m_link;
     };
 }
\ No newline at end of file
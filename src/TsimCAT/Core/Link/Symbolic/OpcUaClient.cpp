@@ -8,6 +8,7 @@
 #include <print>
 #include <unordered_map>
 #include <variant>
+#include <vector>
 
 namespace
 {
@@ -57,7 +58,8 @@ namespace
         return node;
     }
 
-    static auto nodeToNative(UaNode node) -> UA_NodeId
+    // String ids point into `node`, which has to outlive the returned id.
+    static auto nodeToNative(const UaNode& node) -> UA_NodeId
     {
         if (node.id.index() == 0) {
             return UA_NODEID_NUMERIC(node.ns, std::get<0>(node.id));
@@ -67,6 +69,43 @@ namespace
         }
     }
 
+    // Read request entries for one attribute of each node. They borrow the nodes' string ids.
+    static auto readValueIds(const std::vector<UaNode>& nodes, UA_UInt32 attribute)
+      -> std::vector<UA_ReadValueId>
+    {
+        std::vector<UA_ReadValueId> ids(nodes.size());
+        for (size_t i = 0; i < nodes.size(); ++i) {
+            UA_ReadValueId_init(&ids[i]);
+            ids[i].nodeId = nodeToNative(nodes[i]);
+            ids[i].attributeId = attribute;
+        }
+        return ids;
+    }
+
+    // Narrows the client's response timeout for the synchronous service calls in its scope. The
+    // caller holds the client mutex for the whole scope.
+    class ServiceTimeout
+    {
+      public:
+        ServiceTimeout(UA_Client* client, std::chrono::milliseconds timeout)
+          : m_config{ UA_Client_getConfig(client) }
+          , m_previous{ m_config->timeout }
+        {
+            if (timeout > std::chrono::milliseconds::zero()) {
+                m_config->timeout = static_cast<UA_UInt32>(timeout.count());
+            }
+        }
+
+        ~ServiceTimeout() { m_config->timeout = m_previous; }
+
+        ServiceTimeout(const ServiceTimeout&) = delete;
+        ServiceTimeout& operator=(const ServiceTimeout&) = delete;
+
+      private:
+        UA_ClientConfig* m_config;
+        UA_UInt32 m_previous;
+    };
+
     // clang-format off
     using UaStatusType = UA_StatusCode;
     enum class UaStatus : UaStatusType
@@ -359,6 +398,28 @@ namespace
     {
         return std::error_code(static_cast<int>(e), ua_category());
     }
+
+    // The value's binary encoding, as readInto and readMany hand it out; fails if it needs more than
+    // `capacity` bytes.
+    static auto encodeValue(const UA_Variant& value, size_t capacity)
+      -> core::result::Result<std::vector<std::byte>>
+    {
+        size_t bytesRead{ UA_calcSizeBinary(value.data, value.type) };
+        if (bytesRead > capacity) {
+            return std::unexpected(make_error_code(UaStatus::BadEncodingLimitsExceeded));
+        }
+
+        std::vector<std::byte> buffer(capacity);
+        UA_ByteString bytes;
+        bytes.length = buffer.size();
+        bytes.data = reinterpret_cast<UA_Byte*>(buffer.data());
+        auto status{ getStatus(UA_encodeBinary(value.data, value.type, &bytes)) };
+        if (isBad(status)) {
+            return std::unexpected(make_error_code(status));
+        }
+        buffer.resize(bytesRead);
+        return buffer;
+    }
 }
 
 namespace core::link::symbolic
@@ -383,6 +444,8 @@ namespace core::link::symbolic
 
     OpcUaClient::~OpcUaClient()
     {
+        // Service calls a caller gave up on may still be running on the BlockingPool against this client.
+        m_pending.waitUntilIdle();
         // Ensure we stop the worker before destroying the client
         m_workerRunning = false;
         if (m_worker.joinable()) {
@@ -450,12 +513,15 @@ namespace core::link::symbolic
         co_return result::success();
     }
 
+    // Service calls run on the BlockingPool so a server that stops answering stalls a pool thread, not
+    // the station's executor. The job owns its buffers: a caller that stops waiting (stop request or
+    // timeout) may already have released `dest`/`src` when the call returns. It owns the
+    // pending-request permit too, which is only handed back once the service call has returned; the
+    // destructor waits for every permit.
     auto OpcUaClient::readInto(std::string_view path,
                                std::span<std::byte> dest,
-                               std::chrono::milliseconds timeout) -> coro::Task<result::Result<size_t>>
+                               std::chrono::milliseconds timeout) -> coro::ValueTask<result::Result<size_t>>
     {
-        // TODO: use async
-
         if (!m_client || !m_connected) {
             co_return std::unexpected(make_error_code(UaStatus::BadNotConnected));
         }
@@ -465,45 +531,51 @@ namespace core::link::symbolic
             co_return std::unexpected(make_error_code(UaStatus::BadNodeIdInvalid));
         }
 
-        UA_Variant value;
-        UA_Variant_init(&value);
-
-        UaStatus status;
-        {
-            std::scoped_lock lock(m_mutex);
-            status =
-              getStatus(UA_Client_readValueAttribute(m_client.get(), nodeToNative(node.value()), &value));
-        }
-
-        if (isBad(status)) {
-            UA_Variant_clear(&value);
-            co_return std::unexpected(make_error_code(status));
+        auto permit{ co_await m_pending.acquire() };
+        if (!permit) {
+            co_return std::unexpected(std::make_error_code(std::errc::operation_canceled));
         }
 
-        size_t bytesRead{ UA_calcSizeBinary(value.data, value.type) };
-        if (bytesRead > dest.size()) {
-            UA_Variant_clear(&value);
-            co_return std::unexpected(make_error_code(UaStatus::BadEncodingLimitsExceeded));
+        auto read{ co_await coro::runAsync<result::Result<std::vector<std::byte>>>(
+          [this,
+           permit = std::make_shared<coro::SemaphorePermit>(std::move(permit)),
+           node = std::move(*node),
+           size = dest.size(),
+           timeout]()
+            -> result::Result<std::vector<std::byte>> {
+              UA_Variant value;
+              UA_Variant_init(&value);
+
+              UaStatus status;
+              {
+                  std::scoped_lock lock(m_mutex);
+                  ServiceTimeout scope{ m_client.get(), timeout };
+                  status =
+                    getStatus(UA_Client_readValueAttribute(m_client.get(), nodeToNative(node), &value));
+              }
+
+              if (isBad(status)) {
+                  UA_Variant_clear(&value);
+                  return std::unexpected(make_error_code(status));
+              }
+
+              auto buffer{ encodeValue(value, size) };
+              UA_Variant_clear(&value);
+              return buffer;
+          }) };
+
+        if (!read) {
+            co_return std::unexpected(read.error());
         }
 
-        UA_ByteString bytes;
-        bytes.length = dest.size();
-        bytes.data = reinterpret_cast<UA_Byte*>(dest.data());
-        status = getStatus(UA_encodeBinary(value.data, value.type, &bytes));
-        UA_Variant_clear(&value);
-
-        if (isBad(status)) {
-            co_return std::unexpected(make_error_code(status));
-        }
-        co_return bytesRead;
+        std::ranges::copy(*read, dest.begin());
+        co_return read->size();
     };
 
     auto OpcUaClient::writeFrom(std::string_view path,
                                 std::span<const std::byte> src,
-                                std::chrono::milliseconds timeout) -> coro::Task<result::Result<void>>
+                                std::chrono::milliseconds timeout) -> coro::ValueTask<result::Result<void>>
     {
-        // TODO: use async
-
         if (!m_client || !m_connected) {
             co_return std::unexpected(make_error_code(UaStatus::BadNotConnected));
         }
@@ -513,59 +585,262 @@ namespace core::link::symbolic
             co_return std::unexpected(make_error_code(UaStatus::BadNodeIdInvalid));
         }
 
-        UA_NodeId typeNode;
-        UaStatus status;
-        {
-            std::scoped_lock lock(m_mutex);
-            status = getStatus(
-              UA_Client_readDataTypeAttribute(m_client.get(), nodeToNative(node.value()), &typeNode));
+        auto permit{ co_await m_pending.acquire() };
+        if (!permit) {
+            co_return std::unexpected(std::make_error_code(std::errc::operation_canceled));
         }
 
-        if (isBad(status)) {
-            UA_NodeId_clear(&typeNode);
-            co_return std::unexpected(make_error_code(status));
+        co_return co_await coro::runAsync<result::Result<void>>(
+          [this,
+           permit = std::make_shared<coro::SemaphorePermit>(std::move(permit)),
+           node = std::move(*node),
+           data = std::vector<std::byte>(src.begin(), src.end()),
+           timeout]()
+            -> result::Result<void> {
+              std::scoped_lock lock(m_mutex);
+              ServiceTimeout scope{ m_client.get(), timeout };
+
+              UA_NodeId typeNode;
+              auto status{ getStatus(
+                UA_Client_readDataTypeAttribute(m_client.get(), nodeToNative(node), &typeNode)) };
+
+              if (isBad(status)) {
+                  UA_NodeId_clear(&typeNode);
+                  return std::unexpected(make_error_code(status));
+              }
+
+              const UA_DataType* type = UA_findDataType(&typeNode);
+              if (!type) {
+                  UA_NodeId_clear(&typeNode);
+                  return std::unexpected(make_error_code(UaStatus::BadTypeDefinitionInvalid));
+              }
+
+              UA_ByteString bytes;
+              bytes.length = data.size();
+              bytes.data = const_cast<UA_Byte*>(reinterpret_cast<const UA_Byte*>(data.data()));
+
+              auto* decoded{ UA_new(type) };
+              status = getStatus(UA_decodeBinary(&bytes, decoded, type, nullptr));
+              if (isBad(status)) {
+                  UA_NodeId_clear(&typeNode);
+                  UA_delete(decoded, type);
+                  return std::unexpected(make_error_code(status));
+              }
+
+              UA_Variant value;
+              UA_Variant_setScalar(&value, decoded, type);
+              status =
+                getStatus(UA_Client_writeValueAttribute(m_client.get(), nodeToNative(node), &value));
+
+              UA_NodeId_clear(&typeNode);
+              UA_Variant_clear(&value);
+
+              if (isBad(status)) {
+                  return std::unexpected(make_error_code(status));
+              }
+              return result::success();
+          });
+    }
+
+    // The whole batch is one Read service call; each value comes back encoded as readInto encodes it.
+    auto OpcUaClient::readMany(std::span<const SymbolRead> symbols, std::chrono::milliseconds timeout)
+      -> coro::ValueTask<result::Result<void>>
+    {
+        if (!m_client || !m_connected) {
+            co_return std::unexpected(make_error_code(UaStatus::BadNotConnected));
         }
 
-        const UA_DataType* type = UA_findDataType(&typeNode);
-        if (!type) {
-            UA_NodeId_clear(&typeNode);
-            co_return std::unexpected(make_error_code(UaStatus::BadTypeDefinitionInvalid));
+        std::vector<UaNode> nodes;
+        std::vector<size_t> sizes;
+        for (const auto& [path, dest] : symbols) {
+            auto node{ strToNode(path) };
+            if (!node) {
+                co_return std::unexpected(make_error_code(UaStatus::BadNodeIdInvalid));
+            }
+            nodes.push_back(std::move(*node));
+            sizes.push_back(dest.size());
         }
 
-        UA_ByteString bytes;
-        bytes.length = src.size();
-        bytes.data = const_cast<UA_Byte*>(reinterpret_cast<const UA_Byte*>(src.data()));
+        auto permit{ co_await m_pending.acquire() };
+        if (!permit) {
+            co_return std::unexpected(std::make_error_code(std::errc::operation_canceled));
+        }
 
-        auto* data{ UA_new(type) };
-        status = getStatus(UA_decodeBinary(&bytes, data, type, nullptr));
-        if (isBad(status)) {
-            UA_NodeId_clear(&typeNode);
-            UA_delete(data, type);
-            co_return std::unexpected(make_error_code(status));
+        auto read{ co_await coro::runAsync<result::Result<std::vector<std::vector<std::byte>>>>(
+          [this,
+           permit = std::make_shared<coro::SemaphorePermit>(std::move(permit)),
+           nodes = std::move(nodes),
+           sizes = std::move(sizes),
+           timeout]() -> result::Result<std::vector<std::vector<std::byte>>> {
+              auto ids{ readValueIds(nodes, UA_ATTRIBUTEID_VALUE) };
+              UA_ReadRequest request;
+              UA_ReadRequest_init(&request);
+              request.nodesToRead = ids.data();
+              request.nodesToReadSize = ids.size();
+              request.timestampsToReturn = UA_TIMESTAMPSTORETURN_NEITHER;
+
+              UA_ReadResponse response;
+              {
+                  std::scoped_lock lock(m_mutex);
+                  ServiceTimeout scope{ m_client.get(), timeout };
+                  response = UA_Client_Service_read(m_client.get(), request);
+              }
+
+              auto status{ getStatus(response.responseHeader.serviceResult) };
+              if (!isBad(status) && response.resultsSize != nodes.size()) {
+                  status = UaStatus::BadUnexpectedError;
+              }
+              std::vector<std::vector<std::byte>> values;
+              for (size_t i = 0; i < response.resultsSize && !isBad(status); ++i) {
+                  const auto& result{ response.results[i] };
+                  if (result.hasStatus && isBad(getStatus(result.status))) {
+                      status = getStatus(result.status);
+                      break;
+                  }
+                  if (!result.hasValue) {
+                      status = UaStatus::BadNoDataAvailable;
+                      break;
+                  }
+                  auto value{ encodeValue(result.value, sizes[i]) };
+                  if (!value) {
+                      UA_ReadResponse_clear(&response);
+                      return std::unexpected(value.error());
+                  }
+                  values.push_back(std::move(*value));
+              }
+              // The request only borrowed `ids`; the response owns its results.
+              UA_ReadResponse_clear(&response);
+
+              if (isBad(status)) {
+                  return std::unexpected(make_error_code(status));
+              }
+              return values;
+          }) };
+
+        if (!read) {
+            co_return std::unexpected(read.error());
         }
 
-        UA_Variant value;
-        UA_Variant_setScalar(&value, data, type);
+        for (size_t i = 0; i < symbols.size(); ++i) {
+            std::ranges::copy((*read)[i], symbols[i].dest.begin());
+        }
+        co_return result::success();
+    }
 
-        {
-            std::scoped_lock lock(m_mutex);
-            status =
-              getStatus(UA_Client_writeValueAttribute(m_client.get(), nodeToNative(node.value()), &value));
+    // Values are decoded as their node's data type, so one Read of every data type precedes the single
+    // Write service call: two round trips per batch however many symbols it holds.
+    auto OpcUaClient::writeMany(std::span<const SymbolWrite> symbols, std::chrono::milliseconds timeout)
+      -> coro::ValueTask<result::Result<void>>
+    {
+        if (!m_client || !m_connected) {
+            co_return std::unexpected(make_error_code(UaStatus::BadNotConnected));
         }
 
-        UA_NodeId_clear(&typeNode);
-        UA_Variant_clear(&value);
+        std::vector<UaNode> nodes;
+        std::vector<std::vector<std::byte>> values;
+        for (const auto& [path, src] : symbols) {
+            auto node{ strToNode(path) };
+            if (!node) {
+                co_return std::unexpected(make_error_code(UaStatus::BadNodeIdInvalid));
+            }
+            nodes.push_back(std::move(*node));
+            values.emplace_back(src.begin(), src.end());
+        }
 
-        if (isBad(status)) {
-            co_return std::unexpected(make_error_code(status));
+        auto permit{ co_await m_pending.acquire() };
+        if (!permit) {
+            co_return std::unexpected(std::make_error_code(std::errc::operation_canceled));
         }
-        co_return result::success();
+
+        co_return co_await coro::runAsync<result::Result<void>>(
+          [this,
+           permit = std::make_shared<coro::SemaphorePermit>(std::move(permit)),
+           nodes = std::move(nodes),
+           values = std::move(values),
+           timeout]() -> result::Result<void> {
+              std::scoped_lock lock(m_mutex);
+              ServiceTimeout scope{ m_client.get(), timeout };
+
+              auto ids{ readValueIds(nodes, UA_ATTRIBUTEID_DATATYPE) };
+              UA_ReadRequest typeRequest;
+              UA_ReadRequest_init(&typeRequest);
+              typeRequest.nodesToRead = ids.data();
+              typeRequest.nodesToReadSize = ids.size();
+              UA_ReadResponse types{ UA_Client_Service_read(m_client.get(), typeRequest) };
+
+              auto status{ getStatus(types.responseHeader.serviceResult) };
+              if (!isBad(status) && types.resultsSize != nodes.size()) {
+                  status = UaStatus::BadUnexpectedError;
+              }
+              std::vector<UA_WriteValue> writes(nodes.size());
+              for (size_t i = 0; i < types.resultsSize && !isBad(status); ++i) {
+                  const auto& typeNode{ types.results[i] };
+                  if (typeNode.hasStatus && isBad(getStatus(typeNode.status))) {
+                      status = getStatus(typeNode.status);
+                      break;
+                  }
+                  const UA_DataType* type{ nullptr };
+                  if (typeNode.hasValue &&
+                      UA_Variant_hasScalarType(&typeNode.value, &UA_TYPES[UA_TYPES_NODEID])) {
+                      type = UA_findDataType(static_cast<const UA_NodeId*>(typeNode.value.data));
+                  }
+                  if (!type) {
+                      status = UaStatus::BadTypeDefinitionInvalid;
+                      break;
+                  }
+
+                  UA_ByteString bytes;
+                  bytes.length = values[i].size();
+                  bytes.data = const_cast<UA_Byte*>(reinterpret_cast<const UA_Byte*>(values[i].data()));
+
+                  auto* decoded{ UA_new(type) };
+                  status = getStatus(UA_decodeBinary(&bytes, decoded, type, nullptr));
+                  if (isBad(status)) {
+                      UA_delete(decoded, type);
+                      break;
+                  }
+                  UA_WriteValue_init(&writes[i]);
+                  writes[i].nodeId = nodeToNative(nodes[i]);
+                  writes[i].attributeId = UA_ATTRIBUTEID_VALUE;
+                  UA_Variant_setScalar(&writes[i].value.value, decoded, type);
+                  writes[i].value.hasValue = true;
+              }
+              UA_ReadResponse_clear(&types);
+
+              if (!isBad(status)) {
+                  UA_WriteRequest request;
+                  UA_WriteRequest_init(&request);
+                  request.nodesToWrite = writes.data();
+                  request.nodesToWriteSize = writes.size();
+                  UA_WriteResponse response{ UA_Client_Service_write(m_client.get(), request) };
+
+                  status = getStatus(response.responseHeader.serviceResult);
+                  if (!isBad(status) && response.resultsSize != writes.size()) {
+                      status = UaStatus::BadUnexpectedError;
+                  }
+                  for (size_t i = 0; i < response.resultsSize && !isBad(status); ++i) {
+                      status = getStatus(response.results[i]);
+                  }
+                  UA_WriteResponse_clear(&response);
+              }
+
+              // The requests only borrowed the node ids; the decoded values are ours to free.
+              for (auto& write : writes) {
+                  UA_Variant_clear(&write.value.value);
+              }
+
+              if (isBad(status)) {
+                  return std::unexpected(make_error_code(status));
+              }
+              return result::success();
+          });
     }
 
     auto OpcUaClient::subscribeRaw(std::string_view path,
                                    size_t size,
                                    SubscriptionType type,
-                                   std::chrono::milliseconds interval)
+                                   std::chrono::milliseconds interval,
+                                   coro::ChannelOptions options)
       -> coro::Task<result::Result<std::shared_ptr<RawSubscription>>>
     {
         std::scoped_lock lock(m_mutex);
@@ -581,7 +856,7 @@ namespace core::link::symbolic
             uint32_t id = s_pollingIdCounter++;
 
             auto subStream =
-              std::shared_ptr<RawSubscription>(new RawSubscription(id), [this](RawSubscription* p) {
+              std::shared_ptr<RawSubscription>(new RawSubscription(id, options), [this](RawSubscription* p) {
                 this->unsubscribeRawSync(p->id);
                 delete p;
             });
@@ -640,11 +915,11 @@ namespace core::link::symbolic
             co_return std::unexpected(make_error_code(status));
         }
 
-        auto subStream = std::shared_ptr<RawSubscription>(new RawSubscription(monResult.monitoredItemId),
-                                                          [this](RawSubscription* p) {
-            this->unsubscribeRawSync(p->id);
-            delete p;
-        });
+        auto subStream = std::shared_ptr<RawSubscription>(
+          new RawSubscription(monResult.monitoredItemId, options), [this](RawSubscription* p) {
+              this->unsubscribeRawSync(p->id);
+              delete p;
+          });
 
         m_monitoredItems.emplace(
           monResult.monitoredItemId,
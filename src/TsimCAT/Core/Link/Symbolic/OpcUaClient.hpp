@@ -2,6 +2,8 @@
 
 #include "ISymbolicLink.hpp"
 
+#include "Coroutines/Sync.hpp"
+
 #include "Utils/memory_utils.hpp"
 
 #include <open62541.h>
@@ -25,15 +27,20 @@ namespace core::link::symbolic
 
         auto readInto(std::string_view path,
                       std::span<std::byte> dest,
-                      std::chrono::milliseconds timeout = NO_TIMEOUT) -> coro::Task<result::Result<size_t>> override;
+                      std::chrono::milliseconds timeout = NO_TIMEOUT) -> coro::ValueTask<result::Result<size_t>> override;
         auto writeFrom(std::string_view path,
                        std::span<const std::byte> src,
-                       std::chrono::milliseconds timeout = NO_TIMEOUT) -> coro::Task<result::Result<void>> override;
+                       std::chrono::milliseconds timeout = NO_TIMEOUT) -> coro::ValueTask<result::Result<void>> override;
+        auto readMany(std::span<const SymbolRead> symbols,
+                      std::chrono::milliseconds timeout = NO_TIMEOUT) -> coro::ValueTask<result::Result<void>> override;
+        auto writeMany(std::span<const SymbolWrite> symbols,
+                       std::chrono::milliseconds timeout = NO_TIMEOUT) -> coro::ValueTask<result::Result<void>> override;
 
         auto subscribeRaw(std::string_view path,
                        size_t size,
                        SubscriptionType type = SubscriptionType::OnChange,
-                       std::chrono::milliseconds interval = NO_TIMEOUT) -> coro::Task<result::Result<std::shared_ptr<RawSubscription>>> override;
+                       std::chrono::milliseconds interval = NO_TIMEOUT,
+                       coro::ChannelOptions options = {}) -> coro::Task<result::Result<std::shared_ptr<RawSubscription>>> override;
         auto unsubscribeRaw(std::shared_ptr<RawSubscription> subscription) -> coro::Task<result::Result<void>> override;
         auto unsubscribeRawSync(uint64_t id) -> void override;
         // clang-format on
@@ -77,6 +84,7 @@ namespace core::link::symbolic
         std::unique_ptr<UA_Client, utils::memory::Deleter<UA_Client_delete>> m_client;
 
         std::recursive_mutex m_mutex;
+        coro::AsyncSemaphore m_pending{ MAX_PENDING_REQUESTS };
         std::atomic<bool> m_workerRunning{ false };
         std::jthread m_worker;
     };
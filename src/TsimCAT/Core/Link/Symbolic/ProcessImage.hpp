@@ -0,0 +1,659 @@
+#pragma once
+
+#include "Common/Result.hpp"
+#include "SharedSegment.hpp"
+
+#include "Utils/cpu_utils.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <new>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace core::link::symbolic
+{
+    // Stable index of a symbol in a ProcessImage; resolve it once, then access without a lookup.
+    struct SymbolHandle
+    {
+        static constexpr uint32_t INVALID{ std::numeric_limits<uint32_t>::max() };
+
+        uint32_t index{ INVALID };
+
+        explicit operator bool() const { return index != INVALID; }
+        auto operator==(const SymbolHandle&) const -> bool = default;
+    };
+
+    /**
+     * Symbols of an in-process image packed into arena blocks. A symbol gets its slot when it is first
+     * added and keeps its handle for the lifetime of the image. A symbol that outgrows its slot moves
+     * to a new one under the same handle; blocks never move or shrink, so a slot stays readable after
+     * its symbol has left it.
+     *
+     * Readers (find, size, sequence, read) may run on any thread at any time and never block: find()
+     * walks an insert-only hash index of atomic links, each symbol carries a sequence that is odd while
+     * a write is in progress, and read() copies the slot word by word and retries if the sequence
+     * moved. Writers of one symbol exclude each other through the same sequence; add() must still be
+     * serialized by the owner.
+     *
+     * An image built on a SharedSegment keeps its symbol directory, sequences and values in the segment
+     * instead, with a fixed capacity set by mapShared(). Every process that maps the segment sees the
+     * same symbols under the same handles and may add, read and write them. A process that dies while
+     * writing leaves its lock held; one held unchanged for STALE_LOCK_TIMEOUT is broken, and the value
+     * it was writing may stay half-written until the next write.
+     */
+    class ProcessImage
+    {
+      public:
+        static constexpr size_t SLOT_ALIGNMENT{ sizeof(uint64_t) };
+        static constexpr size_t BLOCK_SIZE{ 64 * 1024 };
+        // Longest path a shared image holds, including the terminating zero.
+        static constexpr size_t SHARED_PATH_CAPACITY{ 96 };
+        // A write holds its lock for a few word stores, so one held this long belongs to a dead process.
+        static constexpr std::chrono::milliseconds STALE_LOCK_TIMEOUT{ 1000 };
+
+        ProcessImage() = default;
+
+        // Joins the image laid out in a segment from mapShared().
+        explicit ProcessImage(SharedSegment segment)
+          : m_segment{ std::move(segment) }
+          , m_header{ std::launder(reinterpret_cast<SharedHeader*>(m_segment.data())) }
+          , m_directory{ std::launder(
+              reinterpret_cast<SharedSymbol*>(m_segment.data() + sizeof(SharedHeader))) }
+          , m_sharedLinks{ std::make_unique<IndexLink[]>(m_header->symbolCapacity) }
+        {
+            m_blockBases[0] = reinterpret_cast<uint64_t*>(m_directory + m_header->symbolCapacity);
+        }
+
+        ProcessImage(const ProcessImage&) = delete;
+        auto operator=(const ProcessImage&) -> ProcessImage& = delete;
+
+        /**
+         * Maps the shared image called `name`, laying it out for `symbols` symbols and `bytes` of values
+         * if this process creates it. A process that finds the image already there adopts its layout.
+         */
+        static auto mapShared(std::string_view name, size_t symbols, size_t bytes)
+          -> result::Result<SharedSegment>
+        {
+            const auto dataWords{ slotSize(bytes) / sizeof(uint64_t) };
+            auto segment{ SharedSegment::openOrCreate(
+              name, sizeof(SharedHeader) + symbols * sizeof(SharedSymbol) + dataWords * sizeof(uint64_t)) };
+            if (!segment) {
+                return std::unexpected(segment.error());
+            }
+
+            if (segment->created()) {
+                auto* header{ new (segment->data()) SharedHeader{} };
+                header->symbolCapacity = static_cast<uint32_t>(symbols);
+                header->dataWords = dataWords;
+                std::uninitialized_default_construct_n(
+                  reinterpret_cast<SharedSymbol*>(segment->data() + sizeof(SharedHeader)), symbols);
+                header->magic.store(SharedHeader::MAGIC, std::memory_order_release);
+                return segment;
+            }
+
+            // Another process created it and may still be laying it out.
+            const auto* header{ std::launder(reinterpret_cast<const SharedHeader*>(segment->data())) };
+            const auto deadline{ std::chrono::steady_clock::now() + std::chrono::seconds{ 1 } };
+            while (header->magic.load(std::memory_order_acquire) != SharedHeader::MAGIC) {
+                if (std::chrono::steady_clock::now() > deadline) {
+                    return std::unexpected(std::make_error_code(std::errc::timed_out));
+                }
+                std::this_thread::yield();
+            }
+            const auto required{ sizeof(SharedHeader) + header->symbolCapacity * sizeof(SharedSymbol) +
+                                 header->dataWords * sizeof(uint64_t) };
+            if (segment->size() < required) {
+                return std::unexpected(std::make_error_code(std::errc::invalid_argument));
+            }
+            return segment;
+        }
+
+        // Adds the symbol, or returns the existing handle grown to at least `size` bytes.
+        auto add(std::string_view path, size_t size) -> SymbolHandle
+        {
+            auto handle{ find(path) };
+            if (!handle) {
+                handle = m_header ? addShared(path, size) : addLocal(path, size);
+            }
+            if (this->size(handle) < size) {
+                resize(handle, size);
+            }
+            return handle;
+        }
+
+        auto find(std::string_view path) const -> SymbolHandle
+        {
+            const auto hash{ PathHash{}(path) };
+            auto entry{ m_buckets[hash % INDEX_BUCKETS].load(std::memory_order_acquire) };
+            while (entry != 0) {
+                const SymbolHandle handle{ entry - 1 };
+                const auto& link{ indexLink(handle) };
+                if (link.hash == hash && this->path(handle) == path) {
+                    return handle;
+                }
+                entry = link.next.load(std::memory_order_acquire);
+            }
+            // Another process may have added it to a shared image.
+            if (m_header) {
+                const auto count{ m_header->symbolCount.load(std::memory_order_acquire) };
+                for (uint32_t i{ 0 }; i < count; ++i) {
+                    if (path == m_directory[i].path.data()) {
+                        remember(path, SymbolHandle{ i });
+                        return SymbolHandle{ i };
+                    }
+                }
+            }
+            return {};
+        }
+
+        auto path(SymbolHandle handle) const -> std::string_view
+        {
+            if (m_header) {
+                return m_directory[handle.index].path.data();
+            }
+            return localSymbol(handle).path;
+        }
+
+        auto size(SymbolHandle handle) const -> size_t
+        {
+            return state(handle).size.load(std::memory_order_acquire);
+        }
+
+        // Advances by two with every change, so a poller can tell whether a value moved without reading it.
+        auto sequence(SymbolHandle handle) const -> uint32_t
+        {
+            return state(handle).sequence.load(std::memory_order_acquire) & ~uint32_t{ 1 };
+        }
+
+        // Copies up to dest.size() bytes and zero-fills the rest of dest; returns the symbol's size.
+        auto read(SymbolHandle handle, std::span<std::byte> dest) const -> size_t
+        {
+            auto& symbol{ state(handle) };
+            LockWait wait{ isShared() };
+            while (true) {
+                auto before{ symbol.sequence.load(std::memory_order_acquire) };
+                if (before % 2 != 0) {
+                    if (wait.stale(before)) {
+                        // Settles for whatever the dead writer left.
+                        symbol.sequence.compare_exchange_strong(
+                          before, before + 1, std::memory_order_acq_rel);
+                    }
+                    continue;
+                }
+                // Acquired: the location may point into a block a concurrent write just allocated.
+                const auto* data{ address(symbol.location.load(std::memory_order_acquire)) };
+                const auto size{ symbol.size.load(std::memory_order_relaxed) };
+                const auto count{ std::min<size_t>(size, dest.size()) };
+                loadWords(data, dest.first(count));
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (symbol.sequence.load(std::memory_order_relaxed) == before) {
+                    std::ranges::fill(dest.subspan(count), std::byte{});
+                    return size;
+                }
+            }
+        }
+
+        // Replaces the value, resizing to src.size(). Returns false, and leaves the sequence as it was,
+        // when the bytes are unchanged.
+        auto write(SymbolHandle handle, std::span<const std::byte> src) -> bool
+        {
+            auto& symbol{ state(handle) };
+            const auto sequence{ beginWrite(symbol) };
+            auto location{ symbol.location.load(std::memory_order_relaxed) };
+            if (symbol.size.load(std::memory_order_relaxed) == src.size() &&
+                equalWords(address(location), src)) {
+                abortWrite(symbol, sequence);
+                return false;
+            }
+
+            if (src.size() > symbol.capacity.load(std::memory_order_relaxed)) {
+                location = relocate(symbol, sequence, src.size());
+            }
+            storeWords(address(location), src);
+            symbol.size.store(src.size(), std::memory_order_relaxed);
+            endWrite(symbol, sequence);
+            return true;
+        }
+
+        // Bytes exposed by growing read as zero; a symbol that no longer fits its slot is relocated.
+        auto resize(SymbolHandle handle, size_t size) -> void
+        {
+            auto& symbol{ state(handle) };
+            const auto sequence{ beginWrite(symbol) };
+            auto* data{ address(symbol.location.load(std::memory_order_relaxed)) };
+            const auto current{ symbol.size.load(std::memory_order_relaxed) };
+
+            if (size > symbol.capacity.load(std::memory_order_relaxed)) {
+                std::vector<std::byte> value(current);
+                loadWords(data, value);
+                storeWords(address(relocate(symbol, sequence, size)), value);
+            }
+            else if (size > current) {
+                // A shrink or a shorter write leaves stale bytes past the value; clear them.
+                const auto first{ (current + sizeof(uint64_t) - 1) / sizeof(uint64_t) };
+                for (auto word{ first }; word < slotSize(size) / sizeof(uint64_t); ++word) {
+                    std::atomic_ref<uint64_t>{ data[word] }.store(0, std::memory_order_relaxed);
+                }
+                if (current % sizeof(uint64_t) != 0) {
+                    clearTail(data, current);
+                }
+            }
+            symbol.size.store(size, std::memory_order_relaxed);
+            endWrite(symbol, sequence);
+        }
+
+        auto symbolCount() const -> size_t
+        {
+            return m_header ? m_header->symbolCount.load(std::memory_order_acquire)
+                            : m_symbolCount.load(std::memory_order_acquire);
+        }
+
+        auto arenaSize() const -> size_t
+        {
+            if (m_header) {
+                return m_header->dataUsed.load(std::memory_order_relaxed) * sizeof(uint64_t);
+            }
+            return m_arenaSize;
+        }
+
+        auto isShared() const -> bool { return m_header != nullptr; }
+
+      private:
+        static constexpr size_t SYMBOLS_PER_CHUNK{ 256 };
+        static constexpr size_t MAX_CHUNKS{ 1024 };
+        static constexpr size_t MAX_BLOCKS{ 1024 };
+        static constexpr size_t INDEX_BUCKETS{ 1024 };
+        // A location is a block index above this many bits and a word offset below them.
+        static constexpr unsigned BLOCK_SHIFT{ 40 };
+
+        static_assert(std::atomic<uint32_t>::is_always_lock_free &&
+                        std::atomic<uint64_t>::is_always_lock_free,
+                      "shared images need address-free atomics");
+
+        // Everything readers and writers of a symbol synchronize on. Lives in shared memory when shared.
+        struct SymbolState
+        {
+            std::atomic<uint32_t> sequence{ 0 };
+            std::atomic<uint64_t> location{ 0 };
+            std::atomic<uint64_t> size{ 0 };
+            std::atomic<uint64_t> capacity{ 0 };
+        };
+
+        // A symbol's place in its find() bucket. Process-local even for a shared image, whose other
+        // processes index the directory themselves.
+        struct IndexLink
+        {
+            std::atomic<uint32_t> next{ 0 }; // as in the buckets
+            std::atomic<bool> linked{ false };
+            size_t hash{ 0 }; // written before the link is published
+        };
+
+        struct Symbol
+        {
+            SymbolState state{};
+            IndexLink link{};
+            std::string path{};
+        };
+
+        // Symbols live in fixed chunks so a reader never sees the table move under it.
+        struct SymbolChunk
+        {
+            std::array<Symbol, SYMBOLS_PER_CHUNK> symbols{};
+        };
+
+        // Layout of a shared segment: this header, the symbol directory, then the value words.
+        struct SharedHeader
+        {
+            // Bumped whenever the layout or a lock protocol changes.
+            static constexpr uint32_t MAGIC{ 0x54534d32 };
+
+            std::atomic<uint32_t> magic{ 0 };
+            std::atomic<uint32_t> directoryLock{ 0 };
+            std::atomic<uint32_t> symbolCount{ 0 };
+            uint32_t symbolCapacity{ 0 };
+            std::atomic<uint64_t> dataUsed{ 0 };
+            uint64_t dataWords{ 0 };
+        };
+
+        struct SharedSymbol
+        {
+            SymbolState state{};
+            std::array<char, SHARED_PATH_CAPACITY> path{};
+        };
+
+        /**
+         * Backs off while another thread or process holds a lock word, which is odd while held: spins
+         * briefly, then yields. In a shared image stale() reports a holder that has kept the same odd
+         * value for STALE_LOCK_TIMEOUT, so the caller can break the lock its dead process left.
+         */
+        class LockWait
+        {
+          public:
+            explicit LockWait(bool shared)
+              : m_shared{ shared }
+            {
+            }
+
+            auto stale(uint32_t held) -> bool
+            {
+                if (held != m_held) {
+                    m_held = held;
+                    m_rounds = 0;
+                }
+                if (++m_rounds < SPIN_ROUNDS) {
+                    utils::cpu::relax();
+                    return false;
+                }
+                std::this_thread::yield();
+                if (!m_shared) {
+                    return false;
+                }
+                const auto now{ std::chrono::steady_clock::now() };
+                if (m_rounds == SPIN_ROUNDS) {
+                    m_since = now;
+                    return false;
+                }
+                return now - m_since > STALE_LOCK_TIMEOUT;
+            }
+
+          private:
+            static constexpr uint32_t SPIN_ROUNDS{ 64 };
+
+            const bool m_shared;
+            uint32_t m_held{ 0 };
+            uint32_t m_rounds{ 0 };
+            std::chrono::steady_clock::time_point m_since{};
+        };
+
+        // Serializes adds across every process that maps the segment; held only while appending. The
+        // lock word counts up like a sequence, so a waiter can tell one stuck holder from a busy lock.
+        class DirectoryLock
+        {
+          public:
+            explicit DirectoryLock(SharedHeader& header)
+              : m_header{ header }
+            {
+                LockWait wait{ true };
+                while (true) {
+                    auto word{ m_header.directoryLock.load(std::memory_order_relaxed) };
+                    if (word % 2 == 0) {
+                        if (m_header.directoryLock.compare_exchange_weak(
+                              word, word + 1, std::memory_order_acquire, std::memory_order_relaxed)) {
+                            return;
+                        }
+                        continue;
+                    }
+                    // A dead holder's half-appended symbol was never counted, so the slot is reused.
+                    if (wait.stale(word) && m_header.directoryLock.compare_exchange_strong(
+                                              word, word + 2, std::memory_order_acquire)) {
+                        return;
+                    }
+                }
+            }
+            ~DirectoryLock() { m_header.directoryLock.fetch_add(1, std::memory_order_release); }
+
+            DirectoryLock(const DirectoryLock&) = delete;
+            auto operator=(const DirectoryLock&) -> DirectoryLock& = delete;
+
+          private:
+            SharedHeader& m_header;
+        };
+
+        // Lets string_view lookups find std::string keys without building a temporary string.
+        struct PathHash
+        {
+            using is_transparent = void;
+            auto operator()(std::string_view path) const -> size_t
+            {
+                return std::hash<std::string_view>{}(path);
+            }
+        };
+
+        static auto slotSize(size_t size) -> size_t
+        {
+            return std::max<size_t>((size + SLOT_ALIGNMENT - 1) / SLOT_ALIGNMENT, 1) * SLOT_ALIGNMENT;
+        }
+
+        // Takes the symbol for writing by moving its sequence from even to odd, or from a dead writer's
+        // odd value to the next odd one; either way the returned even value is what endWrite() advances.
+        auto beginWrite(SymbolState& symbol) const -> uint32_t
+        {
+            LockWait wait{ isShared() };
+            while (true) {
+                auto sequence{ symbol.sequence.load(std::memory_order_relaxed) };
+                if (sequence % 2 == 0) {
+                    if (symbol.sequence.compare_exchange_weak(
+                          sequence, sequence + 1, std::memory_order_acquire)) {
+                        std::atomic_thread_fence(std::memory_order_release);
+                        return sequence;
+                    }
+                    continue;
+                }
+                if (wait.stale(sequence) && symbol.sequence.compare_exchange_strong(
+                                              sequence, sequence + 2, std::memory_order_acquire)) {
+                    std::atomic_thread_fence(std::memory_order_release);
+                    return sequence + 1;
+                }
+            }
+        }
+
+        static auto endWrite(SymbolState& symbol, uint32_t sequence) -> void
+        {
+            symbol.sequence.store(sequence + 2, std::memory_order_release);
+        }
+
+        // Nothing was stored, so readers that started before the write may keep their copy.
+        static auto abortWrite(SymbolState& symbol, uint32_t sequence) -> void
+        {
+            symbol.sequence.store(sequence, std::memory_order_release);
+        }
+
+        // Slots are only touched through atomic words, so a read racing a write is torn, not undefined,
+        // and the sequence check throws the torn copy away.
+        static auto loadWords(const uint64_t* src, std::span<std::byte> dest) -> void
+        {
+            auto* words{ const_cast<uint64_t*>(src) };
+            for (size_t offset{ 0 }; offset < dest.size(); offset += sizeof(uint64_t)) {
+                const auto word{ std::atomic_ref<uint64_t>{ words[offset / sizeof(uint64_t)] }.load(
+                  std::memory_order_relaxed) };
+                std::memcpy(dest.data() + offset, &word, std::min(sizeof(uint64_t), dest.size() - offset));
+            }
+        }
+
+        // The last word is padded with zeroes.
+        static auto storeWords(uint64_t* dest, std::span<const std::byte> src) -> void
+        {
+            for (size_t offset{ 0 }; offset < src.size(); offset += sizeof(uint64_t)) {
+                uint64_t word{ 0 };
+                std::memcpy(&word, src.data() + offset, std::min(sizeof(uint64_t), src.size() - offset));
+                std::atomic_ref<uint64_t>{ dest[offset / sizeof(uint64_t)] }.store(word,
+                                                                               std::memory_order_relaxed);
+            }
+        }
+
+        static auto equalWords(const uint64_t* data, std::span<const std::byte> src) -> bool
+        {
+            auto* words{ const_cast<uint64_t*>(data) };
+            for (size_t offset{ 0 }; offset < src.size(); offset += sizeof(uint64_t)) {
+                uint64_t word{ 0 };
+                std::memcpy(&word, src.data() + offset, std::min(sizeof(uint64_t), src.size() - offset));
+                const auto current{ std::atomic_ref<uint64_t>{ words[offset / sizeof(uint64_t)] }.load(
+                  std::memory_order_relaxed) };
+                if (current != word) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // Zeroes the bytes of the value's last word past `size`, left over from a longer value.
+        static auto clearTail(uint64_t* data, size_t size) -> void
+        {
+            std::atomic_ref<uint64_t> last{ data[size / sizeof(uint64_t)] };
+            auto word{ last.load(std::memory_order_relaxed) };
+            std::memset(reinterpret_cast<std::byte*>(&word) + size % sizeof(uint64_t),
+                        0,
+                        sizeof(uint64_t) - size % sizeof(uint64_t));
+            last.store(word, std::memory_order_relaxed);
+        }
+
+        auto localSymbol(SymbolHandle handle) const -> Symbol&
+        {
+            return m_chunks[handle.index / SYMBOLS_PER_CHUNK]->symbols[handle.index % SYMBOLS_PER_CHUNK];
+        }
+
+        auto state(SymbolHandle handle) const -> SymbolState&
+        {
+            return m_header ? m_directory[handle.index].state : localSymbol(handle).state;
+        }
+
+        auto indexLink(SymbolHandle handle) const -> IndexLink&
+        {
+            return m_header ? m_sharedLinks[handle.index] : localSymbol(handle).link;
+        }
+
+        auto address(uint64_t location) const -> uint64_t*
+        {
+            return m_blockBases[location >> BLOCK_SHIFT] + (location & ((uint64_t{ 1 } << BLOCK_SHIFT) - 1));
+        }
+
+        // Pushes the symbol onto its bucket; a path another process added is indexed by the first find()
+        // that scans for it, so the next one does not scan again.
+        auto remember(std::string_view path, SymbolHandle handle) const -> void
+        {
+            auto& link{ indexLink(handle) };
+            if (link.linked.exchange(true, std::memory_order_relaxed)) {
+                return;
+            }
+            link.hash = PathHash{}(path);
+            auto& bucket{ m_buckets[link.hash % INDEX_BUCKETS] };
+            auto head{ bucket.load(std::memory_order_relaxed) };
+            do {
+                link.next.store(head, std::memory_order_relaxed);
+            } while (!bucket.compare_exchange_weak(
+              head, handle.index + 1, std::memory_order_release, std::memory_order_relaxed));
+        }
+
+        auto addLocal(std::string_view path, size_t size) -> SymbolHandle
+        {
+            const SymbolHandle handle{ m_symbolCount.load(std::memory_order_relaxed) };
+            auto& chunk{ m_chunks.at(handle.index / SYMBOLS_PER_CHUNK) };
+            if (!chunk) {
+                chunk = std::make_unique<SymbolChunk>();
+            }
+            auto& symbol{ localSymbol(handle) };
+            symbol.path = std::string{ path };
+            place(symbol.state, size);
+            m_symbolCount.store(handle.index + 1, std::memory_order_release);
+            remember(path, handle);
+            return handle;
+        }
+
+        auto addShared(std::string_view path, size_t size) -> SymbolHandle
+        {
+            if (path.size() >= SHARED_PATH_CAPACITY) {
+                throw std::length_error("symbol path too long for a shared process image");
+            }
+
+            DirectoryLock lock{ *m_header };
+            // Another process may have added it since find() looked.
+            if (const auto handle{ find(path) }) {
+                return handle;
+            }
+            const auto count{ m_header->symbolCount.load(std::memory_order_relaxed) };
+            if (count == m_header->symbolCapacity) {
+                throw std::length_error("shared process image has no room for another symbol");
+            }
+            auto& symbol{ m_directory[count] };
+            std::ranges::copy(path, symbol.path.begin());
+            symbol.path[path.size()] = '\0';
+            place(symbol.state, size);
+            m_header->symbolCount.store(count + 1, std::memory_order_release);
+            remember(path, SymbolHandle{ count });
+            return SymbolHandle{ count };
+        }
+
+        auto place(SymbolState& symbol, size_t size) -> void
+        {
+            symbol.capacity.store(slotSize(size), std::memory_order_relaxed);
+            symbol.location.store(allocate(slotSize(size)), std::memory_order_release);
+            symbol.size.store(size, std::memory_order_relaxed);
+        }
+
+        // Gives a symbol that is being written a slot for `size` bytes. Readers skip the write.
+        auto relocate(SymbolState& symbol, uint32_t sequence, size_t size) -> uint64_t
+        {
+            uint64_t location{ 0 };
+            try {
+                location = allocate(slotSize(size));
+            } catch (...) {
+                abortWrite(symbol, sequence);
+                throw;
+            }
+            symbol.capacity.store(slotSize(size), std::memory_order_relaxed);
+            symbol.location.store(location, std::memory_order_release);
+            return location;
+        }
+
+        // Carves a zeroed slot out of the current block; a value larger than a block gets its own. A
+        // shared image hands out slots from its one fixed data area.
+        auto allocate(size_t bytes) -> uint64_t
+        {
+            const auto words{ bytes / sizeof(uint64_t) };
+            if (m_header) {
+                // Claims the words only if they fit, so a value too large leaves the area usable.
+                auto offset{ m_header->dataUsed.load(std::memory_order_relaxed) };
+                do {
+                    if (offset + words > m_header->dataWords) {
+                        throw std::length_error("shared process image has no room for the value");
+                    }
+                } while (!m_header->dataUsed.compare_exchange_weak(
+                  offset, offset + words, std::memory_order_relaxed));
+                return offset;
+            }
+
+            if (m_blocks.empty() || m_blockUsed + words > m_blockWords) {
+                if (m_blocks.size() == MAX_BLOCKS) {
+                    throw std::length_error("process image has no room for the value");
+                }
+                m_blockWords = std::max(BLOCK_SIZE, bytes) / sizeof(uint64_t);
+                m_blocks.push_back(std::make_unique<uint64_t[]>(m_blockWords));
+                m_blockBases[m_blocks.size() - 1] = m_blocks.back().get();
+                m_blockUsed = 0;
+            }
+            const auto location{ (static_cast<uint64_t>(m_blocks.size() - 1) << BLOCK_SHIFT) | m_blockUsed };
+            m_blockUsed += words;
+            m_arenaSize += bytes;
+            return location;
+        }
+
+        SharedSegment m_segment{};
+        SharedHeader* m_header{ nullptr };
+        SharedSymbol* m_directory{ nullptr };
+        std::unique_ptr<IndexLink[]> m_sharedLinks{};
+
+        std::array<std::unique_ptr<SymbolChunk>, MAX_CHUNKS> m_chunks{};
+        std::atomic<uint32_t> m_symbolCount{ 0 };
+        // Heads of the find() chains by path hash, as handle index + 1; 0 ends a chain.
+        mutable std::array<std::atomic<uint32_t>, INDEX_BUCKETS> m_buckets{};
+        // Written before a location in the block is released, so a reader that acquires one can use it.
+        std::array<uint64_t*, MAX_BLOCKS> m_blockBases{};
+        std::vector<std::unique_ptr<uint64_t[]>> m_blocks{};
+        size_t m_blockWords{ 0 };
+        size_t m_blockUsed{ 0 };
+        size_t m_arenaSize{ 0 };
+    };
+}
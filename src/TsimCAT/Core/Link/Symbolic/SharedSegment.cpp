@@ -0,0 +1,121 @@
+#include "SharedSegment.hpp"
+
+#include <chrono>
+#include <thread>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace core::link::symbolic
+{
+#ifdef _WIN32
+    auto SharedSegment::openOrCreate(std::string_view name, size_t size) -> result::Result<SharedSegment>
+    {
+        SharedSegment segment;
+        segment.m_name = std::string{ name };
+
+        const auto bytes{ static_cast<unsigned long long>(size) };
+        HANDLE mapping = CreateFileMappingA(INVALID_HANDLE_VALUE,
+                                            nullptr,
+                                            PAGE_READWRITE,
+                                            static_cast<DWORD>(bytes >> 32),
+                                            static_cast<DWORD>(bytes & 0xffffffffu),
+                                            segment.m_name.c_str());
+        if (mapping == nullptr) {
+            return std::unexpected(std::error_code(static_cast<int>(GetLastError()), std::system_category()));
+        }
+        segment.m_created = GetLastError() != ERROR_ALREADY_EXISTS;
+        segment.m_handle = mapping;
+
+        void* view = MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, 0);
+        if (view == nullptr) {
+            return std::unexpected(std::error_code(static_cast<int>(GetLastError()), std::system_category()));
+        }
+        MEMORY_BASIC_INFORMATION info{};
+        VirtualQuery(view, &info, sizeof(info));
+        segment.m_data = static_cast<std::byte*>(view);
+        segment.m_size = info.RegionSize;
+        return segment;
+    }
+
+    auto SharedSegment::release() -> void
+    {
+        if (m_data != nullptr) {
+            UnmapViewOfFile(m_data);
+            m_data = nullptr;
+        }
+        if (m_handle != nullptr) {
+            CloseHandle(static_cast<HANDLE>(m_handle));
+            m_handle = nullptr;
+        }
+    }
+#else
+    auto SharedSegment::openOrCreate(std::string_view name, size_t size) -> result::Result<SharedSegment>
+    {
+        const auto systemError = [] { return std::error_code(errno, std::system_category()); };
+
+        SharedSegment segment;
+        segment.m_name = name.starts_with('/') ? std::string{ name } : "/" + std::string{ name };
+
+        int fd = shm_open(segment.m_name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+        segment.m_created = fd >= 0;
+        if (!segment.m_created) {
+            if (errno != EEXIST) {
+                return std::unexpected(systemError());
+            }
+            fd = shm_open(segment.m_name.c_str(), O_RDWR, 0);
+            if (fd < 0) {
+                return std::unexpected(systemError());
+            }
+        }
+        else if (ftruncate(fd, static_cast<off_t>(size)) != 0) {
+            const auto error{ systemError() };
+            close(fd);
+            shm_unlink(segment.m_name.c_str());
+            return std::unexpected(error);
+        }
+
+        // The creator sizes the segment right after creating it; give it a moment if we raced it.
+        struct stat info{};
+        const auto deadline{ std::chrono::steady_clock::now() + std::chrono::seconds{ 1 } };
+        while (fstat(fd, &info) == 0 && info.st_size == 0 && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::yield();
+        }
+        if (info.st_size == 0) {
+            close(fd);
+            return std::unexpected(std::make_error_code(std::errc::timed_out));
+        }
+
+        const auto mapped{ static_cast<size_t>(info.st_size) };
+        void* view = mmap(nullptr, mapped, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        const auto error{ systemError() };
+        close(fd);
+        if (view == MAP_FAILED) {
+            return std::unexpected(error);
+        }
+        segment.m_data = static_cast<std::byte*>(view);
+        segment.m_size = mapped;
+        return segment;
+    }
+
+    // The creator removes the name; processes that still map the segment keep their view.
+    auto SharedSegment::release() -> void
+    {
+        if (m_data != nullptr) {
+            munmap(m_data, m_size);
+            m_data = nullptr;
+        }
+        if (m_created) {
+            shm_unlink(m_name.c_str());
+            m_created = false;
+        }
+    }
+#endif
+}
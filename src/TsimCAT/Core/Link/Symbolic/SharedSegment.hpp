@@ -0,0 +1,67 @@
+#pragma once
+
+#include "Common/Result.hpp"
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace core::link::symbolic
+{
+    /**
+     * A named shared-memory mapping that other processes can map by the same name. openOrCreate()
+     * creates the segment zero-filled, or maps the existing one if another process got there first;
+     * created() tells the two apart. An empty segment maps nothing.
+     */
+    class SharedSegment
+    {
+      public:
+        SharedSegment() = default;
+        ~SharedSegment() { release(); }
+
+        SharedSegment(const SharedSegment&) = delete;
+        auto operator=(const SharedSegment&) -> SharedSegment& = delete;
+
+        SharedSegment(SharedSegment&& other) noexcept
+          : m_name{ std::move(other.m_name) }
+          , m_data{ std::exchange(other.m_data, nullptr) }
+          , m_size{ std::exchange(other.m_size, 0) }
+          , m_created{ std::exchange(other.m_created, false) }
+          , m_handle{ std::exchange(other.m_handle, nullptr) }
+        {
+        }
+
+        auto operator=(SharedSegment&& other) noexcept -> SharedSegment&
+        {
+            if (this != &other) {
+                release();
+                m_name = std::move(other.m_name);
+                m_data = std::exchange(other.m_data, nullptr);
+                m_size = std::exchange(other.m_size, 0);
+                m_created = std::exchange(other.m_created, false);
+                m_handle = std::exchange(other.m_handle, nullptr);
+            }
+            return *this;
+        }
+
+        // `size` only applies when the segment is created; an existing one keeps its own size.
+        static auto openOrCreate(std::string_view name, size_t size) -> result::Result<SharedSegment>;
+
+        auto data() const -> std::byte* { return m_data; }
+        auto size() const -> size_t { return m_size; }
+        auto created() const -> bool { return m_created; }
+        auto name() const -> const std::string& { return m_name; }
+        explicit operator bool() const { return m_data != nullptr; }
+
+      private:
+        auto release() -> void;
+
+        std::string m_name{};
+        std::byte* m_data{ nullptr };
+        size_t m_size{ 0 };
+        bool m_created{ false };
+        // The mapping object on Windows; unused elsewhere.
+        void* m_handle{ nullptr };
+    };
+}
@@ -240,4 +240,29 @@ namespace core::logger
     {
         return TraceField{ .key = std::move(key), .value = std::format("{:.6f}", value) };
     }
+
+    auto traceExecutorStats(std::string_view station, const ExecutorSample& sample) -> void
+    {
+        auto& trace{ TraceLogger::instance() };
+        if (!trace.enabledFor(TraceCategory::State, station)) {
+            return;
+        }
+
+        auto micros = [](std::chrono::nanoseconds value) {
+            return std::chrono::duration<double, std::micro>(value).count();
+        };
+
+        trace.event(TraceCategory::State,
+                    station,
+                    "executor_stats",
+                    { traceField("instrumented", sample.instrumented),
+                      traceField("ready_depth", sample.readyDepth),
+                      traceField("peak_ready_depth", sample.peakReadyDepth),
+                      traceField("resumes_per_s", sample.resumesPerSecond),
+                      traceField("latency_p50_us", micros(sample.latencyP50)),
+                      traceField("latency_p99_us", micros(sample.latencyP99)),
+                      traceField("latency_max_us", micros(sample.latencyMax)),
+                      traceField("resume_max_us", micros(sample.resumeMax)),
+                      traceField("longest_resume_us", micros(sample.longestResume)) });
+    }
 }
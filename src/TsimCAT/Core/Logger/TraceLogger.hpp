@@ -3,6 +3,7 @@
 #include "Logger.hpp"
 
 #include <chrono>
+#include <cstdint>
 #include <filesystem>
 #include <fstream>
 #include <initializer_list>
@@ -90,4 +91,23 @@ namespace core::logger
     auto traceField(std::string key, uint32_t value) -> TraceField;
     auto traceField(std::string key, uint64_t value) -> TraceField;
     auto traceField(std::string key, double value) -> TraceField;
+
+    // One executor sample, e.g. filled from two coro::ExecutorStats snapshots in an ExecutorMonitor
+    // sink. Rates and latencies cover the interval since the previous sample, so a missed cycle can be
+    // matched against it.
+    struct ExecutorSample
+    {
+        bool instrumented{ false };
+        uint64_t readyDepth{ 0 };
+        uint64_t peakReadyDepth{ 0 };
+        double resumesPerSecond{ 0.0 };
+        std::chrono::nanoseconds latencyP50{ 0 };
+        std::chrono::nanoseconds latencyP99{ 0 };
+        std::chrono::nanoseconds latencyMax{ 0 };
+        std::chrono::nanoseconds resumeMax{ 0 };
+        std::chrono::nanoseconds longestResume{ 0 };
+    };
+
+    // Emits one `executor_stats` State event.
+    auto traceExecutorStats(std::string_view station, const ExecutorSample& sample) -> void;
 }
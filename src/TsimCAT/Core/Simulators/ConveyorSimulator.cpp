@@ -10,8 +10,18 @@ namespace core::sim
     ConveyorSimulator::ConveyorSimulator(Config config, std::shared_ptr<link::ILink> link)
       : m_config(std::move(config))
       , m_link(std::move(link))
+      , m_localAds(dynamic_cast<link::symbolic::LocalAdsLink*>(m_link.get()))
     {
         m_sensorStates.resize(m_config.sensorPositions.size(), false);
+        if (m_localAds) {
+            if (!m_config.adsRunCmd.empty()) {
+                m_localRunCmd = m_localAds->registerSymbol<bool>(m_config.adsRunCmd);
+            }
+            for (const auto& signal : m_config.adsSensorSignals) {
+                m_localSensorSignals.push_back(m_localAds->registerSymbol<bool>(signal));
+            }
+        }
+        publish();
     }
 
     ConveyorSimulator::~ConveyorSimulator() = default;
@@ -41,16 +51,17 @@ namespace core::sim
         if (!m_running)
             return;
 
+        // All sensor signals of a tick are published together.
+        const link::symbolic::ScopedCycle cycle{ m_localAds };
+
         if (!m_internalMode) {
-            if (auto* localAds = dynamic_cast<link::symbolic::LocalAdsLink*>(m_link.get())) {
-                if (!m_config.adsRunCmd.empty() && !m_autoLogic) {
-                    setRunning(localAds->readSync<bool>(m_config.adsRunCmd));
+            if (m_localAds) {
+                if (m_localRunCmd && !m_autoLogic) {
+                    m_beltRunning = m_localAds->readSync<bool>(m_localRunCmd);
                 }
             }
         }
 
-        std::scoped_lock lock(m_mutex);
-
         // 1. Auto Spawn Logic
         if (m_autoSpawn && m_beltRunning) {
             m_autoSpawnTimer += deltaTimeSeconds;
@@ -174,18 +185,25 @@ namespace core::sim
                          [this](const Part& p) { return p.position > m_config.length + p.length; }),
           m_parts.end());
 
+        publish();
+
         if (!m_internalMode) {
-            if (auto* localAds = dynamic_cast<link::symbolic::LocalAdsLink*>(m_link.get())) {
-                for (size_t i = 0; i < m_config.adsSensorSignals.size() && i < m_sensorStates.size(); ++i) {
-                    localAds->writeSync(m_config.adsSensorSignals[i], m_sensorStates[i]);
+            if (m_localAds) {
+                for (size_t i = 0; i < m_localSensorSignals.size() && i < m_sensorStates.size(); ++i) {
+                    m_localAds->writeSync(m_localSensorSignals[i], static_cast<bool>(m_sensorStates[i]));
                 }
             }
         }
     }
 
+    auto ConveyorSimulator::scheduleUpdate(double deltaTimeSeconds) -> void
+    {
+        m_strand.execute([this, deltaTimeSeconds] { update(deltaTimeSeconds); });
+    }
+
     auto ConveyorSimulator::run() -> coro::Task<void>
     {
-        if (dynamic_cast<link::symbolic::LocalAdsLink*>(m_link.get())) {
+        if (m_localAds) {
             co_return;
         }
 
@@ -198,10 +216,11 @@ namespace core::sim
                 if (!m_config.adsRunCmd.empty()) {
                     auto runRes = co_await symbolic->read<bool>(m_config.adsRunCmd);
                     if (runRes) {
-                        std::scoped_lock lock(m_mutex);
                         // Only override if not in autoLogic mode
-                        if (!m_autoLogic)
+                        if (!m_autoLogic) {
                             m_beltRunning = *runRes;
+                            changed();
+                        }
                         logger::TraceLogger::instance().emit(
                           logger::TraceCategory::Protocol,
                           m_config.name,
@@ -220,22 +239,33 @@ namespace core::sim
                     }
                 }
 
-                for (size_t i = 0; i < m_config.adsSensorSignals.size(); ++i) {
-                    if (i < m_sensorStates.size()) {
-                        bool state;
-                        {
-                            std::scoped_lock lock(m_mutex);
-                            state = m_sensorStates[i];
-                        }
-                        (void)co_await symbolic->write(m_config.adsSensorSignals[i], state);
-                        logger::TraceLogger::instance().emit(
-                          logger::TraceCategory::Protocol,
-                          m_config.name,
-                          "ads_tx_sensor",
-                          { logger::traceField("index", static_cast<int>(i)),
-                            logger::traceField("symbol", m_config.adsSensorSignals[i]),
-                            logger::traceField("blocked", state) });
-                    }
+                // All sensors go out in one batch: one round trip per cycle, not one per sensor.
+                const auto count{ std::min(m_config.adsSensorSignals.size(), m_sensorStates.size()) };
+                const std::vector<uint8_t> states(m_sensorStates.begin(), m_sensorStates.begin() + count);
+                std::vector<link::SymbolWrite> writes;
+                writes.reserve(states.size());
+                for (size_t i = 0; i < states.size(); ++i) {
+                    writes.push_back(link::SymbolWrite{ .path = m_config.adsSensorSignals[i],
+                                                        .src = std::as_bytes(std::span{ &states[i], 1 }) });
+                }
+                auto written{ co_await symbolic->writeMany(writes) };
+                if (!written) {
+                    logger::TraceLogger::instance().emit(
+                      logger::TraceCategory::Invariant,
+                      m_config.name,
+                      "ads_tx_sensors_failed",
+                      { logger::traceField("count", static_cast<int>(states.size())),
+                        logger::traceField("error", written.error().message()) });
+                }
+
+                for (size_t i = 0; i < states.size(); ++i) {
+                    logger::TraceLogger::instance().emit(
+                      logger::TraceCategory::Protocol,
+                      m_config.name,
+                      "ads_tx_sensor",
+                      { logger::traceField("index", static_cast<int>(i)),
+                        logger::traceField("symbol", m_config.adsSensorSignals[i]),
+                        logger::traceField("blocked", static_cast<bool>(states[i])) });
                 }
             }
             else if (!m_internalMode) {
@@ -251,83 +281,88 @@ namespace core::sim
 
     auto ConveyorSimulator::spawnPart(uint8_t type) -> void
     {
-        std::scoped_lock lock(m_mutex);
-        for (const auto& part : m_parts) {
-            if (part.position < 150.0)
-                return;
-        }
-        Part newPart;
-        newPart.id = m_nextPartId++;
-        newPart.type = type;
-        newPart.position = 0;
-        newPart.width = 140;
-        newPart.length = 140;
-        newPart.height = 80;
-        m_parts.push_back(newPart);
+        m_strand.execute([this, type] {
+            for (const auto& part : m_parts) {
+                if (part.position < 150.0)
+                    return;
+            }
+            Part newPart;
+            newPart.id = m_nextPartId++;
+            newPart.type = type;
+            newPart.position = 0;
+            newPart.width = 140;
+            newPart.length = 140;
+            newPart.height = 80;
+            m_parts.push_back(newPart);
+            changed();
+        });
     }
 
     auto ConveyorSimulator::spawnPartAtPosition(uint8_t type, double position) -> void
     {
-        std::scoped_lock lock(m_mutex);
-
-        Part newPart;
-        newPart.id = m_nextPartId++;
-        newPart.type = type;
-        newPart.width = 140;
-        newPart.length = 140;
-        newPart.height = 80;
-
-        const double minPosition = newPart.length * 0.5;
-        const double maxPosition = m_config.length - newPart.length * 0.5;
-        newPart.position = std::clamp(position, minPosition, maxPosition);
-
-        for (const auto& part : m_parts) {
-            if (std::abs(part.position - newPart.position) < (newPart.length * 0.8)) {
-                return;
+        m_strand.execute([this, type, position] {
+            Part newPart;
+            newPart.id = m_nextPartId++;
+            newPart.type = type;
+            newPart.width = 140;
+            newPart.length = 140;
+            newPart.height = 80;
+
+            const double minPosition = newPart.length * 0.5;
+            const double maxPosition = m_config.length - newPart.length * 0.5;
+            newPart.position = std::clamp(position, minPosition, maxPosition);
+
+            for (const auto& part : m_parts) {
+                if (std::abs(part.position - newPart.position) < (newPart.length * 0.8)) {
+                    return;
+                }
             }
-        }
 
-        m_parts.push_back(newPart);
+            m_parts.push_back(newPart);
+            changed();
+        });
     }
 
     auto ConveyorSimulator::clearParts() -> void
     {
-        std::scoped_lock lock(m_mutex);
-        m_parts.clear();
+        m_strand.execute([this] {
+            m_parts.clear();
+            changed();
+        });
     }
 
     auto ConveyorSimulator::takePartAtEnd() -> std::optional<Part>
     {
-        std::scoped_lock lock(m_mutex);
-        if (m_parts.empty())
+        auto part{ peekPartAtEnd() };
+        if (!part) {
             return std::nullopt;
+        }
 
-        const bool hasEndSensor = m_config.endSensorIndex >= 0 &&
-                                  m_config.endSensorIndex < static_cast<int>(m_config.sensorPositions.size());
-        const double endSensorPosition =
-          hasEndSensor ? m_config.sensorPositions[static_cast<size_t>(m_config.endSensorIndex)]
-                       : (m_config.length - 200.0);
-
-        // Find part closest to the end
-        auto it = std::max_element(m_parts.begin(), m_parts.end(), [](const Part& a, const Part& b) {
-            return a.position < b.position;
+        m_strand.execute([this, id = part->id] {
+            const auto it{ partAtEnd(m_parts) };
+            if (it != m_parts.end() && it->id == id) {
+                m_parts.erase(it);
+                changed();
+            }
         });
-
-        const double partStart = it->position - it->length / 2;
-        const double partEnd = it->position + it->length / 2;
-        if (endSensorPosition >= partStart && endSensorPosition <= partEnd) {
-            Part p = *it;
-            m_parts.erase(it);
-            return p;
-        }
-        return std::nullopt;
+        return part;
     }
 
     auto ConveyorSimulator::peekPartAtEnd() const -> std::optional<Part>
     {
-        std::scoped_lock lock(m_mutex);
-        if (m_parts.empty())
+        const auto view{ m_strand.view() };
+        const auto it{ partAtEnd(view->parts) };
+        if (it == view->parts.end()) {
             return std::nullopt;
+        }
+        return *it;
+    }
+
+    auto ConveyorSimulator::partAtEnd(const std::vector<Part>& parts) const
+      -> std::vector<Part>::const_iterator
+    {
+        if (parts.empty())
+            return parts.end();
 
         const bool hasEndSensor = m_config.endSensorIndex >= 0 &&
                                   m_config.endSensorIndex < static_cast<int>(m_config.sensorPositions.size());
@@ -335,39 +370,27 @@ namespace core::sim
           hasEndSensor ? m_config.sensorPositions[static_cast<size_t>(m_config.endSensorIndex)]
                        : (m_config.length - 200.0);
 
-        auto it = std::max_element(m_parts.begin(), m_parts.end(), [](const Part& a, const Part& b) {
+        // Find part closest to the end
+        auto it = std::max_element(parts.begin(), parts.end(), [](const Part& a, const Part& b) {
             return a.position < b.position;
         });
 
         const double partStart = it->position - it->length / 2;
         const double partEnd = it->position + it->length / 2;
         if (endSensorPosition >= partStart && endSensorPosition <= partEnd) {
-            return *it;
+            return it;
         }
-        return std::nullopt;
-    }
-
-    auto ConveyorSimulator::parts() const -> std::vector<Part>
-    {
-        std::scoped_lock lock(m_mutex);
-        return m_parts;
-    }
-
-    auto ConveyorSimulator::sensors() const -> std::vector<bool>
-    {
-        std::scoped_lock lock(m_mutex);
-        return m_sensorStates;
+        return parts.end();
     }
 
     auto ConveyorSimulator::sensorBlocked(size_t index) const -> bool
     {
-        std::scoped_lock lock(m_mutex);
         if (index >= m_config.sensorPositions.size()) {
             return false;
         }
 
         const double sensorPos = m_config.sensorPositions[index];
-        for (const auto& part : m_parts) {
+        for (const auto& part : m_strand.view()->parts) {
             const double partStart = part.position - part.length / 2;
             const double partEnd = part.position + part.length / 2;
             if (sensorPos >= partStart && sensorPos <= partEnd) {
@@ -376,4 +399,73 @@ namespace core::sim
         }
         return false;
     }
+
+    auto ConveyorSimulator::setSpeed(double speed) -> void
+    {
+        m_strand.execute([this, speed] {
+            m_config.speed = speed;
+            changed();
+        });
+    }
+
+    auto ConveyorSimulator::setRunning(bool running) -> void
+    {
+        m_strand.execute([this, running] {
+            m_beltRunning = running;
+            changed();
+        });
+    }
+
+    auto ConveyorSimulator::setAutoSpawn(bool enable) -> void
+    {
+        m_strand.execute([this, enable] {
+            m_autoSpawn = enable;
+            changed();
+        });
+    }
+
+    auto ConveyorSimulator::setAutoLogic(bool enable) -> void
+    {
+        m_strand.execute([this, enable] {
+            m_autoLogic = enable;
+            changed();
+        });
+    }
+
+    auto ConveyorSimulator::setConsumeAtEndSensor(bool enable) -> void
+    {
+        m_strand.execute([this, enable] {
+            m_config.consumeAtEndSensor = enable;
+            changed();
+        });
+    }
+
+    auto ConveyorSimulator::setDamperOpen(bool open) -> void
+    {
+        m_strand.execute([this, open] {
+            m_damperOpen = open;
+            changed();
+        });
+    }
+
+    auto ConveyorSimulator::setInternalMode(bool internalMode) -> void
+    {
+        m_strand.execute([this, internalMode] {
+            m_internalMode = internalMode;
+            changed();
+        });
+    }
+
+    auto ConveyorSimulator::publish() -> void
+    {
+        m_strand.publish({ .parts = m_parts,
+                           .sensorStates = m_sensorStates,
+                           .speed = m_config.speed,
+                           .beltRunning = m_beltRunning,
+                           .autoSpawn = m_autoSpawn,
+                           .autoLogic = m_autoLogic,
+                           .consumeAtEndSensor = m_config.consumeAtEndSensor,
+                           .damperOpen = m_damperOpen,
+                           .internalMode = m_internalMode });
+    }
 }
@@ -2,12 +2,19 @@
 
 #include "ISimulator.hpp"
 #include "Link/ILink.hpp"
+#include "Link/Symbolic/ProcessImage.hpp"
 #include "Part.hpp"
+#include "SimulatorStrand.hpp"
+#include <atomic>
 #include <memory>
-#include <mutex>
 #include <string>
 #include <vector>
 
+namespace core::link::symbolic
+{
+    class LocalAdsLink;
+}
+
 namespace core::sim
 {
     class ConveyorSimulator : public ISimulator
@@ -40,6 +47,9 @@ namespace core::sim
         auto start() -> void override;
         auto stop() -> void override;
         auto update(double deltaTimeSeconds) -> void override;
+        auto bindExecutor(coro::IExecutor& executor) -> void override { m_strand.bind(executor); }
+        auto executor() -> coro::IExecutor* override { return m_strand.executor(); }
+        auto scheduleUpdate(double deltaTimeSeconds) -> void override;
 
         auto run() -> coro::Task<void>;
 
@@ -48,46 +58,70 @@ namespace core::sim
         auto spawnPartAtPosition(uint8_t type, double position) -> void;
         auto clearParts() -> void;
         auto peekPartAtEnd() const -> std::optional<Part>;
+        // While bound, answers from the published view; the strand re-checks before removing the part.
         auto takePartAtEnd() -> std::optional<Part>;
 
-        // State Access
-        auto parts() const -> std::vector<Part>;
-        auto sensors() const -> std::vector<bool>;
+        // State Access: the last published view; while bound it may not show a setter called just before
+        auto parts() const -> std::vector<Part> { return m_strand.view()->parts; }
+        auto sensors() const -> std::vector<bool> { return m_strand.view()->sensorStates; }
         auto sensorBlocked(size_t index) const -> bool;
-        auto speed() const -> double { return m_config.speed; }
-        auto setSpeed(double speed) -> void { m_config.speed = speed; }
+        auto speed() const -> double { return m_strand.view()->speed; }
+        auto setSpeed(double speed) -> void;
         auto length() const -> double { return m_config.length; }
 
-        auto isRunning() const -> bool { return m_beltRunning; }
-        auto setRunning(bool running) -> void { m_beltRunning = running; }
+        auto isRunning() const -> bool { return m_strand.view()->beltRunning; }
+        auto setRunning(bool running) -> void;
 
-        auto autoSpawn() const -> bool { return m_autoSpawn; }
-        auto setAutoSpawn(bool enable) -> void { m_autoSpawn = enable; }
+        auto autoSpawn() const -> bool { return m_strand.view()->autoSpawn; }
+        auto setAutoSpawn(bool enable) -> void;
 
-        auto autoLogic() const -> bool { return m_autoLogic; }
-        auto setAutoLogic(bool enable) -> void { m_autoLogic = enable; }
-        auto consumeAtEndSensor() const -> bool { return m_config.consumeAtEndSensor; }
-        auto setConsumeAtEndSensor(bool enable) -> void { m_config.consumeAtEndSensor = enable; }
+        auto autoLogic() const -> bool { return m_strand.view()->autoLogic; }
+        auto setAutoLogic(bool enable) -> void;
+        auto consumeAtEndSensor() const -> bool { return m_strand.view()->consumeAtEndSensor; }
+        auto setConsumeAtEndSensor(bool enable) -> void;
 
-        auto damperOpen() const -> bool { return m_damperOpen; }
-        auto setDamperOpen(bool open) -> void { m_damperOpen = open; }
-        auto isInternalMode() const -> bool { return m_internalMode; }
-        auto setInternalMode(bool internalMode) -> void { m_internalMode = internalMode; }
+        auto damperOpen() const -> bool { return m_strand.view()->damperOpen; }
+        auto setDamperOpen(bool open) -> void;
+        auto isInternalMode() const -> bool { return m_strand.view()->internalMode; }
+        auto setInternalMode(bool internalMode) -> void;
 
       private:
+        struct View
+        {
+            std::vector<Part> parts{};
+            std::vector<bool> sensorStates{};
+            double speed{ 0.0 };
+            bool beltRunning{ true };
+            bool autoSpawn{ false };
+            bool autoLogic{ false };
+            bool consumeAtEndSensor{ false };
+            bool damperOpen{ false };
+            bool internalMode{ false };
+        };
+
+        // The part covering the end sensor (or the default end zone), if any.
+        auto partAtEnd(const std::vector<Part>& parts) const -> std::vector<Part>::const_iterator;
+        // update() publishes once per tick; commands call changed() to have their change republished.
+        auto publish() -> void;
+        auto changed() -> void { m_strand.changed([this] { publish(); }); }
+
         Config m_config;
         std::shared_ptr<link::ILink> m_link;
+        link::symbolic::LocalAdsLink* m_localAds{ nullptr };
+        // Process-image handles, resolved once when the link is in-process.
+        link::symbolic::SymbolHandle m_localRunCmd{};
+        std::vector<link::symbolic::SymbolHandle> m_localSensorSignals{};
         std::vector<Part> m_parts;
         std::vector<bool> m_sensorStates;
         uint32_t m_nextPartId{ 1 };
-        bool m_running{ false };    // Simulator thread running
-        bool m_beltRunning{ true }; // Physical belt moving
+        std::atomic<bool> m_running{ false }; // Simulator thread running
+        bool m_beltRunning{ true };           // Physical belt moving
         bool m_autoSpawn{ false };
         bool m_autoLogic{ false }; // Internal sequence logic
         bool m_damperOpen{ false };
         bool m_internalMode{ false };
         double m_autoSpawnTimer{ 0.0 };
         double m_damperTimer{ 0.0 };
-        mutable std::mutex m_mutex;
+        SimulatorStrand<View> m_strand;
     };
 }
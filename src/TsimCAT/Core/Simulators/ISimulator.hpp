@@ -18,5 +18,13 @@ namespace core::sim
         virtual auto stop() -> void = 0;
         
         virtual auto update(double deltaTimeSeconds) -> void = 0;
+
+        // Runs update(), the comm coroutine and all commands on a strand of `executor` from now on.
+        // Call once, before the simulator is shared with other threads.
+        virtual auto bindExecutor(coro::IExecutor& executor) -> void = 0;
+        // The simulator's strand once bound; nullptr while everything runs inline.
+        virtual auto executor() -> coro::IExecutor* = 0;
+        // Queues update() on the strand, or runs it inline while unbound.
+        virtual auto scheduleUpdate(double deltaTimeSeconds) -> void = 0;
     };
 }
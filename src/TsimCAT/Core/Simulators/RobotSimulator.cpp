@@ -1,5 +1,6 @@
 #include "RobotSimulator.hpp"
 #include "Coroutines/Task.hpp"
+#include "Coroutines/WhenAll.hpp"
 #include "Link/Symbolic/ISymbolicLink.hpp"
 #include "Link/Symbolic/LocalAdsLink.hpp"
 #include "Logger/Logger.hpp"
@@ -62,8 +63,18 @@ namespace core::sim
 
     RobotSimulator::RobotSimulator(std::shared_ptr<link::ILink> link, AdsSymbols adsSymbols, Config config)
       : m_link(std::move(link))
+      , m_localAds(dynamic_cast<link::symbolic::LocalAdsLink*>(m_link.get()))
       , m_adsSymbols(std::move(adsSymbols))
     {
+        if (m_localAds) {
+            m_localSymbols.control = m_localAds->registerSymbol<RobotControl>(m_adsSymbols.controlSymbol);
+            m_localSymbols.status = m_localAds->registerSymbol<RobotStatus>(m_adsSymbols.statusSymbol);
+            if (!m_adsSymbols.gripperSensorSymbol.empty()) {
+                m_localSymbols.gripperSensor =
+                  m_localAds->registerSymbol<bool>(m_adsSymbols.gripperSensorSymbol);
+            }
+        }
+
         auto trajectories = defaultJobTrajectories();
         for (auto& configuredTrajectory : config.jobTrajectories) {
             if (configuredTrajectory.jobId == 0 || configuredTrajectory.poses.empty()) {
@@ -117,6 +128,8 @@ namespace core::sim
         auto pose = m_kinematics.forward(rads);
         logger::info(
           "RobotSimulator: Initial Pose [X: {:.3f}, Y: {:.3f}, Z: {:.3f}]", pose.x, pose.y, pose.z);
+
+        publish();
     }
 
     RobotSimulator::~RobotSimulator() { stop(); }
@@ -160,17 +173,16 @@ namespace core::sim
 
     auto RobotSimulator::update(double deltaTimeSeconds) -> void
     {
+        // Status and gripper sensor reach subscribers together, once per tick.
+        const link::symbolic::ScopedCycle cycle{ m_localAds };
+
         if (!m_internalMode && m_externalCommandSimulationEnabled) {
-            if (auto* localAds = dynamic_cast<link::symbolic::LocalAdsLink*>(m_link.get())) {
-                const auto control = localAds->readSync<RobotControl>(m_adsSymbols.controlSymbol);
-                std::scoped_lock controlLock(m_mutex);
-                m_control = control;
+            if (m_localAds) {
+                m_control = m_localAds->readSync<RobotControl>(m_localSymbols.control);
             }
         }
 
         // Logic Simulation
-        std::scoped_lock lock(m_mutex);
-
         const bool autoCommandActive =
           m_externalCommandSimulationEnabled && m_control.bMoveEnable && !m_status.bError;
         const bool motionRequested = m_manualTrajectoryActive || autoCommandActive;
@@ -292,13 +304,36 @@ namespace core::sim
         }
 
         if (!m_internalMode) {
-            if (auto* localAds = dynamic_cast<link::symbolic::LocalAdsLink*>(m_link.get())) {
-                localAds->writeSync(m_adsSymbols.statusSymbol, m_status);
-                if (!m_adsSymbols.gripperSensorSymbol.empty()) {
-                    localAds->writeSync(m_adsSymbols.gripperSensorSymbol, m_gripperSensorBlocked);
+            if (m_localAds) {
+                m_localAds->writeSync(m_localSymbols.status, m_status);
+                if (m_localSymbols.gripperSensor) {
+                    m_localAds->writeSync(m_localSymbols.gripperSensor, m_gripperSensorBlocked);
                 }
             }
         }
+
+        publish();
+    }
+
+    auto RobotSimulator::scheduleUpdate(double deltaTimeSeconds) -> void
+    {
+        m_strand.execute([this, deltaTimeSeconds] { update(deltaTimeSeconds); });
+    }
+
+    auto RobotSimulator::publish() -> void
+    {
+        std::array<double, 6> rads;
+        for (int i = 0; i < 6; ++i)
+            rads[i] = m_jointAngles[i] * std::numbers::pi / 180.0;
+
+        m_strand.publish({ .control = m_control,
+                           .status = m_status,
+                           .jointAngles = m_jointAngles,
+                           .pose = m_kinematics.forward(rads),
+                           .gripperGripped = m_gripperGripped,
+                           .gripperSensorBlocked = m_gripperSensorBlocked,
+                           .internalMode = m_internalMode,
+                           .externalCommandSimulationEnabled = m_externalCommandSimulationEnabled });
     }
 
     auto RobotSimulator::defaultJobTrajectories() -> std::vector<JobTrajectory>
@@ -443,21 +478,13 @@ namespace core::sim
         return result;
     }
 
-    auto RobotSimulator::control() const -> RobotControl
-    {
-        std::scoped_lock lock(m_mutex);
-        return m_control;
-    }
+    auto RobotSimulator::control() const -> RobotControl { return m_strand.view()->control; }
 
-    auto RobotSimulator::status() const -> RobotStatus
-    {
-        std::scoped_lock lock(m_mutex);
-        return m_status;
-    }
+    auto RobotSimulator::status() const -> RobotStatus { return m_strand.view()->status; }
 
     auto RobotSimulator::adsStatus() const -> std::string
     {
-        if (m_internalMode) {
+        if (m_strand.view()->internalMode) {
             return "Local";
         }
         if (!m_link)
@@ -476,18 +503,14 @@ namespace core::sim
         }
     }
 
-    auto RobotSimulator::jointAngles() const -> const double*
-    {
-        std::scoped_lock lock(m_mutex);
-        return m_jointAngles;
-    }
+    auto RobotSimulator::jointAngles() const -> std::array<double, 6> { return m_strand.view()->jointAngles; }
 
     auto RobotSimulator::run() -> coro::Task<void>
     {
         if (m_internalMode || !m_link)
             co_return;
 
-        if (dynamic_cast<link::symbolic::LocalAdsLink*>(m_link.get())) {
+        if (m_localAds) {
             co_return;
         }
 
@@ -503,11 +526,16 @@ namespace core::sim
 
             // Only communicate if actually connected to avoid floods
             if (m_link->status() == link::Status::Connected) {
-                // 1. Read Commands
-                auto ctrlRes = co_await symbolic->read<RobotControl>(m_adsSymbols.controlSymbol);
+                // Read commands and write status concurrently: a cycle costs one round trip, not two.
+                const RobotStatus s{ m_status };
+                auto exchange = co_await coro::whenAll(
+                  symbolic->read<RobotControl>(m_adsSymbols.controlSymbol),
+                  symbolic->write(m_adsSymbols.statusSymbol, s));
+
+                const auto& ctrlRes = std::get<0>(exchange);
                 if (ctrlRes) {
-                    std::scoped_lock lock(m_mutex);
                     m_control = *ctrlRes;
+                    changed();
                     logger::TraceLogger::instance().emit(
                       logger::TraceCategory::Protocol,
                       "robot",
@@ -517,13 +545,6 @@ namespace core::sim
                         logger::traceField("symbol", m_adsSymbols.controlSymbol) });
                 }
 
-                // 2. Write Status
-                RobotStatus s;
-                {
-                    std::scoped_lock lock(m_mutex);
-                    s = m_status;
-                }
-                (void)co_await symbolic->write(m_adsSymbols.statusSymbol, s);
                 logger::TraceLogger::instance().emit(
                   logger::TraceCategory::Protocol,
                   "robot",
@@ -548,155 +569,145 @@ namespace core::sim
         }
     }
 
-    auto RobotSimulator::currentPose() const -> Pose
-    {
-        std::scoped_lock lock(m_mutex);
-        std::array<double, 6> rads;
-        for (int i = 0; i < 6; ++i)
-            rads[i] = m_jointAngles[i] * std::numbers::pi / 180.0;
-        return m_kinematics.forward(rads);
-    }
+    auto RobotSimulator::currentPose() const -> Pose { return m_strand.view()->pose; }
 
-    auto RobotSimulator::isGripperGripped() const -> bool
-    {
-        std::scoped_lock lock(m_mutex);
-        return m_gripperGripped;
-    }
+    auto RobotSimulator::isGripperGripped() const -> bool { return m_strand.view()->gripperGripped; }
 
     auto RobotSimulator::setGripper(bool gripped) -> void
     {
-        std::scoped_lock lock(m_mutex);
-        m_gripperGripped = gripped;
+        m_strand.execute([this, gripped] {
+            m_gripperGripped = gripped;
+            changed();
+        });
     }
 
     auto RobotSimulator::isGripperSensorBlocked() const -> bool
     {
-        std::scoped_lock lock(m_mutex);
-        return m_gripperSensorBlocked;
+        return m_strand.view()->gripperSensorBlocked;
     }
 
     auto RobotSimulator::setGripperSensorBlocked(bool blocked) -> void
     {
-        std::scoped_lock lock(m_mutex);
-        m_gripperSensorBlocked = blocked;
+        m_strand.execute([this, blocked] {
+            m_gripperSensorBlocked = blocked;
+            changed();
+        });
     }
 
     auto RobotSimulator::setJointAngles(const double* anglesDegrees) -> void
     {
-        std::scoped_lock lock(m_mutex);
-        for (int i = 0; i < 6; ++i) {
-            m_jointAngles[i] = anglesDegrees[i];
-        }
-        m_currentTrajectory.clear();
-        m_manualTrajectoryActive = false;
+        std::array<double, 6> angles;
+        std::copy_n(anglesDegrees, angles.size(), angles.begin());
+        m_strand.execute([this, angles] {
+            m_jointAngles = angles;
+            m_currentTrajectory.clear();
+            m_manualTrajectoryActive = false;
+            changed();
+        });
     }
 
     auto RobotSimulator::setTargetPose(const Pose& pose) -> bool
     {
+        const auto start{ jointAngles() };
         std::array<double, 6> seed;
-        {
-            std::scoped_lock lock(m_mutex);
-            for (int i = 0; i < 6; ++i)
-                seed[i] = m_jointAngles[i] * std::numbers::pi / 180.0;
-        }
+        for (int i = 0; i < 6; ++i)
+            seed[i] = start[i] * std::numbers::pi / 180.0;
 
-        auto joints = m_kinematics.inverse(pose, seed);
+        auto joints = m_commandKinematics.inverse(pose, seed);
         if (joints.empty()) {
             return false;
         }
 
-        std::array<double, 6> start;
         std::array<double, 6> target;
-        {
-            std::scoped_lock lock(m_mutex);
-            for (int i = 0; i < 6; ++i) {
-                start[i] = m_jointAngles[i];
-                target[i] = joints[i] * 180.0 / std::numbers::pi;
-            }
-        }
+        for (int i = 0; i < 6; ++i)
+            target[i] = joints[i] * 180.0 / std::numbers::pi;
 
-        auto path = planTrajectory(start, target);
-        std::scoped_lock lock(m_mutex);
-        m_currentTrajectory = std::move(path);
-        m_trajectoryStep = 0;
-        m_manualTrajectoryActive = true;
+        m_strand.execute([this, path = planTrajectory(start, target)]() mutable {
+            m_currentTrajectory = std::move(path);
+            m_trajectoryStep = 0;
+            m_manualTrajectoryActive = true;
+            changed();
+        });
         return true;
     }
 
     auto RobotSimulator::setExternalCommandSimulationEnabled(bool enabled) -> void
     {
-        std::scoped_lock lock(m_mutex);
-        m_externalCommandSimulationEnabled = enabled;
-        if (!enabled) {
-            m_control.bMoveEnable = 0;
-            m_control.nJobId = 0;
-            m_lastTargetJobId = 0;
-        }
+        m_strand.execute([this, enabled] {
+            m_externalCommandSimulationEnabled = enabled;
+            if (!enabled) {
+                m_control.bMoveEnable = 0;
+                m_control.nJobId = 0;
+                m_lastTargetJobId = 0;
+            }
+            changed();
+        });
     }
 
     auto RobotSimulator::externalCommandSimulationEnabled() const -> bool
     {
-        std::scoped_lock lock(m_mutex);
-        return m_externalCommandSimulationEnabled;
+        return m_strand.view()->externalCommandSimulationEnabled;
     }
 
     auto RobotSimulator::triggerJob(uint16_t jobId) -> void
     {
-        if (auto* localAds = dynamic_cast<link::symbolic::LocalAdsLink*>(m_link.get())) {
-            auto control = localAds->readSync<RobotControl>(m_adsSymbols.controlSymbol);
+        if (m_localAds) {
+            auto control = m_localAds->readSync<RobotControl>(m_localSymbols.control);
             control.nJobId = jobId;
             control.bMoveEnable = 1;
-            localAds->writeSync(m_adsSymbols.controlSymbol, control);
+            m_localAds->writeSync(m_localSymbols.control, control);
             return;
         }
 
-        std::scoped_lock lock(m_mutex);
-        if (!m_internalMode) {
-            logger::TraceLogger::instance().emit(logger::TraceCategory::Lifecycle,
+        m_strand.execute([this, jobId] {
+            if (!m_internalMode) {
+                logger::TraceLogger::instance().emit(
+                  logger::TraceCategory::Lifecycle,
+                  "robot",
+                  "job_trigger_ignored_remote_mode",
+                  { logger::traceField("job_id", static_cast<int>(jobId)) });
+                return;
+            }
+            m_control.nJobId = jobId;
+            m_control.bMoveEnable = 1; // Auto-enable move for convenience in simulation
+            changed();
+            logger::TraceLogger::instance().emit(logger::TraceCategory::Flow,
                                                  "robot",
-                                                 "job_trigger_ignored_remote_mode",
+                                                 "job_triggered",
                                                  { logger::traceField("job_id", static_cast<int>(jobId)) });
-            return;
-        }
-        m_control.nJobId = jobId;
-        m_control.bMoveEnable = 1; // Auto-enable move for convenience in simulation
-        logger::TraceLogger::instance().emit(logger::TraceCategory::Flow,
-                                             "robot",
-                                             "job_triggered",
-                                             { logger::traceField("job_id", static_cast<int>(jobId)) });
+        });
     }
 
     auto RobotSimulator::setInternalMode(bool internalMode) -> void
     {
-        std::scoped_lock lock(m_mutex);
-        if (m_internalMode == internalMode) {
-            return;
-        }
+        m_strand.execute([this, internalMode] {
+            if (m_internalMode == internalMode) {
+                return;
+            }
 
-        m_internalMode = internalMode;
-        if (!m_internalMode) {
-            m_control.nJobId = 0;
-            m_control.bMoveEnable = 0;
-            m_currentTrajectory.clear();
-            m_trajectoryStep = 0;
-            m_lastTargetJobId = 0;
-            m_lastSuccessfulJobId = 0;
-            m_status.bInMotion = 0;
-            m_status.nJobIdFeedback = 0;
-            logger::TraceLogger::instance().emit(logger::TraceCategory::State,
+            m_internalMode = internalMode;
+            if (!m_internalMode) {
+                m_control.nJobId = 0;
+                m_control.bMoveEnable = 0;
+                m_currentTrajectory.clear();
+                m_trajectoryStep = 0;
+                m_lastTargetJobId = 0;
+                m_lastSuccessfulJobId = 0;
+                m_status.bInMotion = 0;
+                m_status.nJobIdFeedback = 0;
+                logger::TraceLogger::instance().emit(
+                  logger::TraceCategory::State,
+                  "robot",
+                  "local_motion_quiesced",
+                  { logger::traceField("reason", "switched_to_remote_mode") });
+            }
+            changed();
+            logger::TraceLogger::instance().emit(logger::TraceCategory::Lifecycle,
                                                  "robot",
-                                                 "local_motion_quiesced",
-                                                 { logger::traceField("reason", "switched_to_remote_mode") });
-        }
-        logger::TraceLogger::instance().emit(logger::TraceCategory::Lifecycle,
-                                             "robot",
-                                             "internal_mode_changed",
-                                             { logger::traceField("internal", internalMode) });
+                                                 "internal_mode_changed",
+                                                 { logger::traceField("internal", internalMode) });
+        });
     }
 
-    auto RobotSimulator::isInternalMode() const -> bool
-    {
-        std::scoped_lock lock(m_mutex);
-        return m_internalMode;
-    }
-}
\ No newline at end of file
+    auto RobotSimulator::isInternalMode() const -> bool { return m_strand.view()->internalMode; }
+}
@@ -3,14 +3,21 @@
 #include "ISimulator.hpp"
 #include "Kinematics.hpp"
 #include "Link/ILink.hpp"
+#include "Link/Symbolic/ProcessImage.hpp"
+#include "SimulatorStrand.hpp"
 #include <array>
+#include <atomic>
 #include <cstdint>
 #include <memory>
-#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
+namespace core::link::symbolic
+{
+    class LocalAdsLink;
+}
+
 namespace core::sim
 {
 /**
@@ -92,14 +99,17 @@ namespace core::sim
         auto start() -> void override;
         auto stop() -> void override;
         auto update(double deltaTimeSeconds) -> void override;
+        auto bindExecutor(coro::IExecutor& executor) -> void override { m_strand.bind(executor); }
+        auto executor() -> coro::IExecutor* override { return m_strand.executor(); }
+        auto scheduleUpdate(double deltaTimeSeconds) -> void override;
 
         auto run() -> coro::Task<void>;
 
-        // State Access
+        // State Access: the last published view; while bound it may not show a setter called just before
         auto control() const -> RobotControl;
         auto status() const -> RobotStatus;
         auto adsStatus() const -> std::string;
-        auto jointAngles() const -> const double*;
+        auto jointAngles() const -> std::array<double, 6>;
         auto currentPose() const -> Pose;
 
         auto isGripperGripped() const -> bool;
@@ -108,6 +118,7 @@ namespace core::sim
         auto setGripperSensorBlocked(bool blocked) -> void;
 
         auto setJointAngles(const double* anglesDegrees) -> void;
+        // Solves the pose on the caller's thread and queues the resulting move; false if unreachable.
         auto setTargetPose(const Pose& pose) -> bool;
         auto triggerJob(uint16_t jobId) -> void;
         auto setInternalMode(bool internalMode) -> void;
@@ -116,6 +127,18 @@ namespace core::sim
         auto externalCommandSimulationEnabled() const -> bool;
 
       private:
+        struct View
+        {
+            RobotControl control{};
+            RobotStatus status{};
+            std::array<double, 6> jointAngles{};
+            Pose pose{};
+            bool gripperGripped{ false };
+            bool gripperSensorBlocked{ false };
+            bool internalMode{ false };
+            bool externalCommandSimulationEnabled{ true };
+        };
+
         enum class JobId : uint16_t
         {
             Home = 1,
@@ -131,18 +154,33 @@ namespace core::sim
                                         const std::vector<Pose>& poses,
                                         std::vector<std::array<double, 6>>& outTrajectory) const -> bool;
         auto applyJobCompletionEffects(uint16_t jobId) -> void;
+        // update() publishes once per tick; commands call changed() to have their change republished.
+        auto publish() -> void;
+        auto changed() -> void { m_strand.changed([this] { publish(); }); }
 
         auto planTrajectory(const std::array<double, 6>& startJoints,
                             const std::array<double, 6>& targetJoints) const
           -> std::vector<std::array<double, 6>>;
 
+        // Process-image handles, resolved once when the link is in-process.
+        struct LocalSymbols
+        {
+            link::symbolic::SymbolHandle control{};
+            link::symbolic::SymbolHandle status{};
+            link::symbolic::SymbolHandle gripperSensor{};
+        };
+
         std::shared_ptr<link::ILink> m_link;
+        link::symbolic::LocalAdsLink* m_localAds{ nullptr };
         AdsSymbols m_adsSymbols;
+        LocalSymbols m_localSymbols{};
         Kinematics m_kinematics;
+        // The KDL solvers keep scratch state, so setTargetPose() solves on its own instance.
+        Kinematics m_commandKinematics;
 
         RobotControl m_control{};
         RobotStatus m_status{};
-        double m_jointAngles[6]{};
+        std::array<double, 6> m_jointAngles{};
         double m_targetJointAngles[6]{};
         uint16_t m_lastTargetJobId{ 0 };
         uint16_t m_lastSuccessfulJobId{ 0 };
@@ -156,7 +194,7 @@ namespace core::sim
         std::vector<std::array<double, 6>> m_currentTrajectory;
         size_t m_trajectoryStep{ 0 };
 
-        mutable std::mutex m_mutex;
         std::atomic<bool> m_running{ false };
+        SimulatorStrand<View> m_strand;
     };
 }
\ No newline at end of file
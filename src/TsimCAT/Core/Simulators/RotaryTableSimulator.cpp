@@ -19,18 +19,24 @@ namespace core::sim
                                                AdsSymbols adsSymbols)
       : m_config(std::move(config))
       , m_link(std::move(link))
+      , m_localAds(dynamic_cast<link::symbolic::LocalAdsLink*>(m_link.get()))
       , m_adsSymbols(std::move(adsSymbols))
       , m_currentAngleDeg(m_config.loadAngleDeg)
       , m_targetAngleDeg(m_config.loadAngleDeg)
     {
-        updateStatusLocked();
+        if (m_localAds) {
+            m_localControl = m_localAds->registerSymbol<RotaryTableControl>(m_adsSymbols.controlSymbol);
+            m_localStatus = m_localAds->registerSymbol<RotaryTableStatus>(m_adsSymbols.statusSymbol);
+        }
+        updateStatus();
+        publish();
     }
 
     RotaryTableSimulator::~RotaryTableSimulator() { stop(); }
 
     auto RotaryTableSimulator::initialize() -> coro::Task<result::Result<void>>
     {
-        if (!m_link || m_internalMode || dynamic_cast<link::symbolic::LocalAdsLink*>(m_link.get())) {
+        if (!m_link || m_internalMode || m_localAds) {
             co_return result::success();
         }
 
@@ -51,79 +57,78 @@ namespace core::sim
             return;
         }
 
+        const link::symbolic::ScopedCycle cycle{ m_localAds };
+
         if (!m_internalMode) {
-            if (auto* localAds = dynamic_cast<link::symbolic::LocalAdsLink*>(m_link.get())) {
-                std::scoped_lock lock(m_mutex);
-                m_control = localAds->readSync<RotaryTableControl>(m_adsSymbols.controlSymbol);
+            if (m_localAds) {
+                m_control = m_localAds->readSync<RotaryTableControl>(m_localControl);
             }
         }
 
-        RotaryTableStatus statusCopy{};
-        {
-            std::scoped_lock lock(m_mutex);
+        if (m_control.bReset) {
+            m_hasPart = false;
+            m_currentAngleDeg = m_config.loadAngleDeg;
+            m_targetAngleDeg = m_config.loadAngleDeg;
+            m_loadTimerSeconds = 0.0;
+        }
 
-            if (m_control.bReset) {
-                m_hasPart = false;
-                m_currentAngleDeg = m_config.loadAngleDeg;
-                m_targetAngleDeg = m_config.loadAngleDeg;
-                m_loadTimerSeconds = 0.0;
-            }
+        if (m_control.bEnable) {
+            const bool atLoad = std::abs(m_currentAngleDeg - m_config.loadAngleDeg) <= angleToleranceDegrees;
+            const bool atPick = std::abs(m_currentAngleDeg - m_config.pickAngleDeg) <= angleToleranceDegrees;
 
-            if (m_control.bEnable) {
-                const bool atLoad =
-                  std::abs(m_currentAngleDeg - m_config.loadAngleDeg) <= angleToleranceDegrees;
-                const bool atPick =
-                  std::abs(m_currentAngleDeg - m_config.pickAngleDeg) <= angleToleranceDegrees;
-
-                if (m_control.bLoadPart && !m_hasPart && atLoad) {
-                    m_loadTimerSeconds += deltaTimeSeconds;
-                    if (m_loadTimerSeconds >= m_config.loadDelaySeconds) {
-                        m_hasPart = true;
-                        m_loadTimerSeconds = 0.0;
-                        logger::TraceLogger::instance().emit(
-                          logger::TraceCategory::State,
-                          "rotary_table",
-                          "part_loaded",
-                          { logger::traceField("angle", m_currentAngleDeg) });
-                    }
-                }
-                else {
+            if (m_control.bLoadPart && !m_hasPart && atLoad) {
+                m_loadTimerSeconds += deltaTimeSeconds;
+                if (m_loadTimerSeconds >= m_config.loadDelaySeconds) {
+                    m_hasPart = true;
                     m_loadTimerSeconds = 0.0;
-                }
-
-                if (m_control.bIndex && m_hasPart && atLoad) {
-                    m_targetAngleDeg = m_config.pickAngleDeg;
                     logger::TraceLogger::instance().emit(
                       logger::TraceCategory::State,
                       "rotary_table",
-                      "index_started",
-                      { logger::traceField("target_angle", m_config.pickAngleDeg) });
+                      "part_loaded",
+                      { logger::traceField("angle", m_currentAngleDeg) });
                 }
             }
-
-            const double diff = m_targetAngleDeg - m_currentAngleDeg;
-            const double step = m_config.rotationSpeedDegPerSecond * deltaTimeSeconds;
-            if (std::abs(diff) > step) {
-                m_currentAngleDeg += std::copysign(step, diff);
-            }
             else {
-                m_currentAngleDeg = m_targetAngleDeg;
+                m_loadTimerSeconds = 0.0;
             }
 
-            updateStatusLocked();
-            statusCopy = m_status;
+            if (m_control.bIndex && m_hasPart && atLoad) {
+                m_targetAngleDeg = m_config.pickAngleDeg;
+                logger::TraceLogger::instance().emit(
+                  logger::TraceCategory::State,
+                  "rotary_table",
+                  "index_started",
+                  { logger::traceField("target_angle", m_config.pickAngleDeg) });
+            }
+        }
+
+        const double diff = m_targetAngleDeg - m_currentAngleDeg;
+        const double step = m_config.rotationSpeedDegPerSecond * deltaTimeSeconds;
+        if (std::abs(diff) > step) {
+            m_currentAngleDeg += std::copysign(step, diff);
+        }
+        else {
+            m_currentAngleDeg = m_targetAngleDeg;
         }
 
+        updateStatus();
+        publish();
+
         if (!m_internalMode) {
-            if (auto* localAds = dynamic_cast<link::symbolic::LocalAdsLink*>(m_link.get())) {
-                localAds->writeSync(m_adsSymbols.statusSymbol, statusCopy);
+            if (m_localAds) {
+                m_localAds->writeSync(m_localStatus, m_status);
             }
         }
     }
 
+    auto RotaryTableSimulator::scheduleUpdate(double deltaTimeSeconds) -> void
+    {
+        m_strand.execute([this, deltaTimeSeconds] { update(deltaTimeSeconds); });
+    }
+
     auto RotaryTableSimulator::run() -> coro::Task<void>
     {
-        if (m_internalMode || !m_link || dynamic_cast<link::symbolic::LocalAdsLink*>(m_link.get())) {
+        if (m_internalMode || !m_link || m_localAds) {
             co_return;
         }
 
@@ -136,8 +141,8 @@ namespace core::sim
             if (m_link->status() == link::Status::Connected) {
                 auto control = co_await symbolic->read<RotaryTableControl>(m_adsSymbols.controlSymbol);
                 if (control) {
-                    std::scoped_lock lock(m_mutex);
                     m_control = *control;
+                    changed();
                     logger::TraceLogger::instance().emit(
                       logger::TraceCategory::Protocol,
                       "rotary_table",
@@ -147,11 +152,7 @@ namespace core::sim
                         logger::traceField("load", m_control.bLoadPart != 0) });
                 }
 
-                RotaryTableStatus statusCopy{};
-                {
-                    std::scoped_lock lock(m_mutex);
-                    statusCopy = m_status;
-                }
+                const RotaryTableStatus statusCopy{ m_status };
                 (void)co_await symbolic->write(m_adsSymbols.statusSymbol, statusCopy);
                 logger::TraceLogger::instance().emit(
                   logger::TraceCategory::Protocol,
@@ -167,127 +168,117 @@ namespace core::sim
         }
     }
 
-    auto RotaryTableSimulator::control() const -> RotaryTableControl
-    {
-        std::scoped_lock lock(m_mutex);
-        return m_control;
-    }
+    auto RotaryTableSimulator::control() const -> RotaryTableControl { return m_strand.view()->control; }
 
-    auto RotaryTableSimulator::status() const -> RotaryTableStatus
-    {
-        std::scoped_lock lock(m_mutex);
-        return m_status;
-    }
+    auto RotaryTableSimulator::status() const -> RotaryTableStatus { return m_strand.view()->status; }
 
     auto RotaryTableSimulator::currentAngleDegrees() const -> double
     {
-        std::scoped_lock lock(m_mutex);
-        return m_currentAngleDeg;
+        return m_strand.view()->currentAngleDeg;
     }
 
-    auto RotaryTableSimulator::partPresent() const -> bool
-    {
-        std::scoped_lock lock(m_mutex);
-        return m_hasPart;
-    }
+    auto RotaryTableSimulator::partPresent() const -> bool { return m_strand.view()->hasPart; }
 
     auto RotaryTableSimulator::readyToPick() const -> bool
     {
-        std::scoped_lock lock(m_mutex);
-        return m_status.bReadyToPick != 0;
+        return m_strand.view()->status.bReadyToPick != 0;
     }
 
     auto RotaryTableSimulator::atLoadPosition() const -> bool
     {
-        std::scoped_lock lock(m_mutex);
-        return m_status.bAtLoadPosition != 0;
+        return m_strand.view()->status.bAtLoadPosition != 0;
     }
 
     auto RotaryTableSimulator::atPickPosition() const -> bool
     {
-        std::scoped_lock lock(m_mutex);
-        return m_status.bAtPickPosition != 0;
+        return m_strand.view()->status.bAtPickPosition != 0;
     }
 
-    auto RotaryTableSimulator::isBusy() const -> bool
-    {
-        std::scoped_lock lock(m_mutex);
-        return m_status.bBusy != 0;
-    }
+    auto RotaryTableSimulator::isBusy() const -> bool { return m_strand.view()->status.bBusy != 0; }
 
     auto RotaryTableSimulator::setInternalMode(bool internalMode) -> void
     {
-        std::scoped_lock lock(m_mutex);
-        m_internalMode = internalMode;
+        m_strand.execute([this, internalMode] {
+            m_internalMode = internalMode;
+            changed();
+        });
     }
 
-    auto RotaryTableSimulator::isInternalMode() const -> bool
-    {
-        std::scoped_lock lock(m_mutex);
-        return m_internalMode;
-    }
+    auto RotaryTableSimulator::isInternalMode() const -> bool { return m_strand.view()->internalMode; }
 
     auto RotaryTableSimulator::queuePart() -> void
     {
-        if (auto* localAds = dynamic_cast<link::symbolic::LocalAdsLink*>(m_link.get())) {
+        if (m_localAds) {
             RotaryTableControl control{};
             control.bEnable = 1;
             control.bLoadPart = 1;
-            localAds->writeSync(m_adsSymbols.controlSymbol, control);
+            m_localAds->writeSync(m_localControl, control);
             return;
         }
 
-        std::scoped_lock lock(m_mutex);
-        if (!m_internalMode || m_hasPart) {
-            return;
-        }
+        m_strand.execute([this] {
+            if (!m_internalMode || m_hasPart) {
+                return;
+            }
 
-        m_control.bEnable = 1;
-        m_control.bLoadPart = 1;
-        m_control.bIndex = 0;
+            m_control.bEnable = 1;
+            m_control.bLoadPart = 1;
+            m_control.bIndex = 0;
+            changed();
+        });
     }
 
     auto RotaryTableSimulator::tryLoadPart() -> bool
     {
-        RotaryTableStatus statusCopy{};
-        {
-            std::scoped_lock lock(m_mutex);
+        const auto view{ m_strand.view() };
+        if (view->hasPart || !view->status.bAtLoadPosition) {
+            return false;
+        }
+
+        m_strand.execute([this] {
             const bool atLoad = std::abs(m_currentAngleDeg - m_config.loadAngleDeg) <= angleToleranceDegrees;
             if (m_hasPart || !atLoad) {
-                return false;
+                return;
             }
 
             m_hasPart = true;
             m_loadTimerSeconds = 0.0;
-            updateStatusLocked();
-            statusCopy = m_status;
-        }
-
-        if (auto* localAds = dynamic_cast<link::symbolic::LocalAdsLink*>(m_link.get())) {
-            localAds->writeSync(m_adsSymbols.statusSymbol, statusCopy);
-        }
+            updateStatus();
+            changed();
 
+            if (m_localAds) {
+                m_localAds->writeSync(m_localStatus, m_status);
+            }
+        });
         return true;
     }
 
     auto RotaryTableSimulator::takePartForRobot() -> bool
     {
-        std::scoped_lock lock(m_mutex);
-        if (!m_hasPart || m_status.bReadyToPick == 0) {
+        const auto view{ m_strand.view() };
+        if (!view->hasPart || view->status.bReadyToPick == 0) {
             return false;
         }
 
-        m_hasPart = false;
-        m_targetAngleDeg = m_config.loadAngleDeg;
-        updateStatusLocked();
-        logger::TraceLogger::instance().emit(logger::TraceCategory::State,
-                                             "rotary_table",
-                                             "part_taken_by_robot",
-                                             { logger::traceField("return_angle", m_config.loadAngleDeg) });
+        m_strand.execute([this] {
+            if (!m_hasPart || m_status.bReadyToPick == 0) {
+                return;
+            }
+
+            m_hasPart = false;
+            m_targetAngleDeg = m_config.loadAngleDeg;
+            updateStatus();
+            changed();
+            logger::TraceLogger::instance().emit(
+              logger::TraceCategory::State,
+              "rotary_table",
+              "part_taken_by_robot",
+              { logger::traceField("return_angle", m_config.loadAngleDeg) });
+        });
         return true;
     }
 
-    auto RotaryTableSimulator::updateStatusLocked() -> void
+    auto RotaryTableSimulator::updateStatus() -> void
     {
         const bool atLoad = std::abs(m_currentAngleDeg - m_config.loadAngleDeg) <= angleToleranceDegrees;
         const bool atPick = std::abs(m_currentAngleDeg - m_config.pickAngleDeg) <= angleToleranceDegrees;
@@ -300,4 +291,13 @@ namespace core::sim
         m_status.bBusy = std::abs(m_currentAngleDeg - m_targetAngleDeg) > angleToleranceDegrees ? 1 : 0;
         m_status.nIndexPosition = atPick ? 1 : 0;
     }
-}
\ No newline at end of file
+
+    auto RotaryTableSimulator::publish() -> void
+    {
+        m_strand.publish({ .control = m_control,
+                           .status = m_status,
+                           .currentAngleDeg = m_currentAngleDeg,
+                           .hasPart = m_hasPart,
+                           .internalMode = m_internalMode });
+    }
+}
@@ -1,15 +1,21 @@
 #pragma once
 
 #include "ISimulator.hpp"
+#include "SimulatorStrand.hpp"
 
 #include "Link/ILink.hpp"
+#include "Link/Symbolic/ProcessImage.hpp"
 
 #include <atomic>
 #include <cstdint>
 #include <memory>
-#include <mutex>
 #include <string>
 
+namespace core::link::symbolic
+{
+    class LocalAdsLink;
+}
+
 namespace core::sim
 {
 #pragma pack(push, 1)
@@ -68,9 +74,13 @@ namespace core::sim
         auto start() -> void override;
         auto stop() -> void override;
         auto update(double deltaTimeSeconds) -> void override;
+        auto bindExecutor(coro::IExecutor& executor) -> void override { m_strand.bind(executor); }
+        auto executor() -> coro::IExecutor* override { return m_strand.executor(); }
+        auto scheduleUpdate(double deltaTimeSeconds) -> void override;
 
         auto run() -> coro::Task<void>;
 
+        // State access reads the last published view; while bound it may lag a setter called just before.
         auto control() const -> RotaryTableControl;
         auto status() const -> RotaryTableStatus;
         auto currentAngleDegrees() const -> double;
@@ -83,17 +93,33 @@ namespace core::sim
         auto setInternalMode(bool internalMode) -> void;
         auto isInternalMode() const -> bool;
         auto queuePart() -> void;
+        // While bound, these answer from the published view and the strand re-checks before acting.
         auto tryLoadPart() -> bool;
         auto takePartForRobot() -> bool;
 
       private:
-        auto updateStatusLocked() -> void;
+        struct View
+        {
+            RotaryTableControl control{};
+            RotaryTableStatus status{};
+            double currentAngleDeg{ 0.0 };
+            bool hasPart{ false };
+            bool internalMode{ false };
+        };
+
+        auto updateStatus() -> void;
+        // update() publishes once per tick; commands call changed() to have their change republished.
+        auto publish() -> void;
+        auto changed() -> void { m_strand.changed([this] { publish(); }); }
 
         Config m_config;
         std::shared_ptr<link::ILink> m_link;
+        link::symbolic::LocalAdsLink* m_localAds{ nullptr };
         AdsSymbols m_adsSymbols;
+        // Process-image handles, resolved once when the link is in-process.
+        link::symbolic::SymbolHandle m_localControl{};
+        link::symbolic::SymbolHandle m_localStatus{};
 
-        mutable std::mutex m_mutex;
         std::atomic<bool> m_running{ false };
         bool m_internalMode{ false };
         RotaryTableControl m_control{};
@@ -102,5 +128,6 @@ namespace core::sim
         double m_targetAngleDeg{ 0.0 };
         double m_loadTimerSeconds{ 0.0 };
         bool m_hasPart{ false };
+        SimulatorStrand<View> m_strand;
     };
 }
\ No newline at end of file
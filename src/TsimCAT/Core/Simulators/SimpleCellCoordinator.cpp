@@ -17,6 +17,7 @@ namespace core::sim
                                                  std::string laserSensorSymbol)
       : m_config(std::move(config))
       , m_link(std::move(link))
+      , m_localAds(dynamic_cast<link::symbolic::LocalAdsLink*>(m_link.get()))
       , m_rotaryTable(std::move(rotaryTable))
       , m_robot(std::move(robot))
       , m_exitConveyor(std::move(exitConveyor))
@@ -25,6 +26,21 @@ namespace core::sim
       , m_exitRunSymbol(std::move(exitRunSymbol))
       , m_laserSensorSymbol(std::move(laserSensorSymbol))
     {
+        if (!m_localAds) {
+            return;
+        }
+        m_localSymbols.robotControl = m_localAds->registerSymbol<RobotControl>(m_robotSymbols.controlSymbol);
+        m_localSymbols.robotStatus = m_localAds->registerSymbol<RobotStatus>(m_robotSymbols.statusSymbol);
+        m_localSymbols.rotaryControl =
+          m_localAds->registerSymbol<RotaryTableControl>(m_rotarySymbols.controlSymbol);
+        m_localSymbols.rotaryStatus =
+          m_localAds->registerSymbol<RotaryTableStatus>(m_rotarySymbols.statusSymbol);
+        if (!m_exitRunSymbol.empty()) {
+            m_localSymbols.exitRun = m_localAds->registerSymbol<bool>(m_exitRunSymbol);
+        }
+        if (!m_laserSensorSymbol.empty()) {
+            m_localSymbols.laserSensor = m_localAds->registerSymbol<bool>(m_laserSensorSymbol);
+        }
     }
 
     auto SimpleCellCoordinator::reset() -> void
@@ -47,16 +63,15 @@ namespace core::sim
         }
 
         // Reset ADS control commands
-        auto* localAds = dynamic_cast<link::symbolic::LocalAdsLink*>(m_link.get());
-        if (localAds) {
+        if (m_localAds) {
             RobotControl robotCtrl{};
-            localAds->writeSync(m_robotSymbols.controlSymbol, robotCtrl);
+            m_localAds->writeSync(m_localSymbols.robotControl, robotCtrl);
 
             RotaryTableControl rotaryCtrl{};
-            localAds->writeSync(m_rotarySymbols.controlSymbol, rotaryCtrl);
+            m_localAds->writeSync(m_localSymbols.rotaryControl, rotaryCtrl);
 
-            if (!m_laserSensorSymbol.empty()) {
-                localAds->writeSync(m_laserSensorSymbol, false);
+            if (m_localSymbols.laserSensor) {
+                m_localAds->writeSync(m_localSymbols.laserSensor, false);
             }
         }
 
@@ -72,22 +87,24 @@ namespace core::sim
             return;
         }
 
-        auto* localAds = dynamic_cast<link::symbolic::LocalAdsLink*>(m_link.get());
-        if (!localAds || !m_rotaryTable || !m_robot || !m_exitConveyor) {
+        if (!m_localAds || !m_rotaryTable || !m_robot || !m_exitConveyor) {
             return;
         }
 
+        // Sensor and command writes of one pass reach the PLC side as one consistent update.
+        const link::symbolic::ScopedCycle cycle{ m_localAds };
+
         if (m_conveyorSimulationEnabled) {
             ensureExitConveyorRunning();
         }
 
         // Write laser part sensor to ADS
-        if (!m_laserSensorSymbol.empty()) {
-            localAds->writeSync(m_laserSensorSymbol, m_laserStationHasPart);
+        if (m_localSymbols.laserSensor) {
+            m_localAds->writeSync(m_localSymbols.laserSensor, m_laserStationHasPart);
         }
 
-        const auto robotStatus = localAds->readSync<RobotStatus>(m_robotSymbols.statusSymbol);
-        const auto rotaryStatus = localAds->readSync<RotaryTableStatus>(m_rotarySymbols.statusSymbol);
+        const auto robotStatus = m_localAds->readSync<RobotStatus>(m_localSymbols.robotStatus);
+        const auto rotaryStatus = m_localAds->readSync<RotaryTableStatus>(m_localSymbols.rotaryStatus);
         const bool inMotion = robotStatus.bInMotion != 0;
         const bool exitPlaceOccupied = m_exitConveyor->sensorBlocked(0);
 
@@ -261,16 +278,15 @@ namespace core::sim
 
     auto SimpleCellCoordinator::dispatchRobotJob(uint16_t jobId) -> void
     {
-        auto* localAds = dynamic_cast<link::symbolic::LocalAdsLink*>(m_link.get());
-        if (!localAds) {
+        if (!m_localAds) {
             return;
         }
 
-        auto control = localAds->readSync<RobotControl>(m_robotSymbols.controlSymbol);
+        auto control = m_localAds->readSync<RobotControl>(m_localSymbols.robotControl);
         control.nJobId = jobId;
         control.bMoveEnable = 1;
         control.bReset = 0;
-        localAds->writeSync(m_robotSymbols.controlSymbol, control);
+        m_localAds->writeSync(m_localSymbols.robotControl, control);
         logger::TraceLogger::instance().emit(logger::TraceCategory::Flow,
                                              "coordinator",
                                              "dispatch_robot_job",
@@ -279,8 +295,7 @@ namespace core::sim
 
     auto SimpleCellCoordinator::requestRotaryLoad() -> void
     {
-        auto* localAds = dynamic_cast<link::symbolic::LocalAdsLink*>(m_link.get());
-        if (!localAds) {
+        if (!m_localAds) {
             return;
         }
 
@@ -288,29 +303,27 @@ namespace core::sim
         control.bEnable = 1;
         control.bLoadPart = 1;
         control.bIndex = 0;
-        localAds->writeSync(m_rotarySymbols.controlSymbol, control);
+        m_localAds->writeSync(m_localSymbols.rotaryControl, control);
     }
 
     auto SimpleCellCoordinator::requestRotaryIndex() -> void
     {
-        auto* localAds = dynamic_cast<link::symbolic::LocalAdsLink*>(m_link.get());
-        if (!localAds) {
+        if (!m_localAds) {
             return;
         }
 
         RotaryTableControl control{};
         control.bEnable = 1;
         control.bIndex = 1;
-        localAds->writeSync(m_rotarySymbols.controlSymbol, control);
+        m_localAds->writeSync(m_localSymbols.rotaryControl, control);
     }
 
     auto SimpleCellCoordinator::ensureExitConveyorRunning() -> void
     {
-        auto* localAds = dynamic_cast<link::symbolic::LocalAdsLink*>(m_link.get());
-        if (!localAds || m_exitRunSymbol.empty()) {
+        if (!m_localAds || !m_localSymbols.exitRun) {
             return;
         }
 
-        localAds->writeSync(m_exitRunSymbol, true);
+        m_localAds->writeSync(m_localSymbols.exitRun, true);
     }
 }
\ No newline at end of file
@@ -32,6 +32,8 @@ namespace core::sim
                               std::string laserSensorSymbol = "MAIN.bLaserPartPresent");
 
         auto update(double deltaTimeSeconds) -> void;
+        // Queues the simulators' reset on their strands; their getters may report the old state until
+        // those commands have run.
         auto reset() -> void;
         auto laserStationHasPart() const -> bool { return m_laserStationHasPart; }
         auto setEnabled(bool enabled) -> void { m_config.enabled = enabled; }
@@ -64,8 +66,20 @@ namespace core::sim
         auto requestRotaryIndex() -> void;
         auto ensureExitConveyorRunning() -> void;
 
+        // Process-image handles, resolved once when the link is in-process.
+        struct LocalSymbols
+        {
+            link::symbolic::SymbolHandle robotControl{};
+            link::symbolic::SymbolHandle robotStatus{};
+            link::symbolic::SymbolHandle rotaryControl{};
+            link::symbolic::SymbolHandle rotaryStatus{};
+            link::symbolic::SymbolHandle exitRun{};
+            link::symbolic::SymbolHandle laserSensor{};
+        };
+
         Config m_config;
         std::shared_ptr<link::ILink> m_link;
+        link::symbolic::LocalAdsLink* m_localAds{ nullptr };
         std::shared_ptr<RotaryTableSimulator> m_rotaryTable;
         std::shared_ptr<RobotSimulator> m_robot;
         std::shared_ptr<ConveyorSimulator> m_exitConveyor;
@@ -73,6 +87,7 @@ namespace core::sim
         RotaryTableSimulator::AdsSymbols m_rotarySymbols;
         std::string m_exitRunSymbol;
         std::string m_laserSensorSymbol;
+        LocalSymbols m_localSymbols{};
         FlowState m_state{ FlowState::WaitTableReady };
         bool m_tableSimulationEnabled{ true };
         bool m_robotSimulationEnabled{ true };
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "Coroutines/Strand.hpp"
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <utility>
+
+namespace core::sim
+{
+    /**
+     * Serializes a simulator on its own coro::Strand. Once bound, update(), the comm coroutine and the
+     * commands issued by the UI or the cell coordinator run on the strand one at a time, so simulator
+     * state needs no lock; other threads read the View the simulator publishes.
+     *
+     * Each tick publishes once; commands only mark the view stale, and a burst of them is republished
+     * once after the commands already queued. Commands are fire-and-forget, so while bound every getter
+     * is eventually consistent: one called right after a setter, or after the cell coordinator's
+     * reset(), may still return the state from before it.
+     *
+     * Until bind() is called commands run inline on the calling thread and republish at once, which
+     * keeps single-threaded callers such as the tests synchronous.
+     */
+    template<typename View>
+    class SimulatorStrand
+    {
+      public:
+        // Call once, before the simulator is shared with other threads.
+        auto bind(coro::IExecutor& executor) -> void { m_strand.emplace(executor); }
+
+        auto executor() -> coro::IExecutor* { return m_strand ? &*m_strand : nullptr; }
+
+        auto execute(std::function<void()> command) -> void
+        {
+            if (m_strand) {
+                m_strand->post(std::move(command));
+            }
+            else {
+                command();
+            }
+        }
+
+        auto publish(View view) -> void
+        {
+            m_stale = false;
+            m_view.store(std::make_shared<const View>(std::move(view)), std::memory_order_release);
+        }
+
+        // Called from a command after it changed state; `republish` builds and publishes the view.
+        template<typename Republish>
+        auto changed(Republish republish) -> void
+        {
+            if (!m_strand) {
+                republish();
+                return;
+            }
+            if (std::exchange(m_stale, true)) {
+                return;
+            }
+            m_strand->post([this, republish]() mutable {
+                // A tick in between has already published the change.
+                if (m_stale) {
+                    republish();
+                }
+            });
+        }
+
+        auto view() const -> std::shared_ptr<const View> { return m_view.load(std::memory_order_acquire); }
+
+      private:
+        std::optional<coro::Strand> m_strand{};
+        bool m_stale{ false }; // only touched on the strand
+        std::atomic<std::shared_ptr<const View>> m_view{ std::make_shared<const View>() };
+    };
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <thread>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#endif
+
+namespace core::utils::cpu
+{
+    // One round of a spin-wait: tells the core to ease off so the thread we wait for gets to run.
+    inline auto relax() -> void
+    {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+        _mm_pause();
+#elif defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#else
+        std::this_thread::yield();
+#endif
+    }
+}
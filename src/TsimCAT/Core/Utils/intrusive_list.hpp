@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstddef>
+
+namespace core::utils::list
+{
+    /**
+     * Doubly linked list threaded through nodes that live elsewhere (typically inside awaiters on a
+     * coroutine frame), so linking and unlinking never allocate. Node must expose `prev` and `next`
+     * pointers. Not synchronized.
+     */
+    template<typename Node>
+    class IntrusiveList
+    {
+      public:
+        auto empty() const -> bool { return m_head == nullptr; }
+        auto size() const -> size_t { return m_size; }
+
+        auto pushBack(Node* node) -> void
+        {
+            node->prev = m_tail;
+            node->next = nullptr;
+            if (m_tail) {
+                m_tail->next = node;
+            }
+            else {
+                m_head = node;
+            }
+            m_tail = node;
+            ++m_size;
+        }
+
+        auto remove(Node* node) -> void
+        {
+            if (node->prev) {
+                node->prev->next = node->next;
+            }
+            else {
+                m_head = node->next;
+            }
+            if (node->next) {
+                node->next->prev = node->prev;
+            }
+            else {
+                m_tail = node->prev;
+            }
+            node->prev = nullptr;
+            node->next = nullptr;
+            --m_size;
+        }
+
+        auto popFront() -> Node*
+        {
+            auto* node{ m_head };
+            if (node) {
+                remove(node);
+            }
+            return node;
+        }
+
+        // Detaches every node at once; the caller walks the returned chain through `next`.
+        auto takeAll() -> Node*
+        {
+            auto* head{ m_head };
+            m_head = nullptr;
+            m_tail = nullptr;
+            m_size = 0;
+            return head;
+        }
+
+      private:
+        Node* m_head{ nullptr };
+        Node* m_tail{ nullptr };
+        size_t m_size{ 0 };
+    };
+}
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <optional>
+
+namespace core::utils::queue
+{
+    /**
+     * Bounded lock-free multi-producer/multi-consumer ring (Vyukov). Every cell carries a sequence
+     * number, so producers and consumers only contend on their own position counter.
+     * Capacity is rounded up to the next power of two.
+     */
+    template<typename T>
+    class MpmcQueue
+    {
+      public:
+        using value_type = T;
+
+        explicit MpmcQueue(size_t capacity)
+          : m_mask{ std::bit_ceil(std::max<size_t>(capacity, 2)) - 1 }
+          , m_cells{ std::make_unique<Cell[]>(m_mask + 1) }
+        {
+            for (size_t i = 0; i <= m_mask; ++i) {
+                m_cells[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        MpmcQueue(const MpmcQueue&) = delete;
+        MpmcQueue& operator=(const MpmcQueue&) = delete;
+
+        auto tryPush(T value) -> bool
+        {
+            auto pos{ m_enqueuePos.load(std::memory_order_relaxed) };
+            while (true) {
+                auto& cell{ m_cells[pos & m_mask] };
+                const auto sequence{ cell.sequence.load(std::memory_order_acquire) };
+                const auto diff{ static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos) };
+
+                if (diff == 0) {
+                    if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                        cell.value = std::move(value);
+                        cell.sequence.store(pos + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (diff < 0) {
+                    return false; // full
+                }
+                else {
+                    pos = m_enqueuePos.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        auto tryPop() -> std::optional<T>
+        {
+            auto pos{ m_dequeuePos.load(std::memory_order_relaxed) };
+            while (true) {
+                auto& cell{ m_cells[pos & m_mask] };
+                const auto sequence{ cell.sequence.load(std::memory_order_acquire) };
+                const auto diff{ static_cast<std::ptrdiff_t>(sequence) -
+                                 static_cast<std::ptrdiff_t>(pos + 1) };
+
+                if (diff == 0) {
+                    if (m_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                        auto value{ std::move(cell.value) };
+                        cell.sequence.store(pos + m_mask + 1, std::memory_order_release);
+                        return value;
+                    }
+                }
+                else if (diff < 0) {
+                    return std::nullopt; // empty
+                }
+                else {
+                    pos = m_dequeuePos.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        // Snapshot only; may be stale by the time the caller looks at it.
+        auto sizeApprox() const -> size_t
+        {
+            const auto enqueued{ m_enqueuePos.load(std::memory_order_acquire) };
+            const auto dequeued{ m_dequeuePos.load(std::memory_order_acquire) };
+            return enqueued > dequeued ? enqueued - dequeued : 0;
+        }
+
+        auto empty() const -> bool { return sizeApprox() == 0; }
+        auto capacity() const -> size_t { return m_mask + 1; }
+
+      private:
+        static constexpr size_t CACHE_LINE{ 64 };
+
+        struct Cell
+        {
+            std::atomic<size_t> sequence{ 0 };
+            T value{};
+        };
+
+        const size_t m_mask;
+        std::unique_ptr<Cell[]> m_cells;
+        alignas(CACHE_LINE) std::atomic<size_t> m_enqueuePos{ 0 };
+        alignas(CACHE_LINE) std::atomic<size_t> m_dequeuePos{ 0 };
+    };
+}
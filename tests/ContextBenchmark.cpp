@@ -0,0 +1,185 @@
+// Compares the lock-free coro::Context against the previous mutex + deque + condition_variable
+// run queue. Not part of ctest; run the context_benchmark target manually (Release build).
+
+#include "Coroutines/coroutine.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace core;
+using namespace std::chrono_literals;
+
+namespace
+{
+    // The run queue as it was before the lock-free rewrite, timers omitted.
+    class MutexContext : public coro::IExecutor
+    {
+      public:
+        auto run() -> void override
+        {
+            while (true) {
+                std::unique_lock lock(m_mutex);
+                m_cv.wait(lock, [this] { return !m_queue.empty() || !m_running; });
+                if (!m_running && m_queue.empty()) {
+                    break;
+                }
+                while (auto handle{ utils::queue::pop(m_queue) }) {
+                    lock.unlock();
+                    if (handle && !handle->done()) {
+                        handle->resume();
+                    }
+                    lock.lock();
+                }
+            }
+        }
+
+        auto stop() -> void override
+        {
+            m_running = false;
+            m_cv.notify_all();
+        }
+
+        auto schedule(std::coroutine_handle<> handle) -> void override
+        {
+            utils::queue::push(m_queue, handle, m_mutex);
+            m_cv.notify_one();
+        }
+
+        auto getLifeToken() -> std::weak_ptr<void> override { return m_lifeToken; }
+
+      private:
+        std::atomic<bool> m_running{ true };
+        std::mutex m_mutex{};
+        std::condition_variable m_cv{};
+        std::deque<std::coroutine_handle<>> m_queue{};
+        std::shared_ptr<bool> m_lifeToken{ std::make_shared<bool>(true) };
+    };
+
+    struct Reschedule
+    {
+        auto await_ready() -> bool { return false; }
+        template<typename P>
+        auto await_suspend(std::coroutine_handle<P> handle) -> void
+        {
+            handle.promise().executor->schedule(handle);
+        }
+        auto await_resume() -> void {}
+    };
+
+    // Parks the awaiting coroutine until a foreign thread hands it back via executor->schedule(),
+    // the way ADS notification callbacks and asio completions do.
+    struct ExternalWake
+    {
+        std::atomic<std::coroutine_handle<>>& slot;
+
+        auto await_ready() -> bool { return false; }
+        auto await_suspend(std::coroutine_handle<> handle) -> void
+        {
+            slot.store(handle, std::memory_order_release);
+        }
+        auto await_resume() -> void {}
+    };
+
+    using Nanos = std::chrono::nanoseconds;
+
+    // Many coroutines re-queueing themselves on the executor thread.
+    template<typename Ctx>
+    auto measureThroughput(int coroutines, int iterations) -> double
+    {
+        Ctx context;
+        std::atomic<int> remaining{ coroutines };
+
+        for (int i = 0; i < coroutines; ++i) {
+            coro::co_spawn(context, [&](Ctx& ctx) -> coro::Task<void> {
+                for (int step = 0; step < iterations; ++step) {
+                    co_await Reschedule{};
+                }
+                if (--remaining == 0) {
+                    ctx.stop();
+                }
+            });
+        }
+
+        const auto start{ std::chrono::steady_clock::now() };
+        context.run();
+        const auto elapsed{ std::chrono::steady_clock::now() - start };
+
+        const auto resumes{ static_cast<double>(coroutines) * iterations };
+        return resumes / std::chrono::duration<double>(elapsed).count();
+    }
+
+    struct Latency
+    {
+        Nanos median{};
+        Nanos p99{};
+    };
+
+    // One coroutine ping-pongs with a producer thread; each round measures the time from
+    // schedule() on the producer to the coroutine running on the executor.
+    template<typename Ctx>
+    auto measureLatency(int rounds) -> Latency
+    {
+        Ctx context;
+        std::atomic<std::coroutine_handle<>> slot{};
+        std::atomic<int64_t> scheduledAt{ 0 };
+        std::vector<Nanos> samples;
+        samples.reserve(rounds);
+
+        coro::co_spawn(context, [&](Ctx& ctx) -> coro::Task<void> {
+            for (int round = 0; round < rounds; ++round) {
+                co_await ExternalWake{ slot };
+                const auto now{ std::chrono::steady_clock::now().time_since_epoch().count() };
+                samples.push_back(Nanos{ now - scheduledAt.load(std::memory_order_acquire) });
+            }
+            ctx.stop();
+        });
+
+        std::jthread producer{ [&](std::stop_token token) {
+            for (int round = 0; round < rounds && !token.stop_requested(); ++round) {
+                std::coroutine_handle<> handle{};
+                while (!(handle = slot.exchange({}, std::memory_order_acq_rel))) {
+                    std::this_thread::yield();
+                }
+                // Give the executor time to go idle so both spinning and parking paths are hit.
+                if (round % 2 == 0) {
+                    std::this_thread::sleep_for(50us);
+                }
+                scheduledAt.store(std::chrono::steady_clock::now().time_since_epoch().count(),
+                                  std::memory_order_release);
+                context.schedule(handle);
+            }
+        } };
+
+        context.run();
+        producer.request_stop();
+        producer.join();
+
+        std::ranges::sort(samples);
+        return { samples[samples.size() / 2], samples[samples.size() * 99 / 100] };
+    }
+
+    template<typename Ctx>
+    auto report(const char* name) -> void
+    {
+        const auto throughput{ measureThroughput<Ctx>(64, 20'000) };
+        const auto latency{ measureLatency<Ctx>(20'000) };
+        std::printf("%-14s %12.0f resumes/s   latency median %7lld ns   p99 %8lld ns\n",
+                    name,
+                    throughput,
+                    static_cast<long long>(latency.median.count()),
+                    static_cast<long long>(latency.p99.count()));
+    }
+}
+
+int main()
+{
+    report<MutexContext>("mutex/deque");
+    report<coro::Context>("lock-free");
+    return 0;
+}
@@ -0,0 +1,1473 @@
+#include <gtest/gtest.h>
+
+#include "Coroutines/coroutine.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace core;
+using namespace std::chrono_literals;
+
+// ============================================================
+// Helpers
+// ============================================================
+
+namespace
+{
+    // Re-queues the awaiting coroutine on the executor it was spawned on.
+    struct Reschedule
+    {
+        auto await_ready() -> bool { return false; }
+        template<typename P>
+        auto await_suspend(std::coroutine_handle<P> handle) -> void
+        {
+            handle.promise().executor->schedule(handle);
+        }
+        auto await_resume() -> void {}
+    };
+
+    // Reports the executor the awaiting coroutine is bound to without suspending.
+    struct CurrentExecutor
+    {
+        coro::IExecutor* executor{ nullptr };
+
+        auto await_ready() -> bool { return false; }
+        template<typename P>
+        auto await_suspend(std::coroutine_handle<P> handle) -> bool
+        {
+            executor = handle.promise().executor;
+            return false;
+        }
+        auto await_resume() -> coro::IExecutor* { return executor; }
+    };
+
+    // Reports the scheduling class of the awaiting coroutine without suspending.
+    struct CurrentPriority
+    {
+        coro::Priority priority{ coro::Priority::Normal };
+
+        auto await_ready() -> bool { return false; }
+        template<typename P>
+        auto await_suspend(std::coroutine_handle<P> handle) -> bool
+        {
+            priority = coro::detail::priorityOf(handle);
+            return false;
+        }
+        auto await_resume() -> coro::Priority { return priority; }
+    };
+
+    template<typename Predicate>
+    auto waitFor(Predicate&& predicate, std::chrono::milliseconds timeout = 2000ms) -> bool
+    {
+        const auto deadline{ std::chrono::steady_clock::now() + timeout };
+        while (!predicate()) {
+            if (std::chrono::steady_clock::now() > deadline) {
+                return false;
+            }
+            std::this_thread::sleep_for(1ms);
+        }
+        return true;
+    }
+}
+
+// ============================================================
+// Context Tests
+// ============================================================
+
+TEST(ContextTest, OverflowBeyondRingCapacityKeepsAllHandles)
+{
+    coro::Context context{ 4 };
+    std::atomic<int> completed{ 0 };
+
+    for (int i = 0; i < 64; ++i) {
+        coro::co_spawn(context, [&](coro::Context&) -> coro::Task<void> {
+            for (int step = 0; step < 10; ++step) {
+                co_await Reschedule{};
+            }
+            ++completed;
+        });
+    }
+
+    std::jthread runner{ [&] { context.run(); } };
+    EXPECT_TRUE(waitFor([&] { return completed == 64; }));
+    context.stop();
+    runner.join();
+}
+
+TEST(ContextTest, SpilledHandlesAreNotOvertakenByLaterOnes)
+{
+    constexpr int TASKS{ 8 };
+    constexpr int STEPS{ 3 };
+    coro::Context context{ 4 };
+    std::vector<int> steps;
+    int running{ TASKS };
+
+    // Half the tasks spill; the others requeue themselves while the spilled ones are still waiting.
+    for (int i = 0; i < TASKS; ++i) {
+        coro::co_spawn(context, [&, i](coro::Context& ctx) -> coro::Task<void> {
+            for (int step = 0; step < STEPS; ++step) {
+                steps.push_back(step * TASKS + i);
+                co_await Reschedule{};
+            }
+            if (--running == 0) {
+                ctx.stop();
+            }
+        });
+    }
+    context.run();
+
+    // Round-robin: every task takes its n-th step before any takes its (n+1)-th.
+    std::vector<int> expected(TASKS * STEPS);
+    std::iota(expected.begin(), expected.end(), 0);
+    EXPECT_EQ(steps, expected);
+}
+
+TEST(ContextTest, WakesForHandlesScheduledFromForeignThreads)
+{
+    coro::Context context;
+    std::jthread runner{ [&] { context.run(); } };
+    const auto contextThread{ runner.get_id() };
+    std::atomic<int> resumedOnContext{ 0 };
+
+    std::vector<std::jthread> producers;
+    for (int i = 0; i < 4; ++i) {
+        producers.emplace_back([&] {
+            for (int n = 0; n < 50; ++n) {
+                // Let the run loop park between handles so the wake-up path is exercised.
+                std::this_thread::sleep_for(100us);
+                coro::co_spawn(context, [&](coro::Context&) -> coro::Task<void> {
+                    resumedOnContext += std::this_thread::get_id() == contextThread;
+                    co_return;
+                });
+            }
+        });
+    }
+    producers.clear();
+
+    EXPECT_TRUE(waitFor([&] { return resumedOnContext == 200; }));
+    context.stop();
+    runner.join();
+}
+
+// ============================================================
+// FrameAllocator Tests
+// ============================================================
+
+TEST(FrameAllocatorTest, ReusesFramesOfTheSameSizeClass)
+{
+    auto* first{ coro::FrameAllocator::allocate(200) };
+    coro::FrameAllocator::deallocate(first);
+
+    const auto before{ coro::FrameAllocator::stats() };
+    auto* second{ coro::FrameAllocator::allocate(190) };
+    const auto after{ coro::FrameAllocator::stats() };
+    coro::FrameAllocator::deallocate(second);
+
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(after.heapAllocations, before.heapAllocations);
+}
+
+TEST(FrameAllocatorTest, FramesFreedOnOtherThreadsReturnToTheirOwner)
+{
+    auto* frame{ coro::FrameAllocator::allocate(1000) };
+    const auto before{ coro::FrameAllocator::stats() };
+
+    std::jthread{ [frame] { coro::FrameAllocator::deallocate(frame); } }.join();
+
+    const auto afterFree{ coro::FrameAllocator::stats() };
+    auto* reused{ coro::FrameAllocator::allocate(1000) };
+    const auto afterReuse{ coro::FrameAllocator::stats() };
+    coro::FrameAllocator::deallocate(reused);
+
+    EXPECT_EQ(afterFree.remoteFrees, before.remoteFrees + 1);
+    EXPECT_EQ(reused, frame);
+    EXPECT_EQ(afterReuse.heapAllocations, afterFree.heapAllocations);
+}
+
+// ============================================================
+// ThreadPool Tests
+// ============================================================
+
+TEST(ThreadPoolTest, RunsSpawnedCoroutinesToCompletion)
+{
+    coro::ThreadPool pool{ 4 };
+    std::atomic<int> completed{ 0 };
+
+    for (int i = 0; i < 64; ++i) {
+        coro::co_spawn(pool, [&](coro::ThreadPool&) -> coro::Task<void> {
+            for (int step = 0; step < 10; ++step) {
+                co_await Reschedule{};
+            }
+            ++completed;
+        });
+    }
+
+    std::jthread runner{ [&] { pool.run(); } };
+    EXPECT_TRUE(waitFor([&] { return completed == 64; }));
+
+    pool.stop();
+    runner.join();
+    EXPECT_EQ(completed, 64);
+}
+
+TEST(ThreadPoolTest, SpreadsBlockingWorkAcrossWorkers)
+{
+    coro::ThreadPool pool{ 4 };
+    std::mutex mutex;
+    std::set<std::thread::id> threads;
+    std::atomic<int> completed{ 0 };
+
+    std::jthread runner{ [&] { pool.run(); } };
+
+    for (int i = 0; i < 16; ++i) {
+        coro::co_spawn(pool, [&](coro::ThreadPool&) -> coro::Task<void> {
+            std::this_thread::sleep_for(2ms);
+            {
+                std::scoped_lock lock(mutex);
+                threads.insert(std::this_thread::get_id());
+            }
+            ++completed;
+            co_return;
+        });
+    }
+
+    EXPECT_TRUE(waitFor([&] { return completed == 16; }));
+    pool.stop();
+    runner.join();
+
+    EXPECT_GT(threads.size(), 1u);
+}
+
+TEST(ThreadPoolTest, ChildTasksInheritExecutor)
+{
+    coro::ThreadPool pool{ 2 };
+    std::atomic<coro::IExecutor*> observed{ nullptr };
+
+    auto child = []() -> coro::Task<coro::IExecutor*> { co_return co_await CurrentExecutor{}; };
+
+    coro::co_spawn(pool, [&](coro::ThreadPool&) -> coro::Task<void> { observed = co_await child(); });
+
+    std::jthread runner{ [&] { pool.run(); } };
+    EXPECT_TRUE(waitFor([&] { return observed.load() != nullptr; }));
+    pool.stop();
+    runner.join();
+
+    EXPECT_EQ(observed.load(), &pool);
+}
+
+TEST(ThreadPoolTest, LifeTokenExpiresWithPool)
+{
+    std::weak_ptr<void> token;
+    {
+        coro::ThreadPool pool{ 1 };
+        token = pool.getLifeToken();
+        EXPECT_FALSE(token.expired());
+    }
+    EXPECT_TRUE(token.expired());
+}
+
+// ============================================================
+// Timer Tests
+// ============================================================
+
+TEST(TimerTest, SleepResumesOnOwningContextThread)
+{
+    coro::Context context;
+    std::jthread runner{ [&] { context.run(); } };
+    const auto contextThread{ runner.get_id() };
+
+    std::atomic<bool> sameThread{ false };
+    std::atomic<bool> done{ false };
+    const auto start{ std::chrono::steady_clock::now() };
+    std::atomic<int64_t> elapsedMs{ 0 };
+
+    coro::co_spawn(context, [&](coro::Context&) -> coro::Task<void> {
+        co_await coro::sleep(20ms);
+        sameThread = std::this_thread::get_id() == contextThread;
+        elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+                      std::chrono::steady_clock::now() - start)
+                      .count();
+        done = true;
+    });
+
+    EXPECT_TRUE(waitFor([&] { return done.load(); }));
+    context.stop();
+    runner.join();
+
+    EXPECT_TRUE(sameThread);
+    EXPECT_GE(elapsedMs, 20);
+}
+
+TEST(TimerTest, SleepersWakeInDeadlineOrder)
+{
+    coro::Context context;
+    std::mutex mutex;
+    std::vector<int> order;
+
+    for (int delay : { 30, 10, 20 }) {
+        coro::co_spawn(context, [&, delay](coro::Context&) -> coro::Task<void> {
+            co_await coro::sleep(std::chrono::milliseconds(delay));
+            std::scoped_lock lock(mutex);
+            order.push_back(delay);
+        });
+    }
+
+    std::jthread runner{ [&] { context.run(); } };
+    EXPECT_TRUE(waitFor([&] {
+        std::scoped_lock lock(mutex);
+        return order.size() == 3;
+    }));
+    context.stop();
+    runner.join();
+
+    EXPECT_EQ(order, (std::vector<int>{ 10, 20, 30 }));
+}
+
+TEST(TimerTest, SleepWithoutExecutorUsesTimerService)
+{
+    std::atomic<bool> done{ false };
+    auto body = [&]() -> coro::DetachedTask {
+        co_await coro::sleep_until(coro::Clock::now() + 5ms);
+        done = true;
+    };
+    body().getHandle().resume();
+
+    EXPECT_TRUE(waitFor([&] { return done.load(); }));
+}
+
+TEST(TimerTest, CancelledTimerDoesNotFire)
+{
+    coro::detail::TimerQueue timers;
+    const auto now{ coro::Clock::now() };
+    const auto first{ timers.add(now, {}) };
+    const auto second{ timers.add(now + 1ms, {}) };
+
+    EXPECT_TRUE(timers.cancel(first));
+    EXPECT_FALSE(timers.cancel(first));
+
+    EXPECT_FALSE(timers.popExpired(now).has_value());
+    auto entry{ timers.popExpired(now + 1ms) };
+    ASSERT_TRUE(entry.has_value());
+    EXPECT_EQ(entry->id, second);
+    EXPECT_TRUE(timers.empty());
+}
+
+// ============================================================
+// BlockingPool / runAsync Tests
+// ============================================================
+
+TEST(RunAsyncTest, ResumesOnAwaitingExecutor)
+{
+    coro::Context context;
+    std::jthread runner{ [&] { context.run(); } };
+    const auto contextThread{ runner.get_id() };
+
+    std::atomic<bool> ranOnPool{ false };
+    std::atomic<bool> resumedOnContext{ false };
+    std::atomic<int> value{ 0 };
+
+    coro::co_spawn(context, [&](coro::Context&) -> coro::Task<void> {
+        value = co_await coro::runAsync<int>([&] {
+            ranOnPool = std::this_thread::get_id() != contextThread;
+            return 42;
+        });
+        resumedOnContext = std::this_thread::get_id() == contextThread;
+    });
+
+    EXPECT_TRUE(waitFor([&] { return value == 42; }));
+    context.stop();
+    runner.join();
+
+    EXPECT_TRUE(ranOnPool);
+    EXPECT_TRUE(resumedOnContext);
+}
+
+TEST(RunAsyncTest, PropagatesExceptions)
+{
+    coro::Context context;
+    std::atomic<bool> caught{ false };
+
+    coro::co_spawn(context, [&](coro::Context&) -> coro::Task<void> {
+        try {
+            co_await coro::runAsync<void>([] { throw std::runtime_error("driver failure"); });
+        } catch (const std::runtime_error&) {
+            caught = true;
+        }
+    });
+
+    std::jthread runner{ [&] { context.run(); } };
+    EXPECT_TRUE(waitFor([&] { return caught.load(); }));
+    context.stop();
+}
+
+TEST(RunAsyncTest, BoundedPoolNeverExceedsItsThreads)
+{
+    coro::BlockingPool pool{ 2, 2 };
+    coro::Context context;
+    std::mutex mutex;
+    std::set<std::thread::id> threads;
+    std::atomic<int> completed{ 0 };
+
+    for (int i = 0; i < 16; ++i) {
+        coro::co_spawn(context, [&](coro::Context&) -> coro::Task<void> {
+            co_await coro::runAsync<void>(
+              [&] {
+                  std::this_thread::sleep_for(1ms);
+                  std::scoped_lock lock(mutex);
+                  threads.insert(std::this_thread::get_id());
+              },
+              pool);
+            ++completed;
+        });
+    }
+
+    std::jthread runner{ [&] { context.run(); } };
+    EXPECT_TRUE(waitFor([&] { return completed == 16; }));
+    context.stop();
+    runner.join();
+
+    EXPECT_LE(threads.size(), pool.threadCount());
+}
+
+TEST(RunAsyncTest, FullPoolParksSubmittersWithoutBlockingTheExecutor)
+{
+    coro::BlockingPool pool{ 1, 1 };
+    coro::Context context;
+    std::atomic<bool> gateOpen{ false };
+    std::atomic<bool> executorFree{ false };
+    std::atomic<int> completed{ 0 };
+
+    for (int i = 0; i < 4; ++i) {
+        coro::co_spawn(context, [&](coro::Context&) -> coro::Task<void> {
+            // Move-only, like a job owning a driver buffer. Named, because GCC 12 destroys a lambda
+            // temporary with init-captures twice when it is built inside the co_await operand.
+            auto job{ [&, value = std::make_unique<int>(1)] {
+                while (!gateOpen) {
+                    std::this_thread::sleep_for(1ms);
+                }
+                return *value;
+            } };
+            completed += co_await coro::runAsync<int>(std::move(job), pool);
+        });
+    }
+    coro::co_spawn(context, [&](coro::Context&) -> coro::Task<void> {
+        executorFree = true;
+        co_return;
+    });
+
+    std::jthread runner{ [&] { context.run(); } };
+    // Two submissions are parked while one job runs and one waits in the queue.
+    EXPECT_TRUE(waitFor([&] { return executorFree.load(); }));
+    gateOpen = true;
+    EXPECT_TRUE(waitFor([&] { return completed == 4; }));
+    context.stop();
+    runner.join();
+}
+
+// ============================================================
+// Channel Overflow Tests
+// ============================================================
+
+namespace
+{
+    // Drains everything currently buffered without suspending.
+    template<typename T>
+    auto drain(coro::Channel<T>& channel) -> std::vector<T>
+    {
+        channel.close();
+        std::vector<T> values;
+        auto collect = [&]() -> coro::DetachedTask {
+            while (auto value{ co_await channel.next() }) {
+                values.push_back(*value);
+            }
+        };
+        collect().getHandle().resume();
+        return values;
+    }
+}
+
+TEST(ChannelTest, DropOldestKeepsMostRecentValues)
+{
+    coro::Channel<int> channel{ { .capacity = 3, .overflow = coro::OverflowPolicy::DropOldest } };
+    for (int i = 0; i < 10; ++i) {
+        channel.push(i);
+    }
+    EXPECT_EQ(drain(channel), (std::vector<int>{ 7, 8, 9 }));
+}
+
+TEST(ChannelTest, DropNewestKeepsFirstValues)
+{
+    coro::Channel<int> channel{ { .capacity = 3, .overflow = coro::OverflowPolicy::DropNewest } };
+    for (int i = 0; i < 10; ++i) {
+        channel.push(i);
+    }
+    EXPECT_EQ(drain(channel), (std::vector<int>{ 0, 1, 2 }));
+}
+
+TEST(ChannelTest, ConflateKeepsOnlyLatestValue)
+{
+    coro::Channel<int> channel{ { .overflow = coro::OverflowPolicy::Conflate } };
+    for (int i = 0; i < 10; ++i) {
+        channel.push(i);
+    }
+    EXPECT_EQ(drain(channel), (std::vector<int>{ 9 }));
+}
+
+TEST(ChannelTest, BlockingProducerWaitsForConsumer)
+{
+    coro::Channel<int> channel{ { .capacity = 2, .overflow = coro::OverflowPolicy::Block } };
+    std::atomic<int> pushed{ 0 };
+
+    std::jthread producer{ [&] {
+        for (int i = 0; i < 5; ++i) {
+            channel.push(i);
+            ++pushed;
+        }
+    } };
+
+    EXPECT_TRUE(waitFor([&] { return pushed == 2; }));
+    std::this_thread::sleep_for(20ms);
+    EXPECT_EQ(pushed, 2);
+
+    std::vector<int> received;
+    auto consume = [&]() -> coro::DetachedTask {
+        for (int i = 0; i < 5; ++i) {
+            received.push_back(*co_await channel.next());
+        }
+    };
+    consume().getHandle().resume();
+
+    producer.join();
+    EXPECT_TRUE(waitFor([&] { return received.size() == 5; }));
+    EXPECT_EQ(received, (std::vector<int>{ 0, 1, 2, 3, 4 }));
+}
+
+TEST(ChannelTest, ValuePushedWhileTheReaderSuspendsIsDelivered)
+{
+    constexpr int VALUES{ 20000 };
+    coro::Channel<int> channel;
+    coro::ThreadPool pool{ 1 };
+    std::atomic<int> received{ 0 };
+    std::atomic<bool> endedEarly{ false };
+
+    // The reader runs on the pool while values arrive from this thread.
+    coro::co_spawn(pool, [&](coro::ThreadPool&) -> coro::Task<void> {
+        while (received < VALUES) {
+            const auto value{ co_await channel.next() };
+            if (!value) {
+                endedEarly = true;
+                co_return;
+            }
+            EXPECT_EQ(*value, received.load());
+            ++received;
+        }
+    });
+    std::jthread runner{ [&] { pool.run(); } };
+
+    // Each value is pushed as the reader comes back for it, to hit the window between the two checks.
+    for (int i = 0; i < VALUES && !endedEarly; ++i) {
+        while (received < i && !endedEarly) {
+            std::this_thread::yield();
+        }
+        channel.push(i);
+    }
+    EXPECT_TRUE(waitFor([&] { return received == VALUES || endedEarly; }));
+    EXPECT_FALSE(endedEarly);
+    EXPECT_EQ(received, VALUES);
+
+    channel.close();
+    pool.stop();
+    runner.join();
+}
+
+// ============================================================
+// RawBinaryChannel Broadcast Tests
+// ============================================================
+
+TEST(RawBinaryChannelTest, BroadcastSharesOnePayloadAcrossSubscribers)
+{
+    coro::RawBinaryChannel channel;
+    std::vector<coro::RawBinaryChannel::SharedBytes> received(3);
+
+    auto subscribe = [&](size_t index) -> coro::DetachedTask {
+        std::optional<coro::RawBinaryChannel::SharedBytes> value{};
+        auto awaiter{ channel.next(value) };
+        co_await awaiter;
+        received[index] = value.value_or(nullptr);
+    };
+    for (size_t i = 0; i < received.size(); ++i) {
+        subscribe(i).getHandle().resume();
+    }
+
+    channel.push(coro::RawBinaryChannel::Bytes{ std::byte{ 1 }, std::byte{ 2 } });
+
+    ASSERT_NE(received[0], nullptr);
+    EXPECT_EQ(received[0]->size(), 2u);
+    EXPECT_EQ(received[1].get(), received[0].get());
+    EXPECT_EQ(received[2].get(), received[0].get());
+}
+
+TEST(RawBinaryChannelTest, DestroyedWaiterLeavesTheWaiterList)
+{
+    coro::RawBinaryChannel channel;
+    coro::BinaryChannel<int32_t> typed{ channel };
+    std::optional<int32_t> received{};
+
+    {
+        auto abandoned = [&]() -> coro::Task<void> { received = co_await typed.next(); };
+        auto task{ abandoned() };
+        task.getHandle().resume();
+    }
+
+    int32_t value{ 7 };
+    channel.push(coro::RawBinaryChannel::Bytes(sizeof(value)));
+    EXPECT_FALSE(received.has_value());
+
+    auto consume = [&]() -> coro::DetachedTask { received = co_await typed.next(); };
+    consume().getHandle().resume();
+    EXPECT_EQ(received, 0);
+}
+
+// ============================================================
+// Cancellation Tests
+// ============================================================
+
+TEST(CancellationTest, StopEndsSleepAndChildTasksEarly)
+{
+    coro::Context context;
+    std::jthread runner{ [&] { context.run(); } };
+    const auto contextThread{ runner.get_id() };
+    std::stop_source source;
+    std::atomic<bool> sleeping{ false };
+    std::atomic<bool> sameThread{ false };
+    std::atomic<bool> done{ false };
+
+    auto child = [&]() -> coro::Task<void> {
+        sleeping = true;
+        co_await coro::sleep(10s);
+    };
+    coro::co_spawn(
+      context,
+      [&](coro::Context&) -> coro::Task<void> {
+          co_await child();
+          sameThread = std::this_thread::get_id() == contextThread;
+          done = true;
+      },
+      source.get_token());
+
+    const auto start{ std::chrono::steady_clock::now() };
+    ASSERT_TRUE(waitFor([&] { return sleeping.load(); }));
+    source.request_stop();
+
+    EXPECT_TRUE(waitFor([&] { return done.load(); }));
+    EXPECT_LT(std::chrono::steady_clock::now() - start, 5s);
+    EXPECT_TRUE(sameThread);
+    context.stop();
+}
+
+TEST(CancellationTest, StoppedChannelReaderLeavesTheWaiterList)
+{
+    coro::Channel<int> channel;
+    std::stop_source source;
+    std::optional<std::optional<int>> first{};
+
+    auto reader = [&]() -> coro::Task<void> { first = co_await channel.next(); };
+    auto task{ reader() };
+    task.getHandle().promise().stopToken = source.get_token();
+    task.getHandle().resume();
+    ASSERT_FALSE(first.has_value());
+
+    source.request_stop();
+    ASSERT_TRUE(first.has_value());
+    EXPECT_FALSE(first->has_value());
+
+    // The withdrawn reader must not swallow the next value.
+    channel.push(5);
+    EXPECT_EQ(drain(channel), (std::vector<int>{ 5 }));
+}
+
+TEST(CancellationTest, StopBeforeSuspendSkipsTheWait)
+{
+    coro::RawBinaryChannel channel;
+    coro::BinaryChannel<int32_t> typed{ channel };
+    std::stop_source source;
+    source.request_stop();
+    bool finished{ false };
+
+    auto reader = [&]() -> coro::Task<void> {
+        EXPECT_FALSE((co_await typed.next()).has_value());
+        co_await coro::sleep(10s);
+        finished = true;
+    };
+    auto task{ reader() };
+    task.getHandle().promise().stopToken = source.get_token();
+    task.getHandle().resume();
+    EXPECT_TRUE(finished);
+}
+
+TEST(CancellationTest, WithTimeoutAbandonsBlockingCall)
+{
+    coro::Context context;
+    std::jthread runner{ [&] { context.run(); } };
+    std::atomic<bool> done{ false };
+    std::error_code error{};
+
+    auto blockingRead = []() -> coro::Task<result::Result<int>> {
+        co_return co_await coro::runAsync<result::Result<int>>([] {
+            std::this_thread::sleep_for(500ms);
+            return result::Result<int>{ 1 };
+        });
+    };
+
+    const auto start{ std::chrono::steady_clock::now() };
+    coro::co_spawn(context, [&](coro::Context&) -> coro::Task<void> {
+        auto value{ co_await coro::withTimeout(blockingRead(), 20ms) };
+        error = value ? std::error_code{} : value.error();
+        done = true;
+    });
+
+    ASSERT_TRUE(waitFor([&] { return done.load(); }));
+    EXPECT_LT(std::chrono::steady_clock::now() - start, 400ms);
+    EXPECT_EQ(error, std::errc::timed_out);
+    context.stop();
+}
+
+// ============================================================
+// whenAll / whenAny Tests
+// ============================================================
+
+namespace
+{
+    auto slowValue(int value, std::chrono::milliseconds delay) -> coro::Task<result::Result<int>>
+    {
+        co_return co_await coro::runAsync<result::Result<int>>([value, delay] {
+            std::this_thread::sleep_for(delay);
+            return result::Result<int>{ value };
+        });
+    }
+}
+
+TEST(WhenAllTest, OverlapsIndependentOperations)
+{
+    coro::Context context;
+    std::jthread runner{ [&] { context.run(); } };
+    std::atomic<bool> done{ false };
+    std::tuple<result::Result<int>, result::Result<int>, std::monostate> values{};
+    bool sameThread{ false };
+
+    auto touch = [](bool& flag) -> coro::Task<void> {
+        flag = true;
+        co_return;
+    };
+    bool touched{ false };
+
+    const auto start{ std::chrono::steady_clock::now() };
+    coro::co_spawn(context, [&](coro::Context&) -> coro::Task<void> {
+        const auto owner{ std::this_thread::get_id() };
+        values = co_await coro::whenAll(slowValue(1, 150ms), slowValue(2, 150ms), touch(touched));
+        sameThread = std::this_thread::get_id() == owner;
+        done = true;
+    });
+
+    ASSERT_TRUE(waitFor([&] { return done.load(); }));
+    EXPECT_LT(std::chrono::steady_clock::now() - start, 280ms);
+    EXPECT_EQ(std::get<0>(values), 1);
+    EXPECT_EQ(std::get<1>(values), 2);
+    EXPECT_TRUE(touched);
+    EXPECT_TRUE(sameThread);
+    context.stop();
+}
+
+TEST(WhenAllTest, RangeFormKeepsOrderAndRethrows)
+{
+    auto value = [](int v) -> coro::Task<int> { co_return v; };
+    auto failing = []() -> coro::Task<int> {
+        throw std::runtime_error("boom");
+        co_return 0;
+    };
+
+    std::vector<int> collected{};
+    bool threw{ false };
+    auto root = [&]() -> coro::Task<void> {
+        std::vector<coro::Task<int>> tasks{};
+        for (int i{ 0 }; i < 4; ++i) {
+            tasks.push_back(value(i));
+        }
+        collected = co_await coro::whenAll(std::move(tasks));
+
+        std::vector<coro::Task<int>> withFailure{};
+        withFailure.push_back(value(1));
+        withFailure.push_back(failing());
+        try {
+            (void)co_await coro::whenAll(std::move(withFailure));
+        }
+        catch (const std::runtime_error&) {
+            threw = true;
+        }
+    };
+    auto task{ root() };
+    task.getHandle().resume();
+
+    EXPECT_EQ(collected, (std::vector<int>{ 0, 1, 2, 3 }));
+    EXPECT_TRUE(threw);
+}
+
+TEST(WhenAnyTest, TimerWinsAndStopsTheSlowRead)
+{
+    coro::Context context;
+    std::jthread runner{ [&] { context.run(); } };
+    std::atomic<bool> done{ false };
+    size_t winner{ 99 };
+
+    auto timeout = [](std::chrono::milliseconds delay) -> coro::Task<void> { co_await coro::sleep(delay); };
+
+    const auto start{ std::chrono::steady_clock::now() };
+    coro::co_spawn(context, [&](coro::Context&) -> coro::Task<void> {
+        auto first{ co_await coro::whenAny(slowValue(1, 2s), timeout(20ms)) };
+        winner = first.index();
+        done = true;
+    });
+
+    ASSERT_TRUE(waitFor([&] { return done.load(); }));
+    EXPECT_LT(std::chrono::steady_clock::now() - start, 1s);
+    EXPECT_EQ(winner, 1u);
+    context.stop();
+}
+
+TEST(WhenAnyTest, RangeFormReportsTheFirstToFinish)
+{
+    coro::Context context;
+    std::jthread runner{ [&] { context.run(); } };
+    std::atomic<bool> done{ false };
+    std::pair<size_t, result::Result<int>> first{};
+
+    coro::co_spawn(context, [&](coro::Context&) -> coro::Task<void> {
+        std::vector<coro::Task<result::Result<int>>> tasks{};
+        tasks.push_back(slowValue(10, 2s));
+        tasks.push_back(slowValue(20, 10ms));
+        tasks.push_back(slowValue(30, 2s));
+        first = co_await coro::whenAny(std::move(tasks));
+        done = true;
+    });
+
+    ASSERT_TRUE(waitFor([&] { return done.load(); }));
+    EXPECT_EQ(first.first, 1u);
+    EXPECT_EQ(first.second, 20);
+    context.stop();
+}
+
+// ============================================================
+// ValueTask Tests
+// ============================================================
+
+TEST(ValueTaskTest, ReadyValueSkipsTheFrame)
+{
+    auto inlineRead = []() -> coro::ValueTask<int> { return 7; };
+    int value{ 0 };
+    auto root = [&]() -> coro::Task<void> {
+        const auto before{ coro::FrameAllocator::stats().allocations };
+        for (int i{ 0 }; i < 100; ++i) {
+            value += co_await inlineRead();
+        }
+        EXPECT_EQ(coro::FrameAllocator::stats().allocations, before);
+    };
+    auto task{ root() };
+    task.getHandle().resume();
+    EXPECT_EQ(value, 700);
+}
+
+TEST(ValueTaskTest, PendingTaskInheritsExecutor)
+{
+    coro::Context context;
+    std::jthread runner{ [&] { context.run(); } };
+    std::atomic<bool> done{ false };
+    coro::IExecutor* seen{ nullptr };
+
+    auto pendingRead = []() -> coro::ValueTask<int> {
+        co_await Reschedule{};
+        co_return 3;
+    };
+    auto probe = []() -> coro::ValueTask<coro::IExecutor*> {
+        auto* executor{ co_await CurrentExecutor{} };
+        co_return executor;
+    };
+    int value{ 0 };
+
+    coro::co_spawn(context, [&](coro::Context&) -> coro::Task<void> {
+        auto read{ pendingRead() };
+        EXPECT_FALSE(read.isReady());
+        value = co_await std::move(read);
+        seen = co_await probe();
+        done = true;
+    });
+
+    ASSERT_TRUE(waitFor([&] { return done.load(); }));
+    EXPECT_EQ(value, 3);
+    EXPECT_EQ(seen, &context);
+    context.stop();
+}
+
+// ============================================================
+// Executor Stats Tests
+// ============================================================
+
+TEST(ExecutorStatsTest, InstrumentedContextRecordsLatencyAndLongestResume)
+{
+    coro::Context context;
+    context.setInstrumented(true);
+    std::jthread runner{ [&] { context.run(); } };
+    std::atomic<bool> done{ false };
+    constexpr int HOPS{ 50 };
+
+    coro::co_spawn(context, [&](coro::Context&) -> coro::Task<void> {
+        for (int i{ 0 }; i < HOPS; ++i) {
+            co_await Reschedule{};
+        }
+        // One deliberately slow resume.
+        const auto until{ std::chrono::steady_clock::now() + 3ms };
+        while (std::chrono::steady_clock::now() < until) {
+        }
+        co_await coro::sleep(1ms);
+        done = true;
+    });
+
+    ASSERT_TRUE(waitFor([&] { return done.load(); }));
+    const auto stats{ context.stats() };
+    context.stop();
+
+    EXPECT_TRUE(stats.instrumented);
+    EXPECT_GE(stats.resumes, static_cast<uint64_t>(HOPS + 2));
+    EXPECT_GE(stats.scheduleLatency.total(), static_cast<uint64_t>(HOPS + 2));
+    EXPECT_GE(stats.longestResume, 3ms);
+    EXPECT_GE(stats.resumeDuration.max(), 3ms);
+    EXPECT_GE(stats.peakReadyDepth, 1u);
+}
+
+TEST(ExecutorStatsTest, UninstrumentedContextOnlyCounts)
+{
+    coro::Context context;
+    coro::co_spawn(context, [&](coro::Context& ctx) -> coro::Task<void> {
+        co_await Reschedule{};
+        ctx.stop();
+    });
+    context.run();
+
+    const auto stats{ context.stats() };
+    EXPECT_FALSE(stats.instrumented);
+    EXPECT_EQ(stats.resumes, 2u);
+    EXPECT_EQ(stats.scheduleLatency.total(), 0u);
+    EXPECT_EQ(stats.longestResume, 0ns);
+}
+
+TEST(ExecutorStatsTest, MonitorDeliversPeriodicSnapshots)
+{
+    coro::Context context;
+    std::atomic<int> samples{ 0 };
+    std::atomic<bool> ordered{ true };
+    {
+        coro::ExecutorMonitor monitor{ context, 5ms, [&](const auto& current, const auto& previous) {
+                                          if (current.takenAt <= previous.takenAt) {
+                                              ordered = false;
+                                          }
+                                          ++samples;
+                                      } };
+        ASSERT_TRUE(waitFor([&] { return samples.load() >= 3; }));
+    }
+    const auto afterStop{ samples.load() };
+    std::this_thread::sleep_for(20ms);
+
+    EXPECT_TRUE(ordered);
+    EXPECT_EQ(samples.load(), afterStop);
+}
+
+TEST(ExecutorStatsTest, ChannelsReportSuspendedReaders)
+{
+    coro::Channel<int> channel;
+    std::vector<coro::Task<void>> readers{};
+    for (int i{ 0 }; i < 3; ++i) {
+        readers.push_back([](coro::Channel<int>& ch) -> coro::Task<void> { (void)co_await ch.next(); }(channel));
+        readers.back().getHandle().resume();
+    }
+    EXPECT_EQ(channel.waiterCount(), 3u);
+    channel.push(1);
+    EXPECT_EQ(channel.waiterCount(), 2u);
+    channel.close();
+    EXPECT_EQ(channel.waiterCount(), 0u);
+
+    coro::RawBinaryChannel raw;
+    coro::BinaryChannel<int32_t> typed{ raw };
+    auto reader = [](coro::BinaryChannel<int32_t>& ch) -> coro::Task<void> { (void)co_await ch.next(); };
+    auto task{ reader(typed) };
+    task.getHandle().resume();
+    EXPECT_EQ(raw.waiterCount(), 1u);
+    EXPECT_EQ(typed.waiterCount(), 1u);
+    raw.close();
+    EXPECT_EQ(raw.waiterCount(), 0u);
+}
+
+// ============================================================
+// Priority Tests
+// ============================================================
+
+TEST(PriorityTest, ContextDrainsHigherClassesFirst)
+{
+    coro::Context context;
+    std::vector<coro::Priority> order{};
+    auto record = [&](coro::Priority priority) {
+        return [&order, priority](coro::Context&) -> coro::Task<void> {
+            order.push_back(priority);
+            co_return;
+        };
+    };
+
+    coro::co_spawn(context, record(coro::Priority::Background), coro::Priority::Background);
+    coro::co_spawn(context, record(coro::Priority::Normal));
+    coro::co_spawn(context, record(coro::Priority::Cyclic), coro::Priority::Cyclic);
+    coro::co_spawn(context, [](coro::Context& ctx) -> coro::Task<void> {
+        ctx.stop();
+        co_return;
+    }, coro::Priority::Background);
+    context.run();
+
+    const std::vector expected{ coro::Priority::Cyclic, coro::Priority::Normal, coro::Priority::Background };
+    EXPECT_EQ(order, expected);
+}
+
+TEST(PriorityTest, TimersWakeIntoTheLaneOfTheirCoroutine)
+{
+    coro::Context context;
+    std::vector<coro::Priority> order{};
+    const auto deadline{ coro::Clock::now() + 5ms };
+    auto sleeper = [&](coro::Priority expected) {
+        return [&order, deadline, expected](coro::Context&) -> coro::Task<void> {
+            co_await coro::sleep_until(deadline);
+            auto priority{ co_await CurrentPriority{} };
+            EXPECT_EQ(priority, expected);
+            order.push_back(priority);
+        };
+    };
+
+    coro::co_spawn(context, sleeper(coro::Priority::Background), coro::Priority::Background);
+    coro::co_spawn(context, sleeper(coro::Priority::Cyclic), coro::Priority::Cyclic);
+    coro::co_spawn(context, [](coro::Context& ctx) -> coro::Task<void> {
+        co_await coro::sleep(20ms);
+        ctx.stop();
+    });
+    context.run();
+
+    const std::vector expected{ coro::Priority::Cyclic, coro::Priority::Background };
+    EXPECT_EQ(order, expected);
+}
+
+TEST(PriorityTest, ChildTasksInheritUnlessPinned)
+{
+    coro::Context context;
+    std::jthread runner{ [&] { context.run(); } };
+    std::atomic<bool> done{ false };
+    std::vector<coro::Priority> seen{};
+
+    auto probe = []() -> coro::Task<coro::Priority> {
+        co_await coro::sleep(1ms);
+        auto priority{ co_await CurrentPriority{} };
+        co_return priority;
+    };
+    auto nested = [&probe]() -> coro::Task<coro::Priority> {
+        auto priority{ co_await probe() };
+        co_return priority;
+    };
+
+    coro::co_spawn(context, [&](coro::Context&) -> coro::Task<void> {
+        auto inherited{ co_await probe() };
+        auto pinned{ co_await coro::withPriority(nested(), coro::Priority::Cyclic) };
+        auto joined{ co_await coro::whenAll(probe(), probe()) };
+        seen = { inherited, pinned, std::get<1>(joined) };
+        done = true;
+    }, coro::Priority::Background);
+
+    ASSERT_TRUE(waitFor([&] { return done.load(); }));
+    context.stop();
+    const std::vector expected{ coro::Priority::Background,
+                                coro::Priority::Cyclic,
+                                coro::Priority::Background };
+    EXPECT_EQ(seen, expected);
+}
+
+// ============================================================
+// Async Sync Primitive Tests
+// ============================================================
+
+TEST(AsyncMutexTest, HoldsAcrossSuspensionWithoutBlockingTheExecutor)
+{
+    coro::Context context;
+    std::jthread runner{ [&] { context.run(); } };
+    coro::AsyncMutex mutex;
+    std::atomic<int> completed{ 0 };
+    int inside{ 0 };
+    int maxInside{ 0 };
+    constexpr int WORKERS{ 4 };
+
+    for (int i{ 0 }; i < WORKERS; ++i) {
+        coro::co_spawn(context, [&](coro::Context&) -> coro::Task<void> {
+            auto guard{ co_await mutex.lock() };
+            maxInside = std::max(maxInside, ++inside);
+            co_await coro::sleep(1ms);
+            --inside;
+            ++completed;
+        });
+    }
+
+    ASSERT_TRUE(waitFor([&] { return completed.load() == WORKERS; }));
+    context.stop();
+    EXPECT_EQ(maxInside, 1);
+    EXPECT_FALSE(mutex.isLocked());
+}
+
+TEST(AsyncSemaphoreTest, HandsPermitsToWaitersInOrder)
+{
+    coro::AsyncSemaphore semaphore{ 1 };
+    std::vector<int> order{};
+    auto worker = [&](int id) -> coro::Task<void> {
+        auto permit{ co_await semaphore.acquire() };
+        EXPECT_TRUE(permit);
+        order.push_back(id);
+    };
+
+    auto held{ semaphore.tryAcquire() };
+    ASSERT_TRUE(held);
+    EXPECT_FALSE(semaphore.tryAcquire());
+
+    std::vector<coro::Task<void>> waiters{};
+    for (int i{ 0 }; i < 3; ++i) {
+        waiters.push_back(worker(i));
+        waiters.back().getHandle().resume();
+    }
+    EXPECT_EQ(semaphore.waiterCount(), 3u);
+    EXPECT_TRUE(order.empty());
+
+    held.release();
+    EXPECT_EQ(order, (std::vector<int>{ 0, 1, 2 }));
+    EXPECT_EQ(semaphore.available(), 1u);
+}
+
+TEST(AsyncSemaphoreTest, StoppedWaiterGetsNoPermitAndLeavesTheQueue)
+{
+    coro::AsyncSemaphore semaphore{ 1 };
+    std::stop_source source;
+    std::optional<bool> acquired{};
+
+    auto held{ semaphore.tryAcquire() };
+    auto waiter = [&]() -> coro::Task<void> {
+        auto permit{ co_await semaphore.acquire() };
+        acquired = static_cast<bool>(permit);
+    };
+    auto task{ waiter() };
+    task.getHandle().promise().stopToken = source.get_token();
+    task.getHandle().resume();
+    ASSERT_EQ(semaphore.waiterCount(), 1u);
+
+    source.request_stop();
+    ASSERT_TRUE(acquired.has_value());
+    EXPECT_FALSE(*acquired);
+    EXPECT_EQ(semaphore.waiterCount(), 0u);
+
+    held.release();
+    EXPECT_EQ(semaphore.available(), 1u);
+}
+
+TEST(AsyncSemaphoreTest, DestroyedWaiterDoesNotLeakAPermit)
+{
+    coro::AsyncSemaphore semaphore{ 1 };
+    auto held{ semaphore.tryAcquire() };
+    auto waiter = [&]() -> coro::Task<void> { auto permit{ co_await semaphore.acquire() }; };
+    {
+        auto task{ waiter() };
+        task.getHandle().resume();
+        EXPECT_EQ(semaphore.waiterCount(), 1u);
+    }
+    EXPECT_EQ(semaphore.waiterCount(), 0u);
+    held.release();
+    EXPECT_EQ(semaphore.available(), 1u);
+}
+
+TEST(AsyncSemaphoreTest, WaitUntilIdleReturnsOnceAbandonedWorkHandsItsPermitBack)
+{
+    coro::AsyncSemaphore semaphore{ 2 };
+    std::atomic<bool> released{ false };
+    std::jthread worker{ [&, permit = semaphore.tryAcquire()]() mutable {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        released = true;
+        permit.release();
+    } };
+
+    semaphore.waitUntilIdle();
+    EXPECT_TRUE(released);
+    EXPECT_EQ(semaphore.available(), 2u);
+}
+
+TEST(AsyncManualResetEventTest, SetResumesEveryWaiterOnItsExecutor)
+{
+    coro::Context context;
+    std::jthread runner{ [&] { context.run(); } };
+    coro::AsyncManualResetEvent event;
+    std::atomic<int> woken{ 0 };
+    std::atomic<int> onContext{ 0 };
+    constexpr int WAITERS{ 3 };
+
+    for (int i{ 0 }; i < WAITERS; ++i) {
+        coro::co_spawn(context, [&](coro::Context& ctx) -> coro::Task<void> {
+            const auto set{ co_await event.wait() };
+            EXPECT_TRUE(set);
+            auto* executor{ co_await CurrentExecutor{} };
+            if (executor == &ctx) {
+                ++onContext;
+            }
+            ++woken;
+        });
+    }
+    ASSERT_TRUE(waitFor([&] { return event.waiterCount() == WAITERS; }));
+    EXPECT_EQ(woken.load(), 0);
+
+    event.set();
+    ASSERT_TRUE(waitFor([&] { return woken.load() == WAITERS; }));
+    EXPECT_EQ(onContext.load(), WAITERS);
+
+    // Stays set until reset.
+    std::atomic<bool> passed{ false };
+    coro::co_spawn(context, [&](coro::Context&) -> coro::Task<void> {
+        (void)co_await event.wait();
+        passed = true;
+    });
+    ASSERT_TRUE(waitFor([&] { return passed.load(); }));
+    event.reset();
+    EXPECT_FALSE(event.isSet());
+    context.stop();
+}
+
+// ============================================================
+// Generator Tests
+// ============================================================
+
+namespace
+{
+    template<typename T>
+    auto collect(coro::AsyncGenerator<T> generator) -> std::vector<T>
+    {
+        std::vector<T> values;
+        auto pull = [&]() -> coro::Task<void> {
+            while (true) {
+                auto value{ co_await generator.next() };
+                if (!value) {
+                    co_return;
+                }
+                values.push_back(std::move(*value));
+            }
+        };
+        auto task{ pull() };
+        task.getHandle().resume();
+        if (auto exception{ task.getHandle().promise().exception }) {
+            std::rethrow_exception(exception);
+        }
+        return values;
+    }
+
+    // Drives the pipeline on a Context so sleeps and deadlines inside it work.
+    template<typename T>
+    auto collectOnContext(coro::AsyncGenerator<T> generator) -> std::vector<T>
+    {
+        coro::Context context;
+        std::vector<T> values;
+        coro::co_spawn(context, [&](coro::Context& ctx) -> coro::Task<void> {
+            while (true) {
+                auto value{ co_await generator.next() };
+                if (!value) {
+                    break;
+                }
+                values.push_back(std::move(*value));
+            }
+            ctx.stop();
+        });
+        context.run();
+        return values;
+    }
+}
+
+TEST(GeneratorTest, YieldsMovedValuesUntilTheBodyReturns)
+{
+    auto counter = []() -> coro::AsyncGenerator<std::unique_ptr<int>> {
+        for (int i{ 1 }; i <= 3; ++i) {
+            co_yield std::make_unique<int>(i);
+        }
+    };
+    const auto values{ collect(counter()) };
+    ASSERT_EQ(values.size(), 3u);
+    EXPECT_EQ(*values[0], 1);
+    EXPECT_EQ(*values[2], 3);
+}
+
+TEST(GeneratorTest, RethrowsFromTheBodyAtNext)
+{
+    auto failing = []() -> coro::AsyncGenerator<int> {
+        co_yield 1;
+        throw std::runtime_error("broken");
+    };
+    EXPECT_THROW(collect(failing()), std::runtime_error);
+}
+
+TEST(GeneratorTest, AdaptersComposeOverAChannel)
+{
+    coro::Channel<int> channel;
+    for (const auto value : { 1, 1, 2, 2, 3, 4, 4, 5, 6 }) {
+        channel.push(value);
+    }
+    channel.close();
+
+    auto pipeline{ coro::values(channel) | coro::distinctUntilChanged() |
+                   coro::filter([](int value) { return value % 2 == 0; }) |
+                   coro::map([](int value) { return value * 10; }) | coro::batch(2) };
+    const auto batches{ collect(std::move(pipeline)) };
+
+    const std::vector<std::vector<int>> expected{ { 20, 40 }, { 60 } };
+    EXPECT_EQ(batches, expected);
+}
+
+TEST(GeneratorTest, DebounceEmitsOnlyOnceABurstHasSettled)
+{
+    auto bursts = []() -> coro::AsyncGenerator<int> {
+        co_yield 1;
+        co_yield 2;
+        co_yield 3;
+        co_await coro::sleep(60ms);
+        co_yield 4;
+        co_yield 5;
+    };
+    EXPECT_EQ(collectOnContext(bursts() | coro::debounce(20ms)), (std::vector<int>{ 3, 5 }));
+}
+
+TEST(GeneratorTest, SampleEmitsTheLatestValuePerInterval)
+{
+    auto slow = []() -> coro::AsyncGenerator<int> {
+        co_yield 1;
+        co_yield 2;
+        co_await coro::sleep(70ms);
+        co_yield 3;
+        co_await coro::sleep(70ms);
+    };
+    EXPECT_EQ(collectOnContext(slow() | coro::sample(40ms)), (std::vector<int>{ 2, 3 }));
+}
+
+// ============================================================
+// Strand Tests
+// ============================================================
+
+TEST(StrandTest, RunsCallbacksAndCoroutinesOneAtATimeInOrder)
+{
+    coro::ThreadPool pool{ 4 };
+    coro::Strand strand{ pool };
+    std::jthread runner{ [&] { pool.run(); } };
+
+    std::atomic<int> active{ 0 };
+    std::atomic<bool> overlapped{ false };
+    std::vector<int> order; // only touched on the strand
+    auto enter = [&] {
+        if (active.fetch_add(1) != 0) {
+            overlapped = true;
+        }
+    };
+
+    constexpr int POSTS{ 500 };
+    for (int i = 0; i < POSTS; ++i) {
+        strand.post([&, i] {
+            enter();
+            order.push_back(i);
+            active.fetch_sub(1);
+        });
+    }
+
+    std::atomic<int> finished{ 0 };
+    auto worker = [&](coro::Strand&) -> coro::Task<void> {
+        for (int step = 0; step < 20; ++step) {
+            co_await Reschedule{};
+            enter();
+            EXPECT_TRUE(strand.runningInThisThread());
+            active.fetch_sub(1);
+        }
+        ++finished;
+    };
+    for (int i = 0; i < 8; ++i) {
+        coro::co_spawn(strand, worker);
+    }
+
+    EXPECT_TRUE(waitFor([&] { return finished == 8; }));
+    std::atomic<bool> drained{ false };
+    strand.post([&] { drained = true; });
+    EXPECT_TRUE(waitFor([&] { return drained.load(); }));
+    pool.stop();
+    runner.join();
+
+    EXPECT_FALSE(overlapped);
+    EXPECT_FALSE(strand.runningInThisThread());
+    ASSERT_EQ(order.size(), static_cast<size_t>(POSTS));
+    for (int i = 0; i < POSTS; ++i) {
+        EXPECT_EQ(order[i], i);
+    }
+}
+
+TEST(StrandTest, SeparateStrandsRunInParallel)
+{
+    coro::ThreadPool pool{ 2 };
+    coro::Strand first{ pool };
+    coro::Strand second{ pool };
+    std::jthread runner{ [&] { pool.run(); } };
+
+    // Each callback waits for the other to start, which only works if both hold a thread at once.
+    std::atomic<int> started{ 0 };
+    std::atomic<int> metInParallel{ 0 };
+    auto rendezvous = [&] {
+        ++started;
+        if (waitFor([&] { return started == 2; })) {
+            ++metInParallel;
+        }
+    };
+    first.post(rendezvous);
+    second.post(rendezvous);
+
+    EXPECT_TRUE(waitFor([&] { return metInParallel == 2; }, 3000ms));
+    pool.stop();
+    runner.join();
+}
+
+TEST(StrandTest, SleepsAndChildTasksResumeOnTheStrand)
+{
+    coro::ThreadPool pool{ 4 };
+    coro::Strand strand{ pool };
+    std::jthread runner{ [&] { pool.run(); } };
+
+    std::atomic<bool> onStrandAfterSleep{ false };
+    std::atomic<coro::IExecutor*> childExecutor{ nullptr };
+    auto child = []() -> coro::Task<coro::IExecutor*> {
+        co_await coro::sleep(5ms);
+        co_return co_await CurrentExecutor{};
+    };
+    coro::co_spawn(strand, [&](coro::Strand&) -> coro::Task<void> {
+        co_await coro::sleep(5ms);
+        onStrandAfterSleep = strand.runningInThisThread();
+        auto* executor{ co_await child() };
+        childExecutor = executor;
+    });
+
+    EXPECT_TRUE(waitFor([&] { return childExecutor.load() != nullptr; }));
+    pool.stop();
+    runner.join();
+
+    EXPECT_TRUE(onStrandAfterSleep);
+    EXPECT_EQ(childExecutor.load(), &strand);
+    // The spawn and the two timer wake-ups; starting the child is a symmetric transfer.
+    EXPECT_EQ(strand.stats().resumes, 3u);
+}
@@ -0,0 +1,996 @@
+#include <gtest/gtest.h>
+
+#include "Coroutines/coroutine.hpp"
+#include "Link/LinkFactory.hpp"
+#include "Link/Raw/AsioExecutor.hpp"
+#include "Link/Raw/TcpServer.hpp"
+#include "Link/Replay/RecordingLink.hpp"
+#include "Link/Replay/ReplayLink.hpp"
+#include "Link/Symbolic/LocalAdsLink.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+using namespace core;
+
+// ============================================================
+// Helpers
+// ============================================================
+
+namespace
+{
+    std::atomic<uint64_t> g_heapAllocations{ 0 };
+}
+
+// Counts every heap allocation in this test binary so tests can assert a path is allocation-free.
+auto operator new(std::size_t size) -> void*
+{
+    g_heapAllocations.fetch_add(1, std::memory_order_relaxed);
+    if (auto* ptr{ std::malloc(size ? size : 1) }) {
+        return ptr;
+    }
+    throw std::bad_alloc{};
+}
+
+auto operator delete(void* ptr) noexcept -> void
+{
+    std::free(ptr);
+}
+
+auto operator delete(void* ptr, std::size_t) noexcept -> void
+{
+    std::free(ptr);
+}
+
+namespace
+{
+    // Runs the coroutine on a fresh Context on the calling thread until it finishes.
+    template<typename Coro>
+    auto runOnContext(Coro&& coro) -> void
+    {
+        coro::Context context;
+        coro::co_spawn(context, [&](coro::Context& ctx) -> coro::Task<void> {
+            co_await coro(ctx);
+            ctx.stop();
+        });
+        context.run();
+    }
+}
+
+// ============================================================
+// Frame Allocation Tests
+// ============================================================
+
+TEST(FrameAllocationTest, SteadyStateCyclicIoAllocatesNoFrames)
+{
+    auto link{ std::make_shared<link::symbolic::LocalAdsLink>("frames") };
+    constexpr int CYCLES{ 1000 };
+
+    coro::FrameAllocatorStats before{};
+    coro::FrameAllocatorStats after{};
+    int32_t lastValue{ 0 };
+
+    runOnContext([&](coro::Context&) -> coro::Task<void> {
+        auto cycle = [&](int32_t i) -> coro::Task<void> {
+            co_await link->write("MAIN.counter", i);
+            auto value{ co_await link->read<int32_t>("MAIN.counter") };
+            lastValue = value.value_or(-1);
+        };
+
+        // Warm-up fills the free lists for every frame size the cycle uses.
+        co_await cycle(0);
+        before = coro::FrameAllocator::stats();
+        for (int32_t i = 1; i <= CYCLES; ++i) {
+            co_await cycle(i);
+        }
+        after = coro::FrameAllocator::stats();
+    });
+
+    EXPECT_EQ(lastValue, CYCLES);
+    // One frame each for the cycle and the typed write and read; the in-process readInto/writeFrom
+    // complete inline and take none.
+    EXPECT_EQ(after.allocations - before.allocations, static_cast<uint64_t>(CYCLES) * 3);
+    EXPECT_EQ(after.heapAllocations, before.heapAllocations);
+}
+
+// ============================================================
+// Subscription Tests
+// ============================================================
+
+TEST(SubscriptionTest, ConflatedSubscriptionDeliversLatestValue)
+{
+    auto link{ std::make_shared<link::symbolic::LocalAdsLink>("conflate") };
+    std::optional<int32_t> received{};
+
+    runOnContext([&](coro::Context&) -> coro::Task<void> {
+        auto sub{ co_await link->subscribe<int32_t>(
+          "MAIN.speed",
+          link::SubscriptionType::OnChange,
+          link::NO_TIMEOUT,
+          { .overflow = coro::OverflowPolicy::Conflate }) };
+        if (!sub) {
+            co_return;
+        }
+
+        for (int32_t i = 1; i <= 100; ++i) {
+            link->writeSync("MAIN.speed", i);
+        }
+        received = co_await sub->stream.next();
+    });
+
+    EXPECT_EQ(received, 100);
+}
+
+TEST(SubscriptionTest, BoundedSubscriptionKeepsItsOverflowPolicy)
+{
+    auto link{ std::make_shared<link::symbolic::LocalAdsLink>("bounded") };
+    std::vector<int32_t> received{};
+
+    runOnContext([&](coro::Context&) -> coro::Task<void> {
+        auto sub{ co_await link->subscribe<int32_t>(
+          "MAIN.speed",
+          link::SubscriptionType::OnChange,
+          link::NO_TIMEOUT,
+          { .capacity = 2, .overflow = coro::OverflowPolicy::DropNewest }) };
+        if (!sub) {
+            co_return;
+        }
+
+        // The subscription's current value already fills one slot.
+        for (int32_t i = 1; i <= 100; ++i) {
+            link->writeSync("MAIN.speed", i);
+        }
+        for (int i = 0; i < 2; ++i) {
+            auto value{ co_await sub->stream.next() };
+            if (value) {
+                received.push_back(*value);
+            }
+        }
+    });
+
+    EXPECT_EQ(received, (std::vector<int32_t>{ 0, 1 }));
+}
+
+TEST(SubscriptionTest, BoundedBlockingSubscriptionIsRefused)
+{
+    auto link{ std::make_shared<link::symbolic::LocalAdsLink>("blocking") };
+    std::optional<std::error_code> error{};
+
+    runOnContext([&](coro::Context&) -> coro::Task<void> {
+        auto sub{ co_await link->subscribe<int32_t>(
+          "MAIN.speed",
+          link::SubscriptionType::OnChange,
+          link::NO_TIMEOUT,
+          { .capacity = 2, .overflow = coro::OverflowPolicy::Block }) };
+        if (!sub) {
+            error = sub.error();
+        }
+    });
+
+    EXPECT_EQ(error, std::make_error_code(std::errc::invalid_argument));
+}
+
+TEST(SubscriptionTest, ValuesFeedAnAdapterPipeline)
+{
+    auto link{ std::make_shared<link::symbolic::LocalAdsLink>("pipeline") };
+    std::vector<int32_t> received{};
+
+    runOnContext([&](coro::Context&) -> coro::Task<void> {
+        auto sub{ co_await link->subscribe<int32_t>("MAIN.speed") };
+        if (!sub) {
+            co_return;
+        }
+        for (const int32_t value : { 1, 1, 2, 2, 3 }) {
+            link->writeSync("MAIN.speed", value);
+        }
+
+        auto changes{ sub->values() | coro::distinctUntilChanged() };
+        while (received.size() < 4) {
+            auto value{ co_await changes.next() };
+            if (!value) {
+                break;
+            }
+            received.push_back(*value);
+        }
+    });
+
+    // The subscription starts with the current value.
+    EXPECT_EQ(received, (std::vector<int32_t>{ 0, 1, 2, 3 }));
+}
+
+TEST(SubscriptionTest, SubscribersOfASymbolShareOneBufferAndSeeOnlyChanges)
+{
+    auto link{ std::make_shared<link::symbolic::LocalAdsLink>("fanout") };
+    using Block = std::array<std::byte, 64>;
+    std::optional<coro::RawBinaryChannel::SharedBytes> first{};
+    std::optional<coro::RawBinaryChannel::SharedBytes> second{};
+    std::optional<coro::RawBinaryChannel::SharedBytes> cyclic{};
+
+    runOnContext([&](coro::Context&) -> coro::Task<void> {
+        auto a{ co_await link->subscribeRaw("MAIN.block", sizeof(Block)) };
+        auto b{ co_await link->subscribeRaw("MAIN.block", sizeof(Block)) };
+        auto c{ co_await link->subscribeRaw("MAIN.block", sizeof(Block), link::SubscriptionType::Cyclic) };
+        if (!a || !b || !c) {
+            co_return;
+        }
+        // Initial values.
+        co_await (*a)->stream.next(first);
+        co_await (*b)->stream.next(second);
+        co_await (*c)->stream.next(cyclic);
+
+        Block block{};
+        link->writeSync("MAIN.block", block); // unchanged: only the cyclic subscriber hears it
+        co_await (*c)->stream.next(cyclic);
+        block[0] = std::byte{ 7 };
+        link->writeSync("MAIN.block", block);
+        co_await (*a)->stream.next(first);
+        co_await (*b)->stream.next(second);
+    });
+
+    // The unchanged write never reached the on-change subscribers, so the next value they saw is the change.
+    ASSERT_TRUE(first && second);
+    EXPECT_EQ((**first)[0], std::byte{ 7 });
+    EXPECT_EQ(first->get(), second->get());
+}
+
+#pragma pack(push, 1)
+struct PackedStatus
+{
+    uint8_t flags;
+    double position;
+};
+#pragma pack(pop)
+static_assert(sizeof(PackedStatus) == 9);
+
+TEST(SubscriptionTest, TypedUpdatesOfSmallStructsDoNotAllocate)
+{
+    auto link{ std::make_shared<link::symbolic::LocalAdsLink>("typed") };
+    constexpr int UPDATES{ 100 };
+
+    uint64_t allocations{ 0 };
+    double lastPosition{ 0.0 };
+
+    runOnContext([&](coro::Context&) -> coro::Task<void> {
+        auto sub{ co_await link->subscribe<PackedStatus>("MAIN.status") };
+        if (!sub) {
+            co_return;
+        }
+        // Initial value plus one update warm up the channel's slot ring.
+        co_await sub->stream.next();
+        link->writeSync("MAIN.status", PackedStatus{ 1, 0.5 });
+        co_await sub->stream.next();
+
+        const auto before{ g_heapAllocations.load() };
+        for (int i = 1; i <= UPDATES; ++i) {
+            link->writeSync("MAIN.status", PackedStatus{ 1, static_cast<double>(i) });
+            if (auto status{ co_await sub->stream.next() }) {
+                lastPosition = status->position;
+            }
+        }
+        allocations = g_heapAllocations.load() - before;
+    });
+
+    EXPECT_EQ(lastPosition, static_cast<double>(UPDATES));
+    EXPECT_EQ(allocations, 0u);
+}
+
+TEST(SubscriptionTest, CycleStagesWritesAndNotifiesOncePerSymbolOnCommit)
+{
+    auto link{ std::make_shared<link::symbolic::LocalAdsLink>("cycle") };
+    const auto counter{ link->registerSymbol<int32_t>("MAIN.counter") };
+    const auto flag{ link->registerSymbol<bool>("MAIN.flag") };
+    std::vector<int32_t> counters;
+    std::optional<coro::RawBinaryChannel::SharedBytes> value{};
+
+    runOnContext([&](coro::Context&) -> coro::Task<void> {
+        auto sub{ co_await link->subscribeRaw("MAIN.counter", sizeof(int32_t)) };
+        if (!sub) {
+            co_return;
+        }
+        co_await (*sub)->stream.next(value); // initial value
+
+        const auto before{ link->cycleSequence() };
+        link->beginCycle();
+        link->writeSync(counter, int32_t{ 1 });
+        link->writeSync(counter, int32_t{ 2 });
+        link->writeSync(flag, true);
+        // The cycle's own thread reads what it staged; everyone else still sees the image.
+        counters.push_back(link->readSync<int32_t>(counter));
+        std::thread other{ [&] { counters.push_back(link->readSync<int32_t>(counter)); } };
+        other.join();
+        link->commit();
+        EXPECT_EQ(link->cycleSequence(), before + 2);
+
+        link->writeSync(counter, int32_t{ 3 });
+        for (int i{ 0 }; i < 2; ++i) {
+            co_await (*sub)->stream.next(value);
+            int32_t seen{ 0 };
+            std::memcpy(&seen, (*value)->data(), sizeof(seen));
+            counters.push_back(seen);
+        }
+    });
+
+    // The intermediate 1 was never published: one notification for the cycle, then the later write.
+    EXPECT_EQ(counters, (std::vector<int32_t>{ 2, 0, 2, 3 }));
+    EXPECT_TRUE(link->readSync<bool>(flag));
+}
+
+TEST(SubscriptionTest, CyclicIntervalSamplesAtTheRequestedRate)
+{
+    using namespace std::chrono_literals;
+
+    auto link{ std::make_shared<link::symbolic::LocalAdsLink>("sampled") };
+    const auto counter{ link->registerSymbol<int32_t>("MAIN.counter") };
+    std::atomic<bool> writing{ true };
+    std::atomic<int32_t> written{ 0 };
+    std::jthread writer{ [&] {
+        while (writing) {
+            link->writeSync(counter, ++written);
+        }
+    } };
+
+    constexpr int SAMPLES{ 5 };
+    std::vector<int32_t> samples;
+    std::chrono::steady_clock::duration elapsed{};
+    runOnContext([&](coro::Context&) -> coro::Task<void> {
+        auto sub{ co_await link->subscribeRaw(
+          "MAIN.counter", sizeof(int32_t), link::SubscriptionType::Cyclic, 20ms) };
+        if (!sub) {
+            co_return;
+        }
+        std::optional<coro::RawBinaryChannel::SharedBytes> value{};
+        co_await (*sub)->stream.next(value); // initial value
+
+        const auto start{ std::chrono::steady_clock::now() };
+        for (int i{ 0 }; i < SAMPLES; ++i) {
+            co_await (*sub)->stream.next(value);
+            int32_t seen{ 0 };
+            std::memcpy(&seen, (*value)->data(), sizeof(seen));
+            samples.push_back(seen);
+        }
+        elapsed = std::chrono::steady_clock::now() - start;
+        link->unsubscribeRawSync((*sub)->id);
+    });
+    writing = false;
+
+    // Each sample waits for its period no matter how often the symbol changes.
+    ASSERT_EQ(samples.size(), static_cast<size_t>(SAMPLES));
+    EXPECT_GE(elapsed, (SAMPLES - 1) * 20ms);
+    EXPECT_TRUE(std::ranges::is_sorted(samples));
+    // The writes in between were never delivered.
+    EXPECT_GT(samples.back() - samples.front(), SAMPLES);
+}
+
+// ============================================================
+// Cancellation Tests
+// ============================================================
+
+TEST(CancellationTest, StoppedCallerDoesNotWrite)
+{
+    using namespace std::chrono_literals;
+
+    auto link{ std::make_shared<link::symbolic::LocalAdsLink>("cancel") };
+    link->writeSync("MAIN.target", int32_t{ 1 });
+    std::stop_source source;
+    result::Result<int32_t> read{};
+    result::Result<void> written{};
+
+    coro::Context context;
+    coro::co_spawn(
+      context,
+      [&](coro::Context& ctx) -> coro::Task<void> {
+          // A deadline that does not expire leaves the call untouched.
+          read = co_await link->read<int32_t>("MAIN.target", 1s);
+          source.request_stop();
+          written = co_await link->write("MAIN.target", int32_t{ 2 }, 1s);
+          ctx.stop();
+      },
+      source.get_token());
+    context.run();
+
+    EXPECT_EQ(read, 1);
+    ASSERT_FALSE(written.has_value());
+    EXPECT_EQ(written.error(), std::errc::operation_canceled);
+    EXPECT_EQ(link->readSync<int32_t>("MAIN.target"), 1);
+}
+
+namespace
+{
+    // Completes every call inline and counts the ones that reach it.
+    class CountingRawLink : public link::IRawLink
+    {
+      public:
+        auto getRole() const -> link::Role override { return link::Role::Client; }
+        auto status() const -> link::Status override { return link::Status::Connected; }
+
+        auto receiveInto(std::string_view, std::span<std::byte> dest, std::chrono::milliseconds)
+          -> coro::ValueTask<result::Result<size_t>> override
+        {
+            ++calls;
+            std::ranges::fill(dest, std::byte{ 0 });
+            return dest.size();
+        }
+
+        auto sendFrom(std::string_view, std::span<const std::byte>, std::chrono::milliseconds)
+          -> coro::ValueTask<result::Result<void>> override
+        {
+            ++calls;
+            return result::success();
+        }
+
+        int calls{ 0 };
+    };
+}
+
+TEST(CancellationTest, StoppedCallerDoesNotReachTheRawLink)
+{
+    CountingRawLink link;
+    std::stop_source source;
+    result::Result<int32_t> received{};
+    result::Result<void> sent{};
+
+    coro::Context context;
+    coro::co_spawn(
+      context,
+      [&](coro::Context& ctx) -> coro::Task<void> {
+          source.request_stop();
+          received = co_await link.receive<int32_t>("frame");
+          sent = co_await link.send("frame", int32_t{ 2 });
+          ctx.stop();
+      },
+      source.get_token());
+    context.run();
+
+    ASSERT_FALSE(received.has_value());
+    EXPECT_EQ(received.error(), std::errc::operation_canceled);
+    ASSERT_FALSE(sent.has_value());
+    EXPECT_EQ(sent.error(), std::errc::operation_canceled);
+    EXPECT_EQ(link.calls, 0);
+}
+
+// ============================================================
+// Inline Completion Tests
+// ============================================================
+
+TEST(InlineCompletionTest, LocalAccessIsReadyWithoutAFrame)
+{
+    link::symbolic::LocalAdsLink link{ "inline" };
+    int32_t value{ 42 };
+    auto write{ link.writeFrom("MAIN.inline", std::as_bytes(std::span{ &value, 1 })) };
+    EXPECT_TRUE(write.isReady());
+
+    int32_t readBack{ 0 };
+    const auto before{ coro::FrameAllocator::stats().allocations };
+    auto read{ link.readInto("MAIN.inline", std::as_writable_bytes(std::span{ &readBack, 1 })) };
+    EXPECT_EQ(coro::FrameAllocator::stats().allocations, before);
+
+    ASSERT_TRUE(read.isReady());
+    EXPECT_EQ(read.await_resume(), sizeof(int32_t));
+    EXPECT_EQ(readBack, 42);
+}
+
+// ============================================================
+// Batch Tests
+// ============================================================
+
+TEST(BatchTest, ReadManySeesAWriteManyWholeOrNotAtAll)
+{
+    link::symbolic::LocalAdsLink link{ "batch" };
+    constexpr int32_t BATCHES{ 20000 };
+
+    std::jthread writer{ [&] {
+        for (int32_t i{ 1 }; i <= BATCHES; ++i) {
+            const std::array<int32_t, 2> values{ i, -i };
+            const std::array writes{
+                link::SymbolWrite{ "MAIN.a", std::as_bytes(std::span{ &values[0], 1 }) },
+                link::SymbolWrite{ "MAIN.b", std::as_bytes(std::span{ &values[1], 1 }) },
+            };
+            auto written{ link.writeMany(writes) };
+            EXPECT_TRUE(written.isReady() && written.await_resume());
+        }
+    } };
+
+    int torn{ 0 };
+    int32_t last{ 0 };
+    while (last < BATCHES) {
+        std::array<int32_t, 2> values{};
+        const std::array reads{
+            link::SymbolRead{ "MAIN.a", std::as_writable_bytes(std::span{ &values[0], 1 }) },
+            link::SymbolRead{ "MAIN.b", std::as_writable_bytes(std::span{ &values[1], 1 }) },
+        };
+        auto read{ link.readMany(reads) };
+        ASSERT_TRUE(read.isReady() && read.await_resume());
+        torn += values[0] != -values[1] ? 1 : 0;
+        last = values[0];
+    }
+
+    EXPECT_EQ(torn, 0);
+}
+
+TEST(BatchTest, WriteManyNotifiesOncePerSymbol)
+{
+    auto link{ std::make_shared<link::symbolic::LocalAdsLink>("batchNotify") };
+    std::vector<int32_t> seen;
+
+    runOnContext([&](coro::Context&) -> coro::Task<void> {
+        auto sub{ co_await link->subscribe<int32_t>("MAIN.a") };
+        if (!sub) {
+            co_return;
+        }
+        co_await sub->stream.next(); // initial value
+
+        const int32_t first{ 1 };
+        const int32_t second{ 2 };
+        const std::array writes{
+            link::SymbolWrite{ "MAIN.a", std::as_bytes(std::span{ &first, 1 }) },
+            link::SymbolWrite{ "MAIN.a", std::as_bytes(std::span{ &second, 1 }) },
+        };
+        const auto before{ link->cycleSequence() };
+        (void)co_await link->writeMany(writes);
+        EXPECT_EQ(link->cycleSequence(), before + 2);
+
+        link->writeSync("MAIN.a", int32_t{ 3 });
+        for (int i{ 0 }; i < 2; ++i) {
+            if (auto value{ co_await sub->stream.next() }) {
+                seen.push_back(*value);
+            }
+        }
+    });
+
+    // The batch's intermediate value was never published.
+    EXPECT_EQ(seen, (std::vector<int32_t>{ 2, 3 }));
+}
+
+// ============================================================
+// Replay Tests
+// ============================================================
+
+namespace
+{
+    // Records a session against a local link: a subscription that sees 0, 1 and 2, then a read of 2
+    // some 50ms later.
+    auto recordSession(const std::filesystem::path& file) -> std::vector<int32_t>
+    {
+        using namespace std::chrono_literals;
+        std::vector<int32_t> samples;
+        auto recording{ link::replay::RecordingLink::open(
+          std::make_unique<link::symbolic::LocalAdsLink>("recorded"), file) };
+        if (!recording) {
+            return samples;
+        }
+        auto* symbolic{ (*recording)->asSymbolic() };
+
+        runOnContext([&](coro::Context&) -> coro::Task<void> {
+            auto sub{ co_await symbolic->subscribe<int32_t>("MAIN.speed") };
+            if (!sub) {
+                co_return;
+            }
+            (void)co_await symbolic->write("MAIN.speed", int32_t{ 1 });
+            (void)co_await symbolic->write("MAIN.speed", int32_t{ 2 });
+            while (samples.size() < 3) {
+                if (auto value{ co_await sub->stream.next() }) {
+                    samples.push_back(*value);
+                }
+            }
+            co_await coro::sleep(50ms);
+            (void)co_await symbolic->read<int32_t>("MAIN.speed");
+        });
+        return samples;
+    }
+}
+
+TEST(ReplayTest, ReplayServesTheRecordedSessionAndCountsDivergentWrites)
+{
+    const auto file{ std::filesystem::temp_directory_path() / "tsimcat_replay_fast.trace" };
+    const auto recorded{ recordSession(file) };
+    ASSERT_EQ(recorded, (std::vector<int32_t>{ 0, 1, 2 }));
+
+    auto replay{ link::replay::ReplayLink::open(file, link::replay::ReplayLink::AS_FAST_AS_POSSIBLE) };
+    ASSERT_TRUE(replay);
+    EXPECT_EQ((*replay)->getRole(), link::Role::Client);
+    EXPECT_EQ((*replay)->getMode(), link::Mode::Symbolic);
+    auto* symbolic{ (*replay)->asSymbolic() };
+    ASSERT_NE(symbolic, nullptr);
+
+    std::vector<int32_t> replayed;
+    result::Result<int32_t> read{};
+    runOnContext([&](coro::Context&) -> coro::Task<void> {
+        auto sub{ co_await symbolic->subscribe<int32_t>("MAIN.speed") };
+        if (!sub) {
+            co_return;
+        }
+        (void)co_await symbolic->write("MAIN.speed", int32_t{ 1 });
+        (void)co_await symbolic->write("MAIN.speed", int32_t{ 3 });
+        while (replayed.size() < 3) {
+            if (auto value{ co_await sub->stream.next() }) {
+                replayed.push_back(*value);
+            }
+        }
+        read = co_await symbolic->read<int32_t>("MAIN.speed");
+    });
+
+    EXPECT_EQ(replayed, recorded);
+    ASSERT_TRUE(read);
+    EXPECT_EQ(*read, 2);
+    EXPECT_EQ((*replay)->divergenceCount(), 1u);
+
+    (*replay).reset();
+    std::filesystem::remove(file);
+}
+
+TEST(ReplayTest, RealTimeReplayKeepsTheRecordedTiming)
+{
+    using namespace std::chrono_literals;
+    const auto file{ std::filesystem::temp_directory_path() / "tsimcat_replay_paced.trace" };
+    ASSERT_EQ(recordSession(file).size(), 3u);
+
+    auto replay{ link::replay::ReplayLink::open(file) };
+    ASSERT_TRUE(replay);
+    const auto started{ std::chrono::steady_clock::now() };
+    result::Result<int32_t> read{};
+    runOnContext([&](coro::Context&) -> coro::Task<void> {
+        read = co_await (*replay)->read<int32_t>("MAIN.speed");
+    });
+    const auto elapsed{ std::chrono::steady_clock::now() - started };
+
+    ASSERT_TRUE(read);
+    EXPECT_EQ(*read, 2);
+    EXPECT_GE(elapsed, 45ms);
+
+    (*replay).reset();
+    std::filesystem::remove(file);
+}
+
+TEST(ReplayTest, RecordingAnInProcessLinkIsRefused)
+{
+    const auto file{ std::filesystem::temp_directory_path() / "tsimcat_replay_in_process.trace" };
+    link::LinkConfig config;
+    config.inProcess = true;
+    config.recordTo = file.string();
+
+    const auto recorded{
+        link::create(link::Role::Client, link::Mode::Symbolic, link::Protocol::Ads, config)
+    };
+    ASSERT_FALSE(recorded);
+    EXPECT_EQ(recorded.error(), std::make_error_code(std::errc::invalid_argument));
+    EXPECT_FALSE(std::filesystem::exists(file));
+
+    config.recordTo.clear();
+    const auto local{ link::create(link::Role::Client, link::Mode::Symbolic, link::Protocol::Ads, config) };
+    ASSERT_TRUE(local);
+    EXPECT_NE(dynamic_cast<link::symbolic::LocalAdsLink*>(local->get()), nullptr);
+}
+
+// ============================================================
+// Process Image Tests
+// ============================================================
+
+TEST(ProcessImageTest, HandlesSurviveRelocationAndShareBytesWithPaths)
+{
+    link::symbolic::ProcessImage image;
+    const auto counter{ image.add("MAIN.counter", sizeof(int32_t)) };
+    const auto flag{ image.add("MAIN.flag", sizeof(bool)) };
+    EXPECT_EQ(image.add("MAIN.counter", 2), counter);
+    EXPECT_EQ(image.find("MAIN.flag"), flag);
+    EXPECT_FALSE(image.find("MAIN.unknown"));
+
+    const std::array value{ std::byte{ 1 } };
+    EXPECT_TRUE(image.write(flag, value));
+    EXPECT_FALSE(image.write(flag, value));
+    image.resize(flag, 64);
+    EXPECT_EQ(image.size(flag), 64u);
+    std::array<std::byte, 64> bytes{};
+    bytes.fill(std::byte{ 0xff });
+    EXPECT_EQ(image.read(flag, bytes), 64u);
+    EXPECT_EQ(bytes[0], std::byte{ 1 });
+    EXPECT_EQ(bytes[63], std::byte{ 0 });
+    EXPECT_EQ(image.path(flag), "MAIN.flag");
+}
+
+TEST(ProcessImageTest, AccessByHandleDoesNotAllocate)
+{
+    link::symbolic::LocalAdsLink link{ "handles" };
+    const auto symbol{ link.registerSymbol<int64_t>("MAIN.position") };
+    ASSERT_TRUE(symbol);
+    EXPECT_EQ(link.findSymbol("MAIN.position"), symbol);
+
+    link.writeSync(symbol, int64_t{ 1 });
+    const auto before{ g_heapAllocations.load() };
+    int64_t sum{ 0 };
+    for (int64_t i{ 0 }; i < 1000; ++i) {
+        link.writeSync(symbol, i);
+        sum += link.readSync<int64_t>(symbol);
+    }
+    EXPECT_EQ(g_heapAllocations.load(), before);
+    EXPECT_EQ(sum, 999 * 1000 / 2);
+    EXPECT_EQ(link.readSync<int64_t>("MAIN.position"), 999);
+}
+
+TEST(ProcessImageTest, InvalidHandleIsIgnored)
+{
+    link::symbolic::LocalAdsLink link{ "missing" };
+    (void)link.registerSymbol<int32_t>("MAIN.known");
+    const auto missing{ link.findSymbol("MAIN.unknown") };
+    ASSERT_FALSE(missing);
+
+    link.writeSync(missing, int32_t{ 7 });
+    std::array<std::byte, 4> bytes{};
+    EXPECT_EQ(link.readBytesSync(missing, bytes), 0u);
+    EXPECT_EQ(link.readSync<int32_t>(missing), 0);
+    EXPECT_EQ(link.readSync<int32_t>("MAIN.known"), 0);
+    EXPECT_FALSE(link.findSymbol("MAIN.unknown"));
+}
+
+TEST(ProcessImageTest, ReadersNeverSeeATornValue)
+{
+    struct Pose
+    {
+        std::array<int64_t, 6> axes{};
+    };
+
+    link::symbolic::LocalAdsLink link{ "seqlock" };
+    const auto symbol{ link.registerSymbol<Pose>("MAIN.pose") };
+    std::atomic<bool> done{ false };
+    std::atomic<int> torn{ 0 };
+
+    std::thread writer{ [&] {
+        for (int64_t i{ 1 }; i <= 20000; ++i) {
+            Pose pose{};
+            pose.axes.fill(i);
+            link.writeSync(symbol, pose);
+        }
+        done = true;
+    } };
+
+    auto sample = [&] {
+        int64_t last{ 0 };
+        while (!done) {
+            const auto pose{ link.readSync<Pose>(symbol) };
+            if (!std::ranges::all_of(pose.axes, [&](int64_t axis) { return axis == pose.axes[0]; }) ||
+                pose.axes[0] < last) {
+                ++torn;
+            }
+            last = pose.axes[0];
+        }
+    };
+    std::thread reader{ sample };
+    sample();
+
+    writer.join();
+    reader.join();
+    EXPECT_EQ(torn.load(), 0);
+    EXPECT_EQ(link.readSync<Pose>(symbol).axes[5], 20000);
+}
+
+TEST(ProcessImageTest, FindSeesEverySymbolAddedWhileItRuns)
+{
+    constexpr uint32_t SYMBOLS{ 5000 };
+    link::symbolic::ProcessImage image;
+    std::atomic<uint32_t> added{ 0 };
+    std::atomic<int> missed{ 0 };
+
+    std::thread reader{ [&] {
+        while (added.load() < SYMBOLS) {
+            const auto count{ added.load() };
+            for (uint32_t i{ count > 16 ? count - 16 : 0 }; i < count; ++i) {
+                if (image.find("MAIN.s" + std::to_string(i)).index != i) {
+                    ++missed;
+                }
+            }
+        }
+    } };
+    for (uint32_t i{ 0 }; i < SYMBOLS; ++i) {
+        (void)image.add("MAIN.s" + std::to_string(i), sizeof(int32_t));
+        added.store(i + 1);
+    }
+    reader.join();
+
+    EXPECT_EQ(missed.load(), 0);
+    EXPECT_EQ(image.symbolCount(), SYMBOLS);
+    EXPECT_EQ(image.find("MAIN.s0").index, 0u);
+    EXPECT_EQ(image.find("MAIN.s4999").index, SYMBOLS - 1);
+    EXPECT_FALSE(image.find("MAIN.s5000"));
+}
+
+TEST(ProcessImageTest, SharedImageIsVisibleThroughAnotherMapping)
+{
+    const auto stamp{ std::chrono::steady_clock::now().time_since_epoch().count() };
+    const auto name{ "TsimCAT.Test." + std::to_string(stamp) };
+    auto segment{ link::symbolic::ProcessImage::mapShared(name, 16, 4096) };
+    ASSERT_TRUE(segment);
+    EXPECT_TRUE(segment->created());
+    link::symbolic::LocalAdsLink link{ "shared", std::move(*segment) };
+    const auto counter{ link.registerSymbol<int32_t>("MAIN.counter") };
+    link.writeSync(counter, int32_t{ 7 });
+
+    // A second mapping stands in for another process.
+    auto peerSegment{ link::symbolic::ProcessImage::mapShared(name, 16, 4096) };
+    ASSERT_TRUE(peerSegment);
+    EXPECT_FALSE(peerSegment->created());
+    link::symbolic::ProcessImage peer{ std::move(*peerSegment) };
+
+    const auto seen{ peer.find("MAIN.counter") };
+    ASSERT_EQ(seen, counter);
+    int32_t value{ 0 };
+    EXPECT_EQ(peer.read(seen, std::as_writable_bytes(std::span{ &value, 1 })), sizeof(int32_t));
+    EXPECT_EQ(value, 7);
+
+    const auto before{ peer.sequence(seen) };
+    value = 9;
+    EXPECT_TRUE(peer.write(seen, std::as_bytes(std::span{ &value, 1 })));
+    EXPECT_FALSE(peer.write(seen, std::as_bytes(std::span{ &value, 1 })));
+    EXPECT_EQ(peer.sequence(seen), before + 2);
+    EXPECT_EQ(link.readSync<int32_t>(counter), 9);
+
+    const auto ready{ peer.add("PLC.ready", sizeof(bool)) };
+    EXPECT_EQ(link.findSymbol("PLC.ready"), ready);
+}
+
+TEST(ProcessImageTest, SharedImageStaysUsableAfterAValueThatDoesNotFit)
+{
+    const auto stamp{ std::chrono::steady_clock::now().time_since_epoch().count() };
+    const auto name{ "TsimCAT.Full." + std::to_string(stamp) };
+    auto segment{ link::symbolic::ProcessImage::mapShared(name, 16, 4096) };
+    ASSERT_TRUE(segment);
+    link::symbolic::ProcessImage image{ std::move(*segment) };
+    const auto used{ image.arenaSize() };
+
+    EXPECT_THROW((void)image.add("MAIN.large", 8192), std::length_error);
+    EXPECT_EQ(image.arenaSize(), used);
+    const auto small{ image.add("MAIN.small", 1024) };
+    EXPECT_TRUE(small);
+    EXPECT_EQ(image.size(small), 1024u);
+}
+
+TEST(ProcessImageTest, SharedImageOutlivesAWriterThatDiedHoldingItsLocks)
+{
+    using link::symbolic::ProcessImage;
+    const auto stamp{ std::chrono::steady_clock::now().time_since_epoch().count() };
+    const auto name{ "TsimCAT.Test." + std::to_string(stamp) };
+    auto segment{ ProcessImage::mapShared(name, 4, 1024) };
+    ASSERT_TRUE(segment);
+    ProcessImage image{ std::move(*segment) };
+    const auto symbol{ image.add("MAIN.value", sizeof(int32_t)) };
+    int32_t value{ 5 };
+    ASSERT_TRUE(image.write(symbol, std::as_bytes(std::span{ &value, 1 })));
+
+    // Leaves the first symbol's sequence and the directory lock odd, as a process that died inside a
+    // write and an add would. The offsets follow the segment layout: the lock is the header's second
+    // word and the sequence leads the first directory entry, after the 32-byte header.
+    auto dead{ ProcessImage::mapShared(name, 4, 1024) };
+    ASSERT_TRUE(dead);
+    std::launder(reinterpret_cast<std::atomic<uint32_t>*>(dead->data() + 4))->fetch_add(1);
+    std::launder(reinterpret_cast<std::atomic<uint32_t>*>(dead->data() + 32))->fetch_add(1);
+
+    const auto start{ std::chrono::steady_clock::now() };
+    value = 0;
+    EXPECT_EQ(image.read(symbol, std::as_writable_bytes(std::span{ &value, 1 })), sizeof(int32_t));
+    EXPECT_EQ(value, 5);
+    value = 6;
+    EXPECT_TRUE(image.write(symbol, std::as_bytes(std::span{ &value, 1 })));
+    EXPECT_TRUE(image.add("MAIN.other", sizeof(int32_t)));
+    EXPECT_GE(std::chrono::steady_clock::now() - start, ProcessImage::STALE_LOCK_TIMEOUT);
+
+    value = 0;
+    image.read(symbol, std::as_writable_bytes(std::span{ &value, 1 }));
+    EXPECT_EQ(value, 6);
+}
+
+// ============================================================
+// Reactor Tests
+// ============================================================
+
+TEST(AsioExecutorTest, CoroutinesAndTimersResumeOnTheReactorThread)
+{
+    using namespace std::chrono_literals;
+
+    link::raw::AsioExecutor reactor;
+    std::thread thread{ [&] { reactor.run(); } };
+    const auto reactorThread{ thread.get_id() };
+    std::vector<std::thread::id> seen;
+
+    coro::co_spawn(reactor, [&](link::raw::AsioExecutor& ex) -> coro::Task<void> {
+        seen.push_back(std::this_thread::get_id());
+        co_await coro::sleep(5ms);
+        seen.push_back(std::this_thread::get_id());
+        ex.stop();
+    });
+    thread.join();
+
+    ASSERT_EQ(seen.size(), 2u);
+    EXPECT_EQ(seen[0], reactorThread);
+    EXPECT_EQ(seen[1], reactorThread);
+    EXPECT_EQ(reactor.stats().resumes, 2u);
+}
+
+TEST(AsioExecutorTest, InvokeRightAfterStartRunsOnTheReactorThread)
+{
+    link::raw::AsioExecutor reactor;
+    auto thread{ reactor.start() };
+    const auto reactorThread{ thread.get_id() };
+    std::thread::id ranOn{};
+
+    // The thread may not have reached run() yet; the call must still wait for it, not run here.
+    reactor.invoke([&] { ranOn = std::this_thread::get_id(); });
+    reactor.stop();
+    thread.join();
+
+    EXPECT_EQ(ranOn, reactorThread);
+}
+
+TEST(TcpServerTest, TransfersResumeTheCallerOnItsOwnExecutor)
+{
+    using namespace std::chrono_literals;
+    constexpr uint16_t PORT{ 48613 };
+
+    link::raw::AsioExecutor reactor;
+    auto reactorThread{ reactor.start() };
+    link::raw::TcpServer server{ PORT, reactor };
+    ASSERT_TRUE(server.start());
+
+    std::thread client{ [] {
+        asio::io_context io;
+        asio::ip::tcp::socket socket{ io };
+        for (int attempt{ 0 }; attempt < 100; ++attempt) {
+            asio::error_code ec;
+            socket.connect({ asio::ip::address_v4::loopback(), PORT }, ec);
+            if (!ec) {
+                break;
+            }
+            socket.close();
+            std::this_thread::sleep_for(10ms);
+        }
+        std::array<std::byte, 4> request{};
+        request[3] = std::byte{ 4 };
+        asio::write(socket, asio::buffer(request));
+        std::array<std::byte, 4> reply{};
+        asio::read(socket, asio::buffer(reply));
+    } };
+
+    result::Result<void> accepted{};
+    result::Result<size_t> received{};
+    result::Result<void> sent{};
+    std::array<std::byte, 4> buffer{};
+    std::vector<std::thread::id> seen;
+    std::thread::id contextThread{};
+
+    coro::Context context;
+    coro::co_spawn(context, [&](coro::Context& ctx) -> coro::Task<void> {
+        contextThread = std::this_thread::get_id();
+        accepted = co_await server.accept(2s);
+        seen.push_back(std::this_thread::get_id());
+        received = co_await server.receiveInto("", buffer, 2s);
+        seen.push_back(std::this_thread::get_id());
+        sent = co_await server.sendFrom("", buffer, 2s);
+        seen.push_back(std::this_thread::get_id());
+        ctx.stop();
+    });
+    context.run();
+    client.join();
+
+    (void)server.stop();
+    reactor.stop();
+    reactorThread.join();
+
+    ASSERT_TRUE(accepted);
+    ASSERT_TRUE(received);
+    EXPECT_EQ(*received, 4u);
+    EXPECT_TRUE(sent);
+    EXPECT_EQ(buffer[3], std::byte{ 4 });
+    ASSERT_EQ(seen.size(), 3u);
+    for (const auto& id : seen) {
+        EXPECT_EQ(id, contextThread);
+    }
+}
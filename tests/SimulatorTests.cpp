@@ -1,11 +1,15 @@
 #include <gtest/gtest.h>
 
+#include "Coroutines/ThreadPool.hpp"
 #include "Link/Symbolic/LocalAdsLink.hpp"
 #include "Simulators/ConveyorSimulator.hpp"
 #include "Simulators/RobotSimulator.hpp"
 #include "Simulators/RotaryTableSimulator.hpp"
 #include "Simulators/SimpleCellCoordinator.hpp"
 
+#include <chrono>
+#include <thread>
+
 using namespace core;
 using namespace core::sim;
 
@@ -34,6 +38,18 @@ static void tickN(auto& sim, int n, double dt = 0.016)
         sim.update(dt);
 }
 
+template<typename Predicate>
+static bool waitFor(Predicate&& predicate, std::chrono::milliseconds timeout = std::chrono::seconds(2))
+{
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (!predicate()) {
+        if (std::chrono::steady_clock::now() > deadline)
+            return false;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
 // ============================================================
 // RotaryTableSimulator Tests
 // ============================================================
@@ -284,6 +300,51 @@ TEST_F(ConveyorTest, PartsCleanedUpPastEnd)
     EXPECT_TRUE(conveyor->parts().empty());
 }
 
+TEST_F(ConveyorTest, BoundConveyorAppliesCommandsAndTicksInOrderOnItsStrand)
+{
+    coro::ThreadPool pool{ 2 };
+    conveyor->bindExecutor(pool);
+    ASSERT_NE(conveyor->executor(), nullptr);
+    std::jthread runner{ [&] { pool.run(); } };
+
+    conveyor->setRunning(true);
+    conveyor->spawnPartAtPosition(1, 100.0);
+    for (int i = 0; i < 50; ++i) {
+        conveyor->scheduleUpdate(0.01); // 5mm per tick
+        // Reads race with the ticks but only ever see a published view.
+        (void)conveyor->parts();
+        (void)conveyor->sensorBlocked(0);
+    }
+
+    // The part was spawned before the first tick, so it saw all 50 of them.
+    EXPECT_TRUE(waitFor([&] {
+        const auto parts = conveyor->parts();
+        return parts.size() == 1 && parts[0].position > 349.0;
+    }));
+    EXPECT_NEAR(conveyor->parts()[0].position, 350.0, 1e-6);
+
+    pool.stop();
+    runner.join();
+}
+
+TEST_F(ConveyorTest, BoundConveyorPublishesCommandsWithoutATick)
+{
+    coro::ThreadPool pool{ 2 };
+    conveyor->bindExecutor(pool);
+    std::jthread runner{ [&] { pool.run(); } };
+
+    // No tick is scheduled, so only the coalesced republish can make these visible.
+    for (int i = 0; i < 3; ++i) {
+        conveyor->spawnPartAtPosition(1, 200.0 + i * 200.0);
+    }
+    conveyor->setDamperOpen(true);
+
+    EXPECT_TRUE(waitFor([&] { return conveyor->parts().size() == 3 && conveyor->damperOpen(); }));
+
+    pool.stop();
+    runner.join();
+}
+
 // ============================================================
 // RobotSimulator Tests
 // ============================================================